@@ -0,0 +1,307 @@
+/**
+ * @file CDataFrameBench.cpp
+ * @brief File containing the benchmarks of the 'DataFrame' class.
+ *
+ * Run with 'make bench', the results are written in 'bench/results.json'.
+ * The synthetic csv files are generated once in 'bench/input'.
+ */
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <sys/stat.h>
+
+#include "CDataFrame.hpp"
+
+// ==================================================
+// HELPERS
+
+/** @brief Set the number of OpenMP threads, 0 for the default. */
+static void set_threads(const int &n_threads)
+{
+#ifdef _OPENMP
+    static const int default_threads = omp_get_max_threads();
+    omp_set_num_threads(n_threads == 0 ? default_threads : n_threads);
+#else
+    (void)n_threads;
+#endif
+}
+
+/** @brief Build a data frame with keys and index. */
+static cdata_frame<double> make_frame(const size_t &rows, const size_t &cols, const std::string &prefix = "row")
+{
+    std::vector<std::string> keys(cols);
+    for (size_t c = 0; c < cols; c++)
+        keys[c] = "col" + std::to_string(c);
+
+    std::vector<std::string> index(rows);
+    for (size_t r = 0; r < rows; r++)
+        index[r] = prefix + std::to_string(r);
+
+    cmatrix<double> data(rows, cols);
+    for (size_t r = 0; r < rows; r++)
+        for (size_t c = 0; c < cols; c++)
+            data.cell(r, c) = r * 0.5 + c;
+
+    return cdata_frame<double>(keys, data, index);
+}
+
+/** @brief Write a synthetic csv file with a header, if it doesn't exist yet. */
+static std::string make_csv(const size_t &rows, const size_t &cols)
+{
+    const std::string path = "bench/input/bench_" + std::to_string(rows) + "_" + std::to_string(cols) + ".csv";
+
+    if (std::ifstream(path.c_str()).good())
+        return path;
+
+    mkdir("bench/input", 0755);
+    std::ofstream file(path.c_str());
+
+    for (size_t c = 0; c < cols; c++)
+        file << "col" << c << (c + 1 < cols ? "," : "\n");
+
+    for (size_t r = 0; r < rows; r++)
+        for (size_t c = 0; c < cols; c++)
+            file << r * 0.5 + c << (c + 1 < cols ? "," : "\n");
+
+    return path;
+}
+
+/** @brief Get the size of a file in bytes. */
+static int64_t file_size(const std::string &path)
+{
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 ? st.st_size : 0;
+}
+
+// ==================================================
+// READ CSV
+
+static void BM_read_csv(benchmark::State &state)
+{
+    const std::string path = make_csv(state.range(0), state.range(1));
+
+    for (auto _ : state)
+    {
+        cdata_frame<std::string> df = cdata_frame<std::string>::read_csv(path);
+        benchmark::DoNotOptimize(df);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * file_size(path));
+}
+BENCHMARK(BM_read_csv)->Args({1000, 4})->Args({10000, 4})->Args({10000, 32})->Args({100000, 4})->Unit(benchmark::kMillisecond);
+
+static void BM_read_csv_arena(benchmark::State &state)
+{
+    const std::string path = make_csv(state.range(0), state.range(1));
+
+    for (auto _ : state)
+    {
+        cdata_frame<cdata_string> df = cdata_frame<cdata_string>::read_csv_arena(path);
+        benchmark::DoNotOptimize(df);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * file_size(path));
+}
+BENCHMARK(BM_read_csv_arena)->Args({10000, 4})->Args({10000, 32})->Unit(benchmark::kMillisecond);
+
+// ==================================================
+// LOOKUP
+
+static void BM_rows_lookup(benchmark::State &state)
+{
+    const size_t rows = state.range(0);
+    const cdata_frame<double> df = make_frame(rows, 8);
+    const std::string index = "row" + std::to_string(rows - 1);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(df.rows(index));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_rows_lookup)->Range(1 << 10, 1 << 17);
+
+static void BM_columns_lookup(benchmark::State &state)
+{
+    const size_t cols = state.range(0);
+    const cdata_frame<double> df = make_frame(1000, cols);
+    const std::string key = "col" + std::to_string(cols - 1);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(df.columns(key));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_columns_lookup)->Range(8, 512);
+
+// ==================================================
+// PUSH
+
+static void BM_push_row_back(benchmark::State &state)
+{
+    const size_t rows = state.range(0);
+    const std::vector<double> row(8, 1.5);
+
+    for (auto _ : state)
+    {
+        cdata_frame<double> df;
+        for (size_t r = 0; r < rows; r++)
+            df.push_row_back(row);
+
+        benchmark::DoNotOptimize(df);
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+BENCHMARK(BM_push_row_back)->Range(1 << 8, 1 << 14)->Unit(benchmark::kMicrosecond);
+
+static void BM_ring_push_pop(benchmark::State &state)
+{
+    const size_t rows = state.range(0);
+    const std::vector<double> row(8, 1.5);
+
+    for (auto _ : state)
+    {
+        cdata_ring_frame<double> ring;
+        for (size_t r = 0; r < rows; r++)
+        {
+            ring.push_row_back(row);
+            if (r % 2 == 1)
+                ring.pop_row_front();
+        }
+
+        benchmark::DoNotOptimize(ring);
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+BENCHMARK(BM_ring_push_pop)->Range(1 << 8, 1 << 14)->Unit(benchmark::kMicrosecond);
+
+// ==================================================
+// CONCATENATE
+
+static void BM_concatenate(benchmark::State &state)
+{
+    const size_t parts = state.range(0);
+    std::vector<cdata_frame<double>> dfs;
+    for (size_t p = 0; p < parts; p++)
+        dfs.push_back(make_frame(100, 8, "p" + std::to_string(p) + "_"));
+
+    for (auto _ : state)
+    {
+        cdata_frame<double> df = dfs[0].copy();
+        for (size_t p = 1; p < parts; p++)
+            df.concatenate(dfs[p]);
+
+        benchmark::DoNotOptimize(df);
+    }
+
+    state.SetItemsProcessed(state.iterations() * parts * 100);
+}
+BENCHMARK(BM_concatenate)->RangeMultiplier(4)->Range(4, 256)->Unit(benchmark::kMillisecond);
+
+static void BM_merge(benchmark::State &state)
+{
+    const cdata_frame<double> df1 = make_frame(state.range(0), 8, "a");
+    const cdata_frame<double> df2 = make_frame(state.range(0), 8, "b");
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cdata_frame<double>::merge(df1, df2));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_merge)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMillisecond);
+
+static void BM_concat(benchmark::State &state)
+{
+    const size_t parts = state.range(0);
+    set_threads(state.range(1));
+
+    std::vector<cdata_frame<double>> dfs;
+    for (size_t p = 0; p < parts; p++)
+        dfs.push_back(make_frame(100, 8, "p" + std::to_string(p) + "_"));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cdata_frame<double>::concat(dfs));
+
+    state.SetItemsProcessed(state.iterations() * parts * 100);
+    set_threads(0);
+}
+BENCHMARK(BM_concat)->ArgsProduct({{4, 64, 256}, {1, 2, 4, 8}})->ArgNames({"parts", "threads"})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// ==================================================
+// SLICE
+
+static void BM_slice_rows(benchmark::State &state)
+{
+    const size_t rows = state.range(0);
+    const cdata_frame<double> df = make_frame(rows, 8);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(df.slice_rows(rows / 4, 3 * rows / 4));
+
+    state.SetItemsProcessed(state.iterations() * rows / 2);
+}
+BENCHMARK(BM_slice_rows)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
+
+static void BM_slice_columns(benchmark::State &state)
+{
+    const size_t rows = state.range(0);
+    const cdata_frame<double> df = make_frame(rows, 32);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(df.slice_columns(8, 23));
+
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+BENCHMARK(BM_slice_columns)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
+
+// ==================================================
+// PARALLEL
+
+static void BM_filter(benchmark::State &state)
+{
+    const size_t rows = state.range(0);
+    set_threads(state.range(1));
+
+    const cdata_frame<double> df = make_frame(rows, 8);
+    const cdata_mask mask = df.col("col0") > rows * 0.25;
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(df.filter(mask));
+
+    state.SetItemsProcessed(state.iterations() * rows);
+    set_threads(0);
+}
+BENCHMARK(BM_filter)->ArgsProduct({{1 << 16, 1 << 20}, {1, 2, 4, 8}})->ArgNames({"rows", "threads"})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_map(benchmark::State &state)
+{
+    const size_t rows = state.range(0);
+    const cdata_frame<double> df = make_frame(rows, 8);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(df.map([](const double &x)
+                                        { return x * x + 1; },
+                                        state.range(1)));
+
+    state.SetItemsProcessed(state.iterations() * rows * 8);
+}
+BENCHMARK(BM_map)->ArgsProduct({{1 << 16, 1 << 20}, {1, 2, 4, 8}})->ArgNames({"rows", "threads"})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// ==================================================
+// PRINT
+
+static void BM_print(benchmark::State &state)
+{
+    const cdata_frame<double> df = make_frame(state.range(0), 8);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(df.__print(std::true_type(), 5, 5, 0));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_print)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
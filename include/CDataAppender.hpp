@@ -0,0 +1,245 @@
+/**
+ * @file CDataAppender.hpp
+ * @brief File containing the concurrent appender of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+template <class T>
+class cdata_frame;
+
+/**
+ * @brief Rows appended by several threads at once, for multi-producer ingestion.
+ *
+ * A producer reserves the slots of its rows with an atomic cursor, writes them in chunks allocated on demand without
+ * lock, then marks them ready. The published rows are the longest prefix of ready rows: the readers only see rows
+ * fully written, in the order of their slots, whatever the order in which the producers finish.
+ *
+ * The labels (index) are checked for uniqueness in a hash set split in shards, each shard has its own lock.
+ *
+ * @tparam T The type of the data.
+ *
+ * @note The missing cells (NA) are not supported.
+ * @example
+ * cdata_appender<int> appender({"id", "value"});
+ * #pragma omp parallel for
+ * for (int i = 0; i < 1000; i++)
+ *     appender.append_row({i, 2 * i}, "row" + std::to_string(i));
+ * cdata_frame<int> df = appender.to_frame();
+ */
+template <class T>
+class cdata_appender
+{
+private:
+    /**
+     * @brief A chunk of rows, the slots are written by their producer and read once they are published.
+     */
+    struct cdata_chunk
+    {
+        std::vector<T> cells;
+        std::vector<std::string> labels;
+        std::unique_ptr<std::atomic<bool>[]> ready;
+    };
+
+    /**
+     * @brief A shard of the hash set of the labels.
+     */
+    struct cdata_shard
+    {
+        std::mutex mutex;
+        std::unordered_set<std::string> labels;
+    };
+
+    static const size_t n_shards = 64;
+
+    std::vector<std::string> m_keys;
+    size_t m_width;
+    size_t m_chunk_rows;
+    size_t m_capacity;
+    std::unique_ptr<std::atomic<cdata_chunk *>[]> m_chunks;
+    std::atomic<size_t> m_cursor;
+    std::atomic<size_t> m_published;
+    cdata_shard m_shards[n_shards];
+
+    /**
+     * @brief Get a chunk, allocated by the first thread that needs it.
+     *
+     * @param pos The position of the chunk.
+     * @return cdata_chunk* The chunk.
+     */
+    cdata_chunk *__get_chunk(const size_t &pos);
+    /**
+     * @brief Reserve the slots of rows.
+     *
+     * @param n The number of rows.
+     * @return size_t The position of the first slot.
+     * @throw std::runtime_error If the rows exceed the capacity.
+     */
+    size_t __reserve(const size_t &n);
+    /**
+     * @brief Write a row in its slot.
+     *
+     * @param pos The position of the slot.
+     * @param val The row.
+     * @param label The label of the row.
+     */
+    void __write(const size_t &pos, const std::vector<T> &val, const std::string &label);
+    /**
+     * @brief Move the published cursor over the ready rows that follow it.
+     */
+    void __publish();
+    /**
+     * @brief Add a label to the hash set.
+     *
+     * @param label The label, empty labels are not checked.
+     * @return true If the label is new.
+     */
+    bool __insert_label(const std::string &label);
+    /**
+     * @brief Remove a label from the hash set.
+     *
+     * @param label The label.
+     */
+    void __erase_label(const std::string &label);
+    /**
+     * @brief Check if a row has the width of the appender.
+     *
+     * @param val The row.
+     * @throw std::invalid_argument If the row has not the width of the appender.
+     */
+    void __check_row(const std::vector<T> &val) const;
+    /**
+     * @brief Check if a position is a published row.
+     *
+     * @param pos The position of the row.
+     * @throw std::out_of_range If the row is not published.
+     */
+    void __check_pos(const size_t &pos) const;
+
+public:
+    /**
+     * @brief The default number of rows of a chunk.
+     */
+    static const size_t default_chunk_rows = 1 << 12;
+    /**
+     * @brief The default maximum number of rows.
+     */
+    static const size_t default_capacity = 1 << 26;
+
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a new empty appender.
+     *
+     * @param keys The keys of the columns.
+     * @param capacity The maximum number of rows, only the table of the chunks is allocated. Default is 2^26.
+     * @param chunk_rows The number of rows of a chunk. Default is 4096.
+     * @throw std::invalid_argument If there is no key or the chunks are empty.
+     */
+    cdata_appender(const std::vector<std::string> &keys, const size_t &capacity = size_t(default_capacity), const size_t &chunk_rows = size_t(default_chunk_rows));
+    cdata_appender(const cdata_appender &) = delete;
+    cdata_appender &operator=(const cdata_appender &) = delete;
+    /**
+     * @brief Free the chunks.
+     */
+    ~cdata_appender();
+
+    // GETTER
+    /**
+     * @brief Get the number of published rows.
+     *
+     * @return size_t The number of rows visible to the readers.
+     */
+    size_t height() const;
+    /**
+     * @brief Get the number of reserved rows, published or being written.
+     *
+     * @return size_t The number of rows.
+     */
+    size_t reserved() const;
+    /**
+     * @brief Get the number of columns.
+     *
+     * @return size_t The number of columns.
+     */
+    size_t width() const;
+    /**
+     * @brief Get the maximum number of rows.
+     *
+     * @return size_t The capacity.
+     */
+    size_t capacity() const;
+    /**
+     * @brief Get the keys.
+     *
+     * @return std::vector<std::string> The keys.
+     */
+    std::vector<std::string> keys() const;
+    /**
+     * @brief Check if a label was appended.
+     *
+     * @param label The label.
+     * @return true If a row has the label, published or not.
+     */
+    bool contains(const std::string &label);
+    /**
+     * @brief Get an element of a published row.
+     *
+     * @param row The position of the row.
+     * @param col The position of the column.
+     * @return const T& The element.
+     * @throw std::out_of_range If the row is not published or the column is out of range.
+     */
+    const T &get(const size_t &row, const size_t &col) const;
+    /**
+     * @brief Get the label of a published row.
+     *
+     * @param pos The position of the row.
+     * @return const std::string& The label, empty if the row has no label.
+     * @throw std::out_of_range If the row is not published.
+     */
+    const std::string &index(const size_t &pos) const;
+    /**
+     * @brief Copy the published rows in a data frame.
+     *
+     * @return cdata_frame<T> The data frame, with an index if a row has a label.
+     *
+     * @note The rows appended during the copy are not included.
+     * @note With an index, a row without label is labelled by its position, prefixed by '_' while the label is taken.
+     */
+    cdata_frame<T> to_frame() const;
+
+    // MANIPULATION
+    /**
+     * @brief Append a row, safe to call from several threads.
+     *
+     * @param val The row.
+     * @param label The label of the row. Default is no label.
+     * @return size_t The position of the row.
+     * @throw std::invalid_argument If the row has not the width of the appender.
+     * @throw std::runtime_error If the label already exists or the appender is full.
+     */
+    size_t append_row(const std::vector<T> &val, const std::string &label = "");
+    /**
+     * @brief Append rows in consecutive positions with one reservation, safe to call from several threads.
+     *
+     * @param val The rows.
+     * @param labels The labels of the rows, empty for no label. Default is empty.
+     * @return size_t The position of the first row.
+     * @throw std::invalid_argument If a row has not the width of the appender, or the labels are not one per row.
+     * @throw std::runtime_error If a label already exists or the appender is full, no row is appended.
+     */
+    size_t append_rows(const std::vector<std::vector<T>> &val, const std::vector<std::string> &labels = std::vector<std::string>());
+};
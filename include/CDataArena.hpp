@@ -0,0 +1,174 @@
+/**
+ * @file CDataArena.hpp
+ * @brief File containing the arena allocator of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Monotonic arena: the memory is taken from large slabs and released all at once.
+ *
+ * The deallocation of an element is a no-op, the slabs are freed when the arena is destroyed,
+ * so the teardown of a data frame is one deallocation per slab instead of one per cell.
+ *
+ * @note The allocation is thread safe.
+ */
+class cdata_arena
+{
+private:
+    std::vector<std::unique_ptr<char[]>> m_slabs = std::vector<std::unique_ptr<char[]>>();
+    size_t m_slab_size;
+    char *m_cur = nullptr;
+    size_t m_left = 0;
+    size_t m_used = 0;
+    size_t m_capacity = 0;
+    std::mutex m_mutex;
+
+public:
+    /**
+     * @brief The default size of a slab, in bytes.
+     */
+    static const size_t default_slab_size = 1 << 16;
+
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a new empty arena.
+     *
+     * @param slab_size The size of a slab in bytes. Default is 64 KiB.
+     * @throw std::invalid_argument If the size of a slab is 0.
+     */
+    explicit cdata_arena(const size_t &slab_size = size_t(default_slab_size));
+    cdata_arena(const cdata_arena &) = delete;
+    cdata_arena &operator=(const cdata_arena &) = delete;
+
+    // ALLOCATION
+    /**
+     * @brief Allocate memory in the current slab, or in a new one if it is full.
+     *
+     * @param size The number of bytes.
+     * @param align The alignment of the memory. Default is the alignment of any scalar type.
+     * @return void* The memory, valid until the arena is destroyed.
+     *
+     * @note A request larger than a slab gets its own slab.
+     */
+    void *allocate(const size_t &size, const size_t &align = alignof(std::max_align_t));
+
+    // GETTER
+    /**
+     * @brief Get the number of slabs allocated.
+     *
+     * @return size_t The number of slabs.
+     */
+    size_t n_slabs() const;
+    /**
+     * @brief Get the number of bytes allocated by the elements.
+     *
+     * @return size_t The number of bytes used, including the padding.
+     */
+    size_t used() const;
+    /**
+     * @brief Get the number of bytes of the slabs.
+     *
+     * @return size_t The number of bytes reserved.
+     */
+    size_t capacity() const;
+};
+
+/**
+ * @brief Standard allocator taking its memory from an arena.
+ *
+ * The allocator shares the ownership of its arena, so the arena lives as long as an element allocated in it.
+ * A default constructed allocator has no arena and uses the global heap.
+ *
+ * @tparam U The type of the elements allocated.
+ */
+template <class U>
+class cdata_arena_allocator
+{
+private:
+    std::shared_ptr<cdata_arena> m_arena;
+
+    template <class V>
+    friend class cdata_arena_allocator;
+
+public:
+    typedef U value_type;
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a new allocator using the global heap.
+     */
+    cdata_arena_allocator() = default;
+    /**
+     * @brief Construct a new allocator taking its memory from an arena.
+     *
+     * @param arena The arena.
+     */
+    cdata_arena_allocator(const std::shared_ptr<cdata_arena> &arena);
+    /**
+     * @brief Construct a new allocator sharing the arena of an allocator of another type.
+     *
+     * @param alloc The allocator.
+     */
+    template <class V>
+    cdata_arena_allocator(const cdata_arena_allocator<V> &alloc);
+
+    // ALLOCATION
+    /**
+     * @brief Allocate memory for elements.
+     *
+     * @param n The number of elements.
+     * @return U* The memory.
+     */
+    U *allocate(const size_t &n);
+    /**
+     * @brief Deallocate memory of elements.
+     *
+     * @param ptr The memory.
+     * @param n The number of elements.
+     *
+     * @note Does nothing if the memory belongs to an arena.
+     */
+    void deallocate(U *ptr, const size_t &n);
+
+    // GETTER
+    /**
+     * @brief Get the arena of the allocator.
+     *
+     * @return const std::shared_ptr<cdata_arena>& The arena, nullptr if the allocator uses the global heap.
+     */
+    const std::shared_ptr<cdata_arena> &arena() const;
+
+    // OPERATOR
+    template <class V>
+    bool operator==(const cdata_arena_allocator<V> &alloc) const;
+    template <class V>
+    bool operator!=(const cdata_arena_allocator<V> &alloc) const;
+};
+
+/**
+ * @brief String whose characters are allocated in an arena.
+ *
+ * @example
+ * cdata_frame<cdata_string> df = cdata_frame<cdata_string>::read_csv_arena("data.csv");
+ */
+typedef std::basic_string<char, std::char_traits<char>, cdata_arena_allocator<char>> cdata_string;
+
+#include "../src/CDataArena.tpp"
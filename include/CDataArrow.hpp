@@ -0,0 +1,498 @@
+/**
+ * @file CDataArrow.hpp
+ * @brief File containing the Arrow IPC format of the 'CDataFrame' library.
+ *
+ * The Arrow IPC stream and file formats are written and read without the Arrow library: the metadata of the messages
+ * are flatbuffers built and read by 'cdata_flatbuffer' and 'cdata_flatbuffer_view'.
+ *
+ * @see https://arrow.apache.org/docs/format/Columnar.html#serialization-and-interprocess-communication-ipc
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "CDataParse.hpp"
+
+// ==================================================
+// FLATBUFFER
+
+/**
+ * @brief Builder of a flatbuffer, filled from the end like the reference implementation.
+ *
+ * The objects are built before the objects referring to them: a string, a vector or a table returns its reference,
+ * which is then added to a vector or to a field of a table.
+ *
+ * @example
+ * cdata_flatbuffer fb;
+ * size_t name = fb.string("price");
+ * fb.start_table();
+ * fb.add_offset(0, name);
+ * std::string bytes = fb.finish(fb.end_table());
+ */
+class cdata_flatbuffer
+{
+private:
+    std::string m_bytes = std::string();
+    size_t m_min_align = 8;
+    size_t m_table = 0;
+    std::vector<std::pair<uint16_t, size_t>> m_fields = std::vector<std::pair<uint16_t, size_t>>();
+
+    /**
+     * @brief Pad so that the buffer is aligned after the next bytes.
+     *
+     * @param len The number of the next bytes.
+     * @param align The alignment, a power of two.
+     */
+    void __pre_align(const size_t &len, const size_t &align);
+    /**
+     * @brief Compute an offset to an object, from the position of the next offset.
+     *
+     * @param ref The reference of the object.
+     * @return uint32_t The offset.
+     */
+    uint32_t __refer(const size_t &ref);
+
+public:
+    /**
+     * @brief Get the number of bytes built.
+     *
+     * @return size_t The number of bytes, the reference of the last object.
+     */
+    size_t size() const;
+    /**
+     * @brief Add an integer, aligned on its size.
+     *
+     * @tparam U The type of the integer.
+     * @param val The integer.
+     */
+    template <class U>
+    void push(const U &val);
+    /**
+     * @brief Add a string.
+     *
+     * @param val The string.
+     * @return size_t The reference of the string.
+     */
+    size_t string(const std::string &val);
+    /**
+     * @brief Add a vector of objects.
+     *
+     * @param refs The references of the objects.
+     * @return size_t The reference of the vector.
+     */
+    size_t vector(const std::vector<size_t> &refs);
+    /**
+     * @brief Add a vector of structs.
+     *
+     * @param bytes The bytes of the structs, in order.
+     * @param count The number of structs.
+     * @param align The alignment of a struct.
+     * @return size_t The reference of the vector.
+     */
+    size_t vector(const std::string &bytes, const size_t &count, const size_t &align);
+    /**
+     * @brief Start a table, its fields are added next.
+     */
+    void start_table();
+    /**
+     * @brief Add an integer field to the table.
+     *
+     * @tparam U The type of the field.
+     * @param slot The position of the field in the schema of the table.
+     * @param val The value.
+     */
+    template <class U>
+    void add(const uint16_t &slot, const U &val);
+    /**
+     * @brief Add a field referring to an object to the table.
+     *
+     * @param slot The position of the field in the schema of the table.
+     * @param ref The reference of the object.
+     */
+    void add_offset(const uint16_t &slot, const size_t &ref);
+    /**
+     * @brief End the table and write its vtable.
+     *
+     * @return size_t The reference of the table.
+     */
+    size_t end_table();
+    /**
+     * @brief Finish the flatbuffer.
+     *
+     * @param root The reference of the root table.
+     * @return std::string The bytes of the flatbuffer, their size is a multiple of 8.
+     */
+    std::string finish(const size_t &root);
+};
+
+/**
+ * @brief Read-only view over a flatbuffer, every read is bounds checked.
+ *
+ * The tables, vectors and strings are given by their position in the buffer.
+ */
+class cdata_flatbuffer_view
+{
+private:
+    const char *m_data;
+    size_t m_size;
+
+public:
+    /**
+     * @brief Construct a view.
+     *
+     * @param data The bytes of the flatbuffer.
+     * @param size The number of bytes.
+     */
+    cdata_flatbuffer_view(const char *data, const size_t &size);
+
+    /**
+     * @brief Read a little-endian integer.
+     *
+     * @tparam U The type of the integer.
+     * @param pos The position of the integer.
+     * @return U The integer.
+     * @throw std::runtime_error If the integer is outside the buffer.
+     */
+    template <class U>
+    U read(const size_t &pos) const;
+    /**
+     * @brief Get the root table.
+     *
+     * @return size_t The position of the table.
+     */
+    size_t root() const;
+    /**
+     * @brief Get the position of a field in a table.
+     *
+     * @param table The position of the table.
+     * @param slot The position of the field in the schema of the table.
+     * @return size_t The offset of the field from the table, 0 if the field is absent.
+     */
+    size_t field(const size_t &table, const uint16_t &slot) const;
+    /**
+     * @brief Get an integer field.
+     *
+     * @tparam U The type of the field.
+     * @param table The position of the table.
+     * @param slot The position of the field in the schema of the table.
+     * @param def The default value, if the field is absent.
+     * @return U The value.
+     */
+    template <class U>
+    U scalar(const size_t &table, const uint16_t &slot, const U &def) const;
+    /**
+     * @brief Get the object referred to by a field.
+     *
+     * @param table The position of the table.
+     * @param slot The position of the field in the schema of the table.
+     * @return size_t The position of the object, 0 if the field is absent.
+     */
+    size_t ref(const size_t &table, const uint16_t &slot) const;
+    /**
+     * @brief Get the number of elements of a vector.
+     *
+     * @param vec The position of the vector, 0 for an absent vector.
+     * @return size_t The number of elements.
+     */
+    size_t length(const size_t &vec) const;
+    /**
+     * @brief Get an object of a vector of objects.
+     *
+     * @param vec The position of the vector.
+     * @param pos The position of the object in the vector.
+     * @return size_t The position of the object.
+     */
+    size_t at(const size_t &vec, const size_t &pos) const;
+    /**
+     * @brief Get a string.
+     *
+     * @param pos The position of the string, 0 for an absent string.
+     * @return std::string The string.
+     */
+    std::string string(const size_t &pos) const;
+};
+
+// ==================================================
+// ARROW
+
+/**
+ * @brief A column of the schema of an Arrow message.
+ */
+struct cdata_arrow_field
+{
+    /**
+     * @brief The name of the column, the key of the data frame.
+     */
+    std::string name = std::string();
+    /**
+     * @brief The type of the column, see the constants of 'cdata_arrow'.
+     */
+    uint8_t type = 0;
+    /**
+     * @brief The number of bits of an integer.
+     */
+    int32_t bit_width = 0;
+    /**
+     * @brief If an integer is signed.
+     */
+    bool is_signed = false;
+    /**
+     * @brief The precision of a floating point number: 0 half, 1 single, 2 double.
+     */
+    int16_t precision = 0;
+};
+
+/**
+ * @brief A buffer of the body of a record batch.
+ */
+struct cdata_arrow_buffer
+{
+    int64_t offset = 0;
+    int64_t length = 0;
+};
+
+/**
+ * @brief A column of a record batch read, its buffers point in the bytes read.
+ */
+struct cdata_arrow_column
+{
+    cdata_arrow_field field = cdata_arrow_field();
+    int64_t length = 0;
+    int64_t null_count = 0;
+    /**
+     * @brief The validity bitmap, nullptr if no value is null.
+     */
+    const uint8_t *validity = nullptr;
+    /**
+     * @brief The offsets of the strings, nullptr for the other types.
+     */
+    const char *offsets = nullptr;
+    const char *data = nullptr;
+    size_t data_size = 0;
+
+    /**
+     * @brief Check if a value is not null.
+     *
+     * @param pos The position of the value.
+     * @return true If the value is valid.
+     */
+    bool is_valid(const size_t &pos) const;
+    /**
+     * @brief Get a number, read with the type of the column.
+     *
+     * @tparam U The type of the number.
+     * @param pos The position of the value.
+     * @param out The number.
+     */
+    template <class U>
+    void value(const size_t &pos, U &out) const;
+    /**
+     * @brief Get a string.
+     *
+     * @param pos The position of the value.
+     * @param out The string.
+     * @throw std::runtime_error If the offsets are outside the data.
+     */
+    void value(const size_t &pos, std::string &out) const;
+
+    /**
+     * @brief Read a value of the host byte order, possibly unaligned.
+     *
+     * @tparam U The type of the value.
+     * @param data The bytes of the value.
+     * @return U The value.
+     */
+    template <class U>
+    static U __load(const char *data);
+};
+
+/**
+ * @brief Writer and reader of the messages of the Arrow IPC format.
+ *
+ * A message is a flatbuffer (Schema or RecordBatch) followed by a body holding the buffers of the columns. The stream
+ * format is a schema, record batches and an end marker. The file format surrounds the stream with the magic string
+ * "ARROW1" and ends with a footer locating the record batches.
+ */
+class cdata_arrow
+{
+private:
+    /**
+     * @brief Build a schema in a flatbuffer.
+     *
+     * @param fb The flatbuffer.
+     * @param fields The columns.
+     * @param metadata The custom metadata of the schema.
+     * @return size_t The reference of the schema.
+     */
+    static size_t __schema(cdata_flatbuffer &fb, const std::vector<cdata_arrow_field> &fields, const std::vector<std::pair<std::string, std::string>> &metadata);
+    /**
+     * @brief Finish the flatbuffer of a message.
+     *
+     * @param fb The flatbuffer.
+     * @param header_type The type of the header: 1 schema, 3 record batch.
+     * @param header The reference of the header.
+     * @param body_length The number of bytes of the body.
+     * @return std::string The flatbuffer.
+     */
+    static std::string __message(cdata_flatbuffer &fb, const uint8_t &header_type, const size_t &header, const int64_t &body_length);
+    /**
+     * @brief Append the offsets and the bytes of a column of strings.
+     */
+    template <class U, class Function>
+    static void __append_values(std::string &body, std::vector<cdata_arrow_buffer> &buffers, const size_t &length, const std::vector<uint64_t> *valid, Function cell, std::true_type);
+    /**
+     * @brief Append the values of a column of numbers.
+     */
+    template <class U, class Function>
+    static void __append_values(std::string &body, std::vector<cdata_arrow_buffer> &buffers, const size_t &length, const std::vector<uint64_t> *valid, Function cell, std::false_type);
+    /**
+     * @brief Append a buffer to a body, padded to 8 bytes.
+     *
+     * @param body The body.
+     * @param buffers The buffers of the body, appended.
+     * @param data The bytes of the buffer.
+     * @param size The number of bytes.
+     */
+    static void __append_buffer(std::string &body, std::vector<cdata_arrow_buffer> &buffers, const char *data, const size_t &size);
+    /**
+     * @brief Append a little-endian integer to bytes.
+     *
+     * @tparam U The type of the integer.
+     * @param out The bytes.
+     * @param val The integer.
+     */
+    template <class U>
+    static void __put(std::string &out, const U &val);
+    /**
+     * @brief Get the byte order of the host, as written in a schema.
+     *
+     * @return int16_t 0 little-endian, 1 big-endian.
+     */
+    static int16_t __endianness();
+    /**
+     * @brief Quote a string in JSON.
+     *
+     * @param val The string.
+     * @return std::string The quoted string.
+     */
+    static std::string __json(const std::string &val);
+    /**
+     * @brief Read a schema.
+     */
+    static void __read_schema(const cdata_flatbuffer_view &fb, const size_t &schema, std::vector<cdata_arrow_field> &fields, std::vector<std::pair<std::string, std::string>> &metadata);
+    /**
+     * @brief Read the columns of a record batch.
+     */
+    static std::vector<cdata_arrow_column> __read_batch(const cdata_flatbuffer_view &fb, const size_t &batch, const std::vector<cdata_arrow_field> &fields, const char *body, const size_t &body_length);
+
+public:
+    static const uint8_t type_int = 2;
+    static const uint8_t type_float = 3;
+    static const uint8_t type_utf8 = 5;
+    static const uint8_t type_bool = 6;
+    static const uint8_t type_large_utf8 = 20;
+
+    /**
+     * @brief The name of the column storing the index, the one used by pandas.
+     */
+    static const char *index_name();
+    /**
+     * @brief Build the metadata read by pandas to restore the index, stored with the key "pandas".
+     *
+     * @tparam U The type of the cells.
+     * @param names The names of the columns, without the index.
+     * @return std::string The metadata, in JSON.
+     */
+    template <class U>
+    static std::string pandas(const std::vector<std::string> &names);
+
+    /**
+     * @brief Get the Arrow type of a type of cells.
+     *
+     * @tparam U The type of the cells, arithmetic or string.
+     * @param name The name of the column.
+     * @return cdata_arrow_field The column.
+     * @throw std::invalid_argument If the type has no Arrow type.
+     */
+    template <class U>
+    static cdata_arrow_field field(const std::string &name);
+    /**
+     * @brief Append the buffers of a column to a body.
+     *
+     * @tparam U The type of the cells.
+     * @tparam Function The type of the getter of the cells.
+     * @param body The body.
+     * @param buffers The buffers of the body, appended.
+     * @param length The number of cells.
+     * @param valid The validity of the cells, nullptr if all are valid.
+     * @param cell The getter of a cell from its position.
+     */
+    template <class U, class Function>
+    static void append_column(std::string &body, std::vector<cdata_arrow_buffer> &buffers, const size_t &length, const std::vector<uint64_t> *valid, Function cell);
+
+    /**
+     * @brief Write a message.
+     *
+     * @param out The output stream.
+     * @param metadata The flatbuffer of the message.
+     * @param body The body of the message.
+     * @return size_t The number of bytes of the prefix and the metadata.
+     */
+    static size_t write_message(std::ostream &out, const std::string &metadata, const std::string &body);
+    /**
+     * @brief Build the flatbuffer of a schema message.
+     *
+     * @param fields The columns.
+     * @param metadata The custom metadata of the schema.
+     * @return std::string The flatbuffer.
+     */
+    static std::string schema(const std::vector<cdata_arrow_field> &fields, const std::vector<std::pair<std::string, std::string>> &metadata);
+    /**
+     * @brief Build the flatbuffer of a record batch message.
+     *
+     * @param length The number of rows.
+     * @param nodes The number of values and of null values of each column.
+     * @param buffers The buffers of the body.
+     * @param body_length The number of bytes of the body.
+     * @return std::string The flatbuffer.
+     */
+    static std::string record_batch(const int64_t &length, const std::vector<std::pair<int64_t, int64_t>> &nodes, const std::vector<cdata_arrow_buffer> &buffers, const int64_t &body_length);
+    /**
+     * @brief Build the flatbuffer of the footer of a file.
+     *
+     * @param fields The columns.
+     * @param metadata The custom metadata of the schema.
+     * @param blocks The position, the size of the metadata and the size of the body of each record batch.
+     * @return std::string The flatbuffer.
+     */
+    static std::string footer(const std::vector<cdata_arrow_field> &fields, const std::vector<std::pair<std::string, std::string>> &metadata, const std::vector<std::tuple<int64_t, int32_t, int64_t>> &blocks);
+
+    /**
+     * @brief Read the messages of a stream or a file.
+     *
+     * @param bytes The bytes of the stream or the file.
+     * @param fields The columns of the schema.
+     * @param metadata The custom metadata of the schema.
+     * @param batches The columns of each record batch, their buffers point in the bytes.
+     * @throw std::runtime_error If the bytes are not a valid Arrow stream, or use an unsupported feature.
+     */
+    static void read(const std::string &bytes, std::vector<cdata_arrow_field> &fields, std::vector<std::pair<std::string, std::string>> &metadata, std::vector<std::vector<cdata_arrow_column>> &batches);
+};
+
+#include "../src/CDataArrow.tpp"
@@ -0,0 +1,137 @@
+/**
+ * @file CDataColumn.hpp
+ * @brief File containing the column view class of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "CDataExpression.hpp"
+
+/**
+ * @brief Read-only view over a column of a data frame.
+ *
+ * The view is the leaf of the expressions over columns: the arithmetic operators build lazy expressions and the
+ * comparison operators build masks (see CDataExpression.hpp).
+ *
+ * The view doesn't copy the data, so it must not outlive the data frame and is invalidated by any
+ * operation that changes the shape of the data frame.
+ *
+ * @tparam T The type of the data.
+ */
+template <class T>
+class cdata_column : public cdata_expression<cdata_column<T>>
+{
+private:
+    const cdata_frame<T> *m_df;
+    size_t m_pos;
+
+    /**
+     * @brief Call a function with the position of each row that is not missing (NA).
+     *
+     * @param func The function called with the position of the row.
+     *
+     * @note The validity bitmap is read a word at a time: full words are scanned densely, the others bit by bit.
+     */
+    template <class Function>
+    void __for_each_valid(Function func) const;
+
+public:
+    typedef T value_type;
+
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a new view over a column.
+     *
+     * @param df The data frame.
+     * @param pos The position of the column.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    cdata_column(const cdata_frame<T> &df, const size_t &pos);
+
+    // GETTER
+    /**
+     * @brief Get the number of elements of the column.
+     *
+     * @return size_t The number of rows of the data frame.
+     */
+    size_t size() const;
+    /**
+     * @brief Get the position of the column in the data frame.
+     *
+     * @return size_t The position of the column.
+     */
+    size_t pos() const;
+    /**
+     * @brief Get the element at the given row.
+     *
+     * @param row The position of the row.
+     * @return const T& The element.
+     */
+    const T &operator[](const size_t &row) const;
+    /**
+     * @brief Copy the column in a vector.
+     *
+     * @return std::vector<T> The elements of the column.
+     */
+    std::vector<T> to_vector() const;
+    /**
+     * @brief Check if the expression is a constant.
+     *
+     * @return false Always, a column has one element per row.
+     */
+    bool is_scalar() const;
+    /**
+     * @brief Clear the bits of the rows missing (NA) in the column.
+     *
+     * @param mask The mask, one bit per row.
+     *
+     * @note The validity bitmap is combined a word at a time.
+     */
+    void and_valid(cdata_mask &mask) const;
+
+    // REDUCTION
+    /**
+     * @brief Count the elements that are not missing (NA).
+     *
+     * @return size_t The number of valid elements.
+     */
+    size_t count() const;
+    /**
+     * @brief Sum the elements, skipping the missing ones (NA).
+     *
+     * @return T The sum of the valid elements, T() if there is none.
+     *
+     * @example
+     * int total = df.col("price").sum();
+     */
+    T sum() const;
+    /**
+     * @brief Compute the mean of the elements, skipping the missing ones (NA).
+     *
+     * @return double The mean of the valid elements, NaN if there is none.
+     */
+    double mean() const;
+    /**
+     * @brief Get the minimum of the elements, skipping the missing ones (NA).
+     *
+     * @return T The minimum of the valid elements.
+     * @throw std::runtime_error If there is no valid element.
+     */
+    T min() const;
+    /**
+     * @brief Get the maximum of the elements, skipping the missing ones (NA).
+     *
+     * @return T The maximum of the valid elements.
+     * @throw std::runtime_error If there is no valid element.
+     */
+    T max() const;
+};
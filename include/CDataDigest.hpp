@@ -0,0 +1,154 @@
+/**
+ * @file CDataDigest.hpp
+ * @brief File containing the quantile sketch of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Cluster of values of a digest: their mean and their number.
+ */
+struct cdata_centroid
+{
+    double mean;
+    double weight;
+};
+
+/**
+ * @brief Merging t-digest: a sketch of a distribution to approximate its quantiles in a bounded memory.
+ *
+ * The values are summarized by centroids, small near the tails and large near the median, so the high quantiles
+ * (p99, p999) stay accurate. The digests of several parts of the data can be merged, so a digest can be built by
+ * chunks or by threads.
+ *
+ * The number of centroids is bounded by the compression, whatever the number of values.
+ *
+ * @note The values added are buffered and merged in the centroids when the buffer is full, on 'merge' and on
+ * 'compress'. The const methods never modify the digest: while values are buffered, a query merges a copy of them, so
+ * a digest can be queried by several threads at once. Call 'compress' once before querying it many times.
+ * @note The last centroids still hold many values: for 1M exponential values and a compression of 100, p999 is off by
+ * up to 4% and p9999 by up to 35%. A compression of 1000 keeps both under 1%.
+ */
+class cdata_digest
+{
+private:
+    double m_compression;
+    double m_count = 0;
+    double m_min = std::numeric_limits<double>::infinity();
+    double m_max = -std::numeric_limits<double>::infinity();
+    std::vector<cdata_centroid> m_centroids = std::vector<cdata_centroid>();
+    std::vector<cdata_centroid> m_buffer = std::vector<cdata_centroid>();
+
+    /**
+     * @brief Merge the centroids and the buffered values, without modifying the digest.
+     *
+     * @return std::vector<cdata_centroid> The centroids of all the values, sorted by mean.
+     */
+    std::vector<cdata_centroid> __merged() const;
+    /**
+     * @brief Get the weight limit of a centroid starting at a given weight, from the scale function k1.
+     *
+     * @param weight The weight of the centroids before it.
+     * @return double The maximum cumulative weight at the end of the centroid.
+     */
+    double __limit(const double &weight) const;
+
+public:
+    /**
+     * @brief The default compression, about 1% of error from the median to p999.
+     */
+    static const size_t default_compression = 100;
+
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a new empty digest.
+     *
+     * @param compression The compression, the higher the more accurate and the more centroids. Default is 100.
+     * @throw std::invalid_argument If the compression is less than 1.
+     */
+    explicit cdata_digest(const double &compression = double(default_compression));
+
+    // MANIPULATION
+    /**
+     * @brief Add a value.
+     *
+     * @param x The value, NaN is ignored.
+     * @param weight The number of times the value is added. Default is 1.
+     */
+    void add(const double &x, const double &weight = 1);
+    /**
+     * @brief Add the values of another digest.
+     *
+     * @param digest The digest.
+     *
+     * @example
+     * cdata_digest digest = df.digest("latency");
+     * digest.merge(df2.digest("latency"));
+     */
+    void merge(const cdata_digest &digest);
+    /**
+     * @brief Merge the buffered values in the centroids.
+     *
+     * @note The queries of a digest compressed don't copy anything.
+     */
+    void compress();
+
+    // GETTER
+    /**
+     * @brief Get the number of values added.
+     *
+     * @return double The total weight of the values.
+     */
+    double count() const;
+    /**
+     * @brief Get the number of centroids.
+     *
+     * @return size_t The number of centroids, once the buffer merged.
+     */
+    size_t size() const;
+    /**
+     * @brief Get the compression.
+     *
+     * @return double The compression.
+     */
+    double compression() const;
+    /**
+     * @brief Get the minimum of the values.
+     *
+     * @return double The exact minimum.
+     * @throw std::runtime_error If the digest is empty.
+     */
+    double min() const;
+    /**
+     * @brief Get the maximum of the values.
+     *
+     * @return double The exact maximum.
+     * @throw std::runtime_error If the digest is empty.
+     */
+    double max() const;
+    /**
+     * @brief Approximate a quantile of the values.
+     *
+     * @param q The quantile, between 0 and 1.
+     * @return double The quantile, interpolated between the centroids.
+     * @throw std::invalid_argument If the quantile is not between 0 and 1.
+     * @throw std::runtime_error If the digest is empty.
+     *
+     * @example
+     * double p999 = df.digest("latency").quantile(0.999);
+     */
+    double quantile(const double &q) const;
+};
+
+#include "../src/CDataDigest.tpp"
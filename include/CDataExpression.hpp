@@ -0,0 +1,428 @@
+/**
+ * @file CDataExpression.hpp
+ * @brief File containing the expression templates of the 'CDataFrame' library.
+ *
+ * An arithmetic expression over columns, such as `df.col("a") * df.col("b") + df.col("c")`, builds a tree of
+ * light nodes instead of computing temporaries. The tree is evaluated element by element in a single fused loop,
+ * straight into the destination buffer.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CDataMask.hpp"
+
+/**
+ * @brief Base class of the expressions over columns.
+ *
+ * Each expression E must define the type 'value_type' and the methods 'size()', 'is_scalar()', 'operator[]' and
+ * 'and_valid()'.
+ *
+ * @tparam E The type of the expression.
+ */
+template <class E>
+class cdata_expression
+{
+public:
+    /**
+     * @brief The number of elements evaluated by a thread at once.
+     *
+     * @note Expressions smaller than two chunks are evaluated by a single thread.
+     */
+    static const size_t chunk_size = 4096;
+
+    /**
+     * @brief Get the expression.
+     *
+     * @return const E& The expression.
+     */
+    const E &self() const;
+    /**
+     * @brief Evaluate the expression in a buffer.
+     *
+     * @param dst The buffer, must contain at least n elements.
+     * @param n The number of elements to evaluate.
+     *
+     * @note The whole expression is evaluated in one fused loop, chunked between the threads for large columns.
+     */
+    template <class U>
+    void eval(U *dst, const size_t &n) const;
+    /**
+     * @brief Evaluate the expression in a vector.
+     *
+     * @return std::vector<typename V::value_type> The elements of the expression.
+     *
+     * @example
+     * std::vector<int> vec = (df.col("a") * 2).to_vector();
+     */
+    template <class V = E>
+    std::vector<typename V::value_type> to_vector() const;
+    /**
+     * @brief Compare the expression with another one, element by element.
+     *
+     * @param rhs The expression to compare.
+     * @param cmp The comparison function.
+     * @return cdata_mask The mask of the elements where the comparison is true.
+     * @throw std::invalid_argument If the expressions don't have the same size.
+     *
+     * @note The comparison is false where a column read by an expression is missing (NA).
+     */
+    template <class R, class Compare>
+    cdata_mask compare(const cdata_expression<R> &rhs, Compare cmp) const;
+};
+
+/**
+ * @brief Expression of a constant, broadcast over all the elements.
+ *
+ * @tparam T The type of the constant.
+ */
+template <class T>
+class cdata_scalar : public cdata_expression<cdata_scalar<T>>
+{
+private:
+    T m_val;
+
+public:
+    typedef T value_type;
+
+    /**
+     * @brief Construct a new constant expression.
+     *
+     * @param val The value of the constant.
+     */
+    cdata_scalar(const T &val);
+    /**
+     * @brief Get the number of elements of the expression.
+     *
+     * @return size_t Always 0, a constant takes the size of the other operand.
+     */
+    size_t size() const;
+    /**
+     * @brief Check if the expression is a constant.
+     *
+     * @return true Always.
+     */
+    bool is_scalar() const;
+    /**
+     * @brief Get the value of the constant.
+     *
+     * @return const T& The value of the constant, whatever the position.
+     */
+    const T &operator[](const size_t &) const;
+    /**
+     * @brief Clear the bits of the elements missing (NA) in the expression.
+     *
+     * @note Does nothing, a constant is never missing.
+     */
+    void and_valid(cdata_mask &) const;
+};
+
+/**
+ * @brief Expression applying a binary operation to two expressions.
+ *
+ * @tparam L The type of the left expression.
+ * @tparam R The type of the right expression.
+ * @tparam Op The type of the operation.
+ */
+template <class L, class R, class Op>
+class cdata_binary_expr : public cdata_expression<cdata_binary_expr<L, R, Op>>
+{
+private:
+    L m_lhs;
+    R m_rhs;
+
+public:
+    typedef decltype(Op()(std::declval<typename L::value_type>(), std::declval<typename R::value_type>())) value_type;
+
+    /**
+     * @brief Construct a new binary expression.
+     *
+     * @param lhs The left expression.
+     * @param rhs The right expression.
+     * @throw std::invalid_argument If the expressions don't have the same size.
+     */
+    cdata_binary_expr(const L &lhs, const R &rhs);
+    /**
+     * @brief Get the number of elements of the expression.
+     *
+     * @return size_t The number of elements.
+     */
+    size_t size() const;
+    /**
+     * @brief Check if the expression is a constant.
+     *
+     * @return true If both operands are constants.
+     * @return false Otherwise.
+     */
+    bool is_scalar() const;
+    /**
+     * @brief Evaluate the expression at the given position.
+     *
+     * @param i The position.
+     * @return value_type The result of the operation.
+     */
+    value_type operator[](const size_t &i) const;
+    /**
+     * @brief Clear the bits of the elements missing (NA) in the expression.
+     *
+     * @param mask The mask, the result is missing where one operand is.
+     */
+    void and_valid(cdata_mask &mask) const;
+};
+
+/**
+ * @brief Expression applying a unary operation to an expression.
+ *
+ * @tparam E The type of the expression.
+ * @tparam Op The type of the operation.
+ */
+template <class E, class Op>
+class cdata_unary_expr : public cdata_expression<cdata_unary_expr<E, Op>>
+{
+private:
+    E m_expr;
+
+public:
+    typedef decltype(Op()(std::declval<typename E::value_type>())) value_type;
+
+    /**
+     * @brief Construct a new unary expression.
+     *
+     * @param expr The expression.
+     */
+    cdata_unary_expr(const E &expr);
+    /**
+     * @brief Get the number of elements of the expression.
+     *
+     * @return size_t The number of elements.
+     */
+    size_t size() const;
+    /**
+     * @brief Check if the expression is a constant.
+     *
+     * @return true If the operand is a constant.
+     * @return false Otherwise.
+     */
+    bool is_scalar() const;
+    /**
+     * @brief Evaluate the expression at the given position.
+     *
+     * @param i The position.
+     * @return value_type The result of the operation.
+     */
+    value_type operator[](const size_t &i) const;
+    /**
+     * @brief Clear the bits of the elements missing (NA) in the expression.
+     *
+     * @param mask The mask, the result is missing where one operand is.
+     */
+    void and_valid(cdata_mask &mask) const;
+};
+
+// ==================================================
+// OPERATIONS
+
+/** @brief Addition of two elements. */
+struct cdata_op_add
+{
+    template <class A, class B>
+    auto operator()(const A &a, const B &b) const -> decltype(a + b) { return a + b; }
+};
+
+/** @brief Subtraction of two elements. */
+struct cdata_op_sub
+{
+    template <class A, class B>
+    auto operator()(const A &a, const B &b) const -> decltype(a - b) { return a - b; }
+};
+
+/** @brief Multiplication of two elements. */
+struct cdata_op_mul
+{
+    template <class A, class B>
+    auto operator()(const A &a, const B &b) const -> decltype(a * b) { return a * b; }
+};
+
+/** @brief Division of two elements. */
+struct cdata_op_div
+{
+    template <class A, class B>
+    auto operator()(const A &a, const B &b) const -> decltype(a / b) { return a / b; }
+};
+
+/** @brief Negation of an element. */
+struct cdata_op_neg
+{
+    template <class A>
+    auto operator()(const A &a) const -> decltype(-a) { return -a; }
+};
+
+/** @brief Equality of two elements. */
+struct cdata_op_equal
+{
+    template <class A, class B>
+    bool operator()(const A &a, const B &b) const { return a == b; }
+};
+
+/** @brief Inequality of two elements. */
+struct cdata_op_not_equal
+{
+    template <class A, class B>
+    bool operator()(const A &a, const B &b) const { return a != b; }
+};
+
+/** @brief Less than comparison of two elements. */
+struct cdata_op_less
+{
+    template <class A, class B>
+    bool operator()(const A &a, const B &b) const { return a < b; }
+};
+
+/** @brief Less than or equal comparison of two elements. */
+struct cdata_op_less_equal
+{
+    template <class A, class B>
+    bool operator()(const A &a, const B &b) const { return a <= b; }
+};
+
+/** @brief Greater than comparison of two elements. */
+struct cdata_op_greater
+{
+    template <class A, class B>
+    bool operator()(const A &a, const B &b) const { return a > b; }
+};
+
+/** @brief Greater than or equal comparison of two elements. */
+struct cdata_op_greater_equal
+{
+    template <class A, class B>
+    bool operator()(const A &a, const B &b) const { return a >= b; }
+};
+
+// ==================================================
+// ARITHMETIC OPERATORS
+
+/**
+ * @brief Add two expressions, element by element.
+ *
+ * @example
+ * df.push_col_back(df.col("a") + df.col("b"), "sum");
+ */
+template <class L, class R>
+cdata_binary_expr<L, R, cdata_op_add> operator+(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/** @brief Add a constant to each element of an expression. */
+template <class L>
+cdata_binary_expr<L, cdata_scalar<typename L::value_type>, cdata_op_add> operator+(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+/** @brief Add each element of an expression to a constant. */
+template <class R>
+cdata_binary_expr<cdata_scalar<typename R::value_type>, R, cdata_op_add> operator+(const typename R::value_type &lhs, const cdata_expression<R> &rhs);
+
+/** @brief Subtract two expressions, element by element. */
+template <class L, class R>
+cdata_binary_expr<L, R, cdata_op_sub> operator-(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/** @brief Subtract a constant from each element of an expression. */
+template <class L>
+cdata_binary_expr<L, cdata_scalar<typename L::value_type>, cdata_op_sub> operator-(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+/** @brief Subtract each element of an expression from a constant. */
+template <class R>
+cdata_binary_expr<cdata_scalar<typename R::value_type>, R, cdata_op_sub> operator-(const typename R::value_type &lhs, const cdata_expression<R> &rhs);
+
+/**
+ * @brief Multiply two expressions, element by element.
+ *
+ * @example
+ * df.push_col_back(df.col("a") * df.col("b") + df.col("c"), "fma");
+ */
+template <class L, class R>
+cdata_binary_expr<L, R, cdata_op_mul> operator*(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/** @brief Multiply each element of an expression by a constant. */
+template <class L>
+cdata_binary_expr<L, cdata_scalar<typename L::value_type>, cdata_op_mul> operator*(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+/** @brief Multiply a constant by each element of an expression. */
+template <class R>
+cdata_binary_expr<cdata_scalar<typename R::value_type>, R, cdata_op_mul> operator*(const typename R::value_type &lhs, const cdata_expression<R> &rhs);
+
+/** @brief Divide two expressions, element by element. */
+template <class L, class R>
+cdata_binary_expr<L, R, cdata_op_div> operator/(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/** @brief Divide each element of an expression by a constant. */
+template <class L>
+cdata_binary_expr<L, cdata_scalar<typename L::value_type>, cdata_op_div> operator/(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+/** @brief Divide a constant by each element of an expression. */
+template <class R>
+cdata_binary_expr<cdata_scalar<typename R::value_type>, R, cdata_op_div> operator/(const typename R::value_type &lhs, const cdata_expression<R> &rhs);
+
+/** @brief Negate each element of an expression. */
+template <class E>
+cdata_unary_expr<E, cdata_op_neg> operator-(const cdata_expression<E> &expr);
+
+// ==================================================
+// COMPARISON OPERATORS
+
+/**
+ * @brief Compare two expressions, element by element.
+ *
+ * @return cdata_mask The mask of the elements that are equal.
+ * @throw std::invalid_argument If the expressions don't have the same size.
+ */
+template <class L, class R>
+cdata_mask operator==(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/**
+ * @brief Compare each element of an expression with a constant.
+ *
+ * @return cdata_mask The mask of the elements equal to the constant.
+ * @example
+ * cdata_mask mask = df.col("price") == 10;
+ */
+template <class L>
+cdata_mask operator==(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+
+/** @brief Compare two expressions, the mask of the elements that are different. */
+template <class L, class R>
+cdata_mask operator!=(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/** @brief Compare an expression with a constant, the mask of the elements different from the constant. */
+template <class L>
+cdata_mask operator!=(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+
+/** @brief Compare two expressions, the mask of the elements where the left one is less than the right one. */
+template <class L, class R>
+cdata_mask operator<(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/** @brief Compare an expression with a constant, the mask of the elements less than the constant. */
+template <class L>
+cdata_mask operator<(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+
+/** @brief Compare two expressions, the mask of the elements where the left one is less than or equal to the right one. */
+template <class L, class R>
+cdata_mask operator<=(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/** @brief Compare an expression with a constant, the mask of the elements less than or equal to the constant. */
+template <class L>
+cdata_mask operator<=(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+
+/** @brief Compare two expressions, the mask of the elements where the left one is greater than the right one. */
+template <class L, class R>
+cdata_mask operator>(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/**
+ * @brief Compare an expression with a constant, the mask of the elements greater than the constant.
+ *
+ * @example
+ * cdata_frame<double> df2 = df.filter(df.col("price") * df.col("quantity") > 100.);
+ */
+template <class L>
+cdata_mask operator>(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+
+/** @brief Compare two expressions, the mask of the elements where the left one is greater than or equal to the right one. */
+template <class L, class R>
+cdata_mask operator>=(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs);
+/** @brief Compare an expression with a constant, the mask of the elements greater than or equal to the constant. */
+template <class L>
+cdata_mask operator>=(const cdata_expression<L> &lhs, const typename L::value_type &rhs);
+
+#include "../src/CDataExpression.tpp"
@@ -9,15 +9,49 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "../lib/CMatrix/include/CMatrix.hpp"
+#include "CDataAppender.hpp"
+#include "CDataArena.hpp"
+#include "CDataArrow.hpp"
+#include "CDataColumn.hpp"
+#include "CDataDigest.hpp"
+#include "CDataMappedFrame.hpp"
+#include "CDataMask.hpp"
+#include "CDataMemory.hpp"
+#include "CDataParse.hpp"
+#include "CDataReader.hpp"
+#include "CDataRingFrame.hpp"
+#include "CDataRolling.hpp"
+#include "CDataTrace.hpp"
+#include "CDataVersioned.hpp"
+#include "CDataZoneMap.hpp"
 
 /**
  * @brief Main template class for the 'CDataFrame' library.
@@ -30,6 +64,16 @@ class cdata_frame : public cmatrix<T>
 private:
     std::vector<std::string> m_keys = std::vector<std::string>();
     std::vector<std::string> m_index = std::vector<std::string>();
+    std::vector<cdata_mask> m_valid = std::vector<cdata_mask>();
+    std::vector<cdata_zone_map<T>> m_zones = std::vector<cdata_zone_map<T>>();
+    size_t m_zone_rows = 0;
+
+    template <class U>
+    friend class cdata_frame;
+    template <class U>
+    friend class cdata_column;
+    template <class U>
+    friend class cdata_rolling;
 
     // GETTER
     /**
@@ -52,6 +96,24 @@ private:
      * @ingroup getter
      */
     size_t __get_index_pos(const std::string &index) const;
+    /**
+     * @brief Get the validity bitmap of a column.
+     *
+     * @param pos The position of the column.
+     * @return const cdata_mask* The validity bitmap (bit set if the cell is not NA), or nullptr if the data frame has no NA.
+     *
+     * @ingroup getter
+     */
+    const cdata_mask *__get_valid(const size_t &pos) const;
+    /**
+     * @brief Get a copy of the validity bitmap of a column.
+     *
+     * @param pos The position of the column.
+     * @return cdata_mask The validity bitmap, all set if the data frame has no NA.
+     *
+     * @ingroup getter
+     */
+    cdata_mask __get_valid_mask(const size_t &pos) const;
 
     // MANIPULATION
     /**
@@ -71,90 +133,259 @@ private:
      * @ingroup manipulation
      */
     void __remove_index(const size_t &pos);
-
-    // General
     /**
-     * @brief Generate unique index.
+     * @brief Allocate the validity bitmaps, with every cell valid.
      *
-     * @param len The length of the vector to generate.
-     * @param not_in The index to not generate. Default is "".
-     * @return std::vector<std::string> The unique keys.
+     * @note Does nothing if the bitmaps are already allocated.
      *
-     * @ingroup general
+     * @ingroup manipulation
      */
-    std::vector<std::string> __generate_uids(const size_t len, const std::string &not_in = "") const;
+    void __init_valid();
     /**
-     * @brief Compute the maximum length of the stream for a vector of data.
+     * @brief Get the number of threads of a parallel call.
      *
-     * @param data The data to compute the maximum length of the stream.
-     * @param initial The initial value of the maximum length. Default is 0.
-     * @return short unsigned int The maximum length of the stream of the data.
+     * @param n_threads The number of threads requested, 0 for the OpenMP default.
+     * @return int The number of threads, 1 if OpenMP is disabled.
      *
-     * @ingroup general
+     * @ingroup manipulation
+     */
+    static int __n_threads(const unsigned int &n_threads);
+    /**
+     * @brief Call a function with each position, the positions are split statically between the threads.
+     *
+     * @param n The number of positions.
+     * @param n_threads The number of threads, 0 for the OpenMP default.
+     * @param body The function called with each position.
+     * @throw The first exception thrown by the function, once all the threads have stopped.
+     *
+     * @note An exception can't leave a parallel region: it is kept and the remaining positions are skipped.
+     * @ingroup manipulation
+     */
+    template <class Function>
+    static void __parallel_for(const size_t &n, const unsigned int &n_threads, Function body);
+    /**
+     * @brief Keep the rows of a mask, the data, the index and the validity bitmaps are compacted in one pass.
+     *
+     * @param keep The mask of the rows to keep.
+     *
+     * @note The rows are compacted in a new matrix, then copied once into the data frame since the matrix has no
+     * move assignment.
+     * @ingroup manipulation
+     */
+    void __compact_rows(const cdata_mask &keep);
+    /**
+     * @brief Keep the columns of a mask, the data, the keys and the validity bitmaps are compacted in one pass.
+     *
+     * @param keep The mask of the columns to keep.
+     *
+     * @note The columns are compacted in a new matrix, then copied once into the data frame since the matrix has no
+     * move assignment.
+     * @ingroup manipulation
+     */
+    void __compact_columns(const cdata_mask &keep);
+    /**
+     * @brief Compute the zone maps of all the columns again, if they are enabled.
+     *
+     * @param n_threads The number of threads, one column per thread. Default is 0, all the threads.
+     *
+     * @ingroup manipulation
+     */
+    void __build_zone_maps(const unsigned int &n_threads = 0);
+    /**
+     * @brief Update the zone maps after a row is inserted, only the block of the row is read.
+     *
+     * @param pos The position of the row.
+     *
+     * @ingroup manipulation
+     */
+    void __zone_insert_row(const size_t &pos);
+    /**
+     * @brief Mark the positions of labels in a mask.
+     *
+     * @param labels The labels of the data frame.
+     * @param names The labels to find.
+     * @param label The name of the labels for the error message.
+     * @return cdata_mask The mask with the bits of the labels found set.
+     * @throw std::invalid_argument If a label doesn't exist.
+     *
+     * @ingroup manipulation
+     */
+    static cdata_mask __find_labels(const std::vector<std::string> &labels, const std::vector<std::string> &names, const std::string &label);
+    /**
+     * @brief Hash a cell.
+     *
+     * @param val The cell.
+     * @return uint64_t The hash of the cell, with 'std::hash'.
+     *
+     * @ingroup manipulation
      */
     template <class U>
-    short unsigned int __stream_width(const std::vector<U> data, const int &initial = 0) const;
+    static uint64_t __hash_cell(const U &val);
     /**
-     * @brief Compute the maximum length of the stream of the data.
+     * @brief Hash a cell stored in an arena.
      *
-     * @return std::vector<short unsigned int> The maximum length of the stream of the data.
+     * @param val The cell.
+     * @return uint64_t The hash of the characters of the cell (FNV-1a), 'std::hash' has no specialization for it.
+     *
+     * @ingroup manipulation
+     */
+    static uint64_t __hash_cell(const cdata_string &val);
+    /**
+     * @brief Find the first row with the same cells as each row, over a set of columns.
+     *
+     * @param cols The positions of the columns compared.
+     * @param n_threads The number of threads, 0 for the OpenMP default.
+     * @return std::vector<size_t> The position of the first row equal to each row, the row itself if it is the first.
+     *
+     * @note The rows are hashed in parallel, then split by the high bits of their hash in partitions, each one
+     * deduplicated by a thread in an open addressing table. The missing cells (NA) are equal to each other.
+     * @ingroup manipulation
+     */
+    std::vector<size_t> __first_duplicates(const std::vector<size_t> &cols, const unsigned int &n_threads) const;
+    /**
+     * @brief Number the distinct values of a column, labelled by their text formatted by 'cdata_parse'.
+     *
+     * @param pos The position of the column.
+     * @param labels The labels found, in the order of their first row.
+     * @return std::vector<size_t> The position of the label of each row in the labels, 'std::string::npos' if the cell is missing (NA).
+     *
+     * @ingroup manipulation
+     */
+    std::vector<size_t> __label_ids(const size_t &pos, std::vector<std::string> &labels) const;
+    /**
+     * @brief Get the cell of the variable column of 'melt'.
+     *
+     * @param key The key of the variable.
+     * @param pos The position of the variable in the melted columns.
+     * @return T The key if T can be built from a string, its position otherwise.
+     *
+     * @ingroup manipulation
+     */
+    static T __melt_variable(const std::string &key, const size_t &pos, std::true_type);
+    static T __melt_variable(const std::string &key, const size_t &pos, std::false_type);
+    /**
+     * @brief Transpose the validity bitmaps.
+     *
+     * @return std::vector<cdata_mask> The bitmap of each row, empty if the data frame has no NA.
+     *
+     * @ingroup manipulation
+     */
+    std::vector<cdata_mask> __transpose_valid() const;
+    /**
+     * @brief Convert the data and the validity bitmaps in another data frame, the labels are left to the caller.
+     *
+     * @tparam U The type of the result.
+     * @param df The result.
+     * @param errors The policy if a cell can't be converted.
+     * @param fill The value of the cells that can't be converted, with the policy 'fill'.
+     * @param n_threads The number of threads, 0 for the OpenMP default.
+     * @throw std::invalid_argument If a cell can't be converted, with the policy 'raise'.
+     *
+     * @ingroup manipulation
+     */
+    template <class U>
+    void __astype(cdata_frame<U> &df, const cdata_cast_error &errors, const U &fill, const unsigned int &n_threads) const;
+    /**
+     * @brief Convert a cell, the strings are parsed and formatted by 'cdata_parse'.
+     *
+     * @tparam U The type of the result.
+     * @param val The cell.
+     * @param out The converted cell.
+     * @return true If the cell is converted.
+     * @return false If the cell can't be parsed, or is out of the range of the type.
+     *
+     * @ingroup manipulation
+     */
+    template <class U>
+    static bool __convert(const T &val, U &out);
+    template <class U>
+    static bool __convert(const T &val, U &out, std::true_type, std::true_type);
+    template <class U>
+    static bool __convert(const T &val, U &out, std::true_type, std::false_type);
+    template <class U>
+    static bool __convert(const T &val, U &out, std::false_type, std::true_type);
+    template <class U>
+    static bool __convert(const T &val, U &out, std::false_type, std::false_type);
+
+    // STATISTIC
+    /**
+     * @brief Select a quantile of a range, with a linear interpolation between the two closest ranks.
+     *
+     * @param first The first value of the range.
+     * @param last The end of the range.
+     * @param q The quantile, between 0 and 1.
+     * @return double The quantile.
+     *
+     * @note The range is partially reordered by 'std::nth_element' (introselect), in O(N) instead of a sort.
+     * @ingroup statistic
+     */
+    static double __quantile(double *first, double *last, const double &q);
+
+    // General
+    /**
+     * @brief Generate unique index.
+     *
+     * @param len The length of the vector to generate.
+     * @param not_in The index to not generate. Default is "".
+     * @return std::vector<std::string> The unique keys.
      *
      * @ingroup general
      */
-    std::vector<short unsigned int> __stream_widths_vec() const;
+    std::vector<std::string> __generate_uids(const size_t len, const std::string &not_in = "") const;
     /**
-     * @brief Print the border of the data frame.
+     * @brief Append the border of the data frame to a buffer.
      *
-     * @param widths The widths of the data frame.
+     * @param out The buffer.
+     * @param widths The widths of the columns, the index at the position 0 (0 if the data frame has no index).
      * @param left The left border of the data frame.
      * @param middle The middle border of the data frame.
      * @param right The right border of the data frame.
      * @param line The line of the data frame. Default is "─".
      * @param index The right border of the index. Default is "".
-     * @return std::string The border of the data frame.
-     *
-     * @ingroup general
-     */
-    std::string __print_border(const std::vector<short unsigned int> &widths, const std::string &left, const std::string &middle, const std::string &right, const std::string &line = "─", const std::string &index = "") const;
-    /**
-     * @brief Print the top border of the data frame.
-     *
-     * @param widths The widths of the data frame.
-     * @return std::string The top border of the data frame.
      *
      * @ingroup general
      */
-    std::string __print_border_top(const std::vector<short unsigned int> &widths) const;
+    void __print_border(std::string &out, const std::vector<size_t> &widths, const std::string &left, const std::string &middle, const std::string &right, const std::string &line = "─", const std::string &index = "") const;
     /**
-     * @brief Print the middle border of the data frame.
+     * @brief Append a row of the data frame to a buffer.
      *
-     * @param widths The widths of the data frame.
-     * @return std::string The middle border of the data frame.
+     * @param out The buffer.
+     * @param widths The widths of the columns, the index at the position 0 (0 if the data frame has no index).
+     * @param cells The cells of the row, already formatted, one per column of the widths.
+     * @param index The index of the row, empty for the header.
      *
      * @ingroup general
      */
-    std::string __print_border_middle(const std::vector<short unsigned int> &widths) const;
+    void __print_row(std::string &out, const std::vector<size_t> &widths, const std::string *cells, const std::string &index = "") const;
     /**
-     * @brief Print the bottom border of the data frame.
+     * @brief Append an element to a buffer, without stream.
      *
-     * @param widths The widths of the data frame.
-     * @return std::string The bottom border of the data frame.
+     * @param out The buffer.
+     * @param val The element.
      *
+     * @note The integers are written digit by digit and the floating point numbers with the format of std::ostream.
      * @ingroup general
      */
-    std::string __print_border_bottom(const std::vector<short unsigned int> &widths) const;
+    template <class U>
+    static void __format_cell(std::string &out, const U &val);
+    static void __format_cell(std::string &out, const std::string &val);
+    template <class U>
+    static void __format_cell(std::string &out, const U &val, std::true_type, std::false_type);
+    template <class U>
+    static void __format_cell(std::string &out, const U &val, std::false_type, std::true_type);
+    template <class U>
+    static void __format_cell(std::string &out, const U &val, std::false_type, std::false_type);
     /**
-     * @brief Print a row of the data frame.
+     * @brief Write the data frame in the Arrow IPC format.
      *
-     * @param widths The widths stream for each element of the row.
-     * @param data The data of the row.
-     * @param index The index of the row.
-     * @return std::string The row of the data frame.
+     * @param out The output stream.
+     * @param file If the file format is written, else the stream format.
+     * @throw std::invalid_argument If the type of the cells has no Arrow type.
+     * @throw std::runtime_error If the data frame can't be written.
      *
      * @ingroup general
      */
-    template <class U>
-    std::string __print_row(const std::vector<short unsigned int> &widths, const std::vector<U> &data, const std::string &index = "") const;
+    void __write_arrow(std::ostream &out, const bool &file) const;
 
     // CHECK
     /**
@@ -192,6 +423,15 @@ private:
      * @ingroup check
      */
     void __check_unique(const std::vector<std::string> &vec, const std::string &label) const;
+    /**
+     * @brief Check if a matrix has the shape of the keys and the index.
+     *
+     * @param data The matrix to check.
+     * @throw std::invalid_argument If the number of keys or index is different from the shape of the matrix.
+     *
+     * @ingroup check
+     */
+    void __check_data(const cmatrix<T> &data) const;
 
     // STATIC
     /**
@@ -234,21 +474,149 @@ private:
      * @param sep The separator of the csv file.
      * @param index If the csv file has an index.
      * @param index_name The name of the index. Default is nullptr.
+     * @param empty The flags of the empty fields, filled if not nullptr. Default is nullptr.
      * @return std::vector<std::string> The line parsed.
      *
      * @ingroup static
      */
-    static std::vector<std::string> __parse_csv_line(const std::string &line, const char &sep, const bool &index, std::string *index_name = nullptr);
+    static std::vector<std::string> __parse_csv_line(const std::string &line, const char &sep, const bool &index, std::string *index_name = nullptr, std::vector<bool> *empty = nullptr);
+    /**
+     * @brief Read a csv file in a data frame of strings.
+     *
+     * @tparam S The type of the strings of the cells.
+     * @param path The path of the csv file.
+     * @param header If the csv file has a header.
+     * @param index If the csv file has an index.
+     * @param sep The separator of the csv file.
+     * @param alloc The allocator of the strings of the cells.
+     * @return cdata_frame<S> The data frame read.
+     *
+     * @ingroup static
+     */
+    template <class S>
+    static cdata_frame<S> __read_csv(const std::string &path, const bool &header, const bool &index, const char &sep, const typename S::allocator_type &alloc);
+    /**
+     * @brief Read a csv file in a data frame of strings, the buffers of the file are read by a background thread and
+     * their lines are tokenized by parallel tasks.
+     *
+     * @param path The path of the csv file.
+     * @param header If the csv file has a header.
+     * @param index If the csv file has an index.
+     * @param sep The separator of the csv file.
+     * @param n_threads The number of threads tokenizing the lines.
+     * @return cdata_frame<std::string> The data frame read.
+     *
+     * @ingroup static
+     */
+    static cdata_frame<std::string> __read_csv_async(const std::string &path, const bool &header, const bool &index, const char &sep, const unsigned int &n_threads);
+    /**
+     * @brief Build a data frame from the tokenized lines of a csv file.
+     *
+     * @tparam S The type of the strings of the cells.
+     * @tparam Function The type of the source of the lines.
+     * @param next The source, called with the tokens, the index and the empty fields of the next line, returns false
+     * after the last line.
+     * @param header If the csv file has a header.
+     * @param index If the csv file has an index.
+     * @param alloc The allocator of the strings of the cells.
+     * @return cdata_frame<S> The data frame built.
+     *
+     * @ingroup static
+     */
+    template <class S, class Function>
+    static cdata_frame<S> __build_csv(Function next, const bool &header, const bool &index, const typename S::allocator_type &alloc);
+    /**
+     * @brief Read a data frame from the bytes of an Arrow IPC stream or file.
+     *
+     * @param bytes The bytes.
+     * @return cdata_frame<T> The data frame read.
+     *
+     * @ingroup static
+     */
+    static cdata_frame<T> __from_arrow(const std::string &bytes);
+    /**
+     * @brief Read an Arrow column with the type of its values, then convert them.
+     *
+     * @tparam U The type of the result.
+     * @tparam Function The type of the setter of a value.
+     * @tparam Missing The type of the setter of a null value.
+     * @param col The column.
+     * @param set The setter, called with the position and the converted value.
+     * @param missing The setter, called with the position of a null value.
+     *
+     * @ingroup static
+     */
+    template <class U, class Function, class Missing>
+    static void __read_arrow_column(const cdata_arrow_column &col, Function set, Missing missing);
+    template <class S, class U, class Function, class Missing>
+    static void __read_arrow_values(const cdata_arrow_column &col, Function set, Missing missing);
+    /**
+     * @brief Check if a number holds in the range of a type, before it is cast.
+     *
+     * @tparam U The type of the result.
+     * @tparam S The type of the number.
+     * @param val The number.
+     * @return true If the number is in the range of the type, or the types are not numbers.
+     *
+     * @note NaN is out of the range of an integer type, it is kept by a floating point type.
+     * @ingroup static
+     */
+    template <class U, class S>
+    static bool __is_in_range(const S &val);
+    template <class U, class S, class Integral>
+    static bool __is_in_range(const S &val, std::false_type, Integral);
+    template <class U, class S>
+    static bool __is_in_range(const S &val, std::true_type, std::true_type);
+    template <class U, class S>
+    static bool __is_in_range(const S &val, std::true_type, std::false_type);
+    template <class U, class S>
+    static bool __is_in_float_range(const S &val, std::false_type);
+    template <class U, class S>
+    static bool __is_in_float_range(const S &val, std::true_type);
+    /**
+     * @brief Convert a token to a cell.
+     *
+     * @param token The token, moved if the cell is a std::string.
+     * @param alloc The allocator of the cell.
+     * @return The cell.
+     *
+     * @ingroup static
+     */
+    static std::string __make_cell(std::string &token, const std::allocator<char> &alloc);
+    static cdata_string __make_cell(const std::string &token, const cdata_arena_allocator<char> &alloc);
     /**
-     * @brief Count the number of characters of a input.
+     * @brief Count the number of characters of a string.
      *
-     * @param input The input to count the number of characters.
-     * @return short unsigned int The number of characters of the input.
+     * @param input The string, encoded in UTF-8.
+     * @return size_t The number of characters of the string.
      *
      * @ingroup static
      */
+    static size_t __count_characters(const std::string &input);
+    /**
+     * @brief Get the number of bytes allocated on the heap by an element.
+     *
+     * @param val The element.
+     * @param slack The number of bytes allocated but not used, incremented.
+     * @return size_t The number of bytes of the heap buffer of a string, 0 for the other types.
+     *
+     * @ingroup general
+     */
     template <class U>
-    static short unsigned int __count_characters(const U &input);
+    static size_t __heap_size(const U &val, size_t &slack);
+    template <class C, class Traits, class Alloc>
+    static size_t __heap_size(const std::basic_string<C, Traits, Alloc> &val, size_t &slack);
+    /**
+     * @brief Get the number of bytes of a vector of labels.
+     *
+     * @param labels The labels.
+     * @param deep If the heap buffers of the labels are counted.
+     * @param slack The number of bytes allocated but not used, incremented.
+     * @return size_t The number of bytes of the labels.
+     *
+     * @ingroup general
+     */
+    static size_t __labels_size(const std::vector<std::string> &labels, const bool &deep, size_t &slack);
 
 public:
     // CONSTRUCTOR
@@ -459,6 +827,96 @@ public:
      * df.slice_rows(0, 1);
      */
     cdata_frame<T> slice_columns(const size_t &start, const size_t &end) const;
+    /**
+     * @brief Get a view over the column corresponding to the given key.
+     *
+     * @param key The key of the column.
+     * @return cdata_column<T> The view over the column.
+     * @throw std::invalid_argument If the key doesn't exist.
+     *
+     * @note The view doesn't copy the data and must not outlive the data frame.
+     * @ingroup getter
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}}));
+     * cdata_mask mask = df.col("key1") > 2;
+     */
+    cdata_column<T> col(const std::string &key) const;
+    /**
+     * @brief Get a view over the column at the given position.
+     *
+     * @param pos The position of the column.
+     * @return cdata_column<T> The view over the column.
+     * @throw std::out_of_range If the position is out of range.
+     *
+     * @note The view doesn't copy the data and must not outlive the data frame.
+     * @ingroup getter
+     */
+    cdata_column<T> col(const size_t &pos) const;
+    /**
+     * @brief Get a cell of the data frame.
+     *
+     * @param row The position of the row.
+     * @param col The position of the column.
+     * @return T& The cell.
+     * @throw std::out_of_range If the position is out of range.
+     *
+     * @note With zone maps, the block of the cell is counted as modified, its bounds are not used until the zone maps
+     * are computed again.
+     * @ingroup getter
+     */
+    T &cell(const size_t &row, const size_t &col);
+    const T &cell(const size_t &row, const size_t &col) const;
+    /**
+     * @brief Get the zone maps of a column.
+     *
+     * @param key The key of the column.
+     * @return const cdata_zone_map<T>& The zone maps.
+     * @throw std::invalid_argument If the key doesn't exist.
+     * @throw std::runtime_error If the zone maps are not enabled.
+     *
+     * @note The bounds don't follow the writes through the methods of 'cmatrix' other than 'cell', call
+     * 'build_zone_maps' again after them.
+     * @ingroup getter
+     * @example
+     * df.build_zone_maps();
+     * size_t n_blocks = df.zone_map("timestamp").n_blocks();
+     */
+    const cdata_zone_map<T> &zone_map(const std::string &key) const;
+    /**
+     * @brief Check if a cell is missing (NA).
+     *
+     * @param row The position of the row.
+     * @param col The position of the column.
+     * @return true If the cell is NA.
+     * @return false If the cell has a value.
+     * @throw std::out_of_range If the position is out of range.
+     *
+     * @ingroup getter
+     */
+    bool is_na(const size_t &row, const size_t &col) const;
+    /**
+     * @brief Get the mask of the missing cells (NA) of a column.
+     *
+     * @param key The key of the column.
+     * @return cdata_mask The mask of the rows where the cell is NA.
+     * @throw std::invalid_argument If the key doesn't exist.
+     *
+     * @ingroup getter
+     * @example
+     * cdata_frame<std::string> df = cdata_frame<std::string>::read_csv("data.csv");
+     * cdata_frame<std::string> df2 = df.filter(df.isna("age"));
+     */
+    cdata_mask isna(const std::string &key) const;
+    /**
+     * @brief Get the mask of the non missing cells of a column.
+     *
+     * @param key The key of the column.
+     * @return cdata_mask The mask of the rows where the cell is not NA.
+     * @throw std::invalid_argument If the key doesn't exist.
+     *
+     * @ingroup getter
+     */
+    cdata_mask notna(const std::string &key) const;
 
     // SETTER
     /**
@@ -500,6 +958,31 @@ public:
      * df.set_data(cmatrix<int>({{1, 2}, {3, 4}}));
      */
     void set_data(const cmatrix<T> &data);
+    /**
+     * @brief Mark a cell as missing (NA).
+     *
+     * @param row The position of the row.
+     * @param col The position of the column.
+     * @throw std::out_of_range If the position is out of range.
+     *
+     * @note The value of the cell is kept, but is skipped by the reductions.
+     * @ingroup setter
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}}));
+     * df.set_na(0, 1);
+     */
+    void set_na(const size_t &row, const size_t &col);
+    /**
+     * @brief Mark a cell as missing (NA).
+     *
+     * @param row The position of the row.
+     * @param key The key of the column.
+     * @throw std::out_of_range If the row is out of range.
+     * @throw std::invalid_argument If the key doesn't exist.
+     *
+     * @ingroup setter
+     */
+    void set_na(const size_t &row, const std::string &key);
 
     // MANIPULATION
     /**
@@ -532,6 +1015,25 @@ public:
      * df.insert_column(0, {1, 2}, "key1");
      */
     void insert_column(const size_t &pos, const std::vector<T> &val, const std::string &key = "");
+    /**
+     * @brief Insert a column computed from an expression at the given position.
+     *
+     * @param pos The position of the column.
+     * @param expr The expression over columns to evaluate.
+     * @param key The key of the column. Default is "".
+     * @throw std::invalid_argument If the size of the expression is different from the number of rows of the data.
+     *
+     * @note The expression is evaluated in one fused loop, without a temporary per operation. The result is written to
+     * one buffer, then copied into the rows, since the data is stored by rows and the expression may read the columns
+     * moved by the insertion. A constant expression is broadcast over the rows. A cell is missing (NA) where a
+     * column read by the expression is.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"a", "b"}, cmatrix<int>({{1, 2}, {3, 4}}));
+     * df.insert_column(0, df.col("a") * df.col("b") + 1, "c");
+     */
+    template <class E>
+    void insert_column(const size_t &pos, const cdata_expression<E> &expr, const std::string &key = "");
     /**
      * @brief Concatenate two data frames.
      *
@@ -591,7 +1093,20 @@ public:
      */
     void push_col_front(const std::vector<T> &val, const std::string &key = "");
     /**
-     * @brief Push a column at the back of the data.
+     * @brief Push a column computed from an expression at the front of the data.
+     *
+     * @param expr The expression over columns to evaluate.
+     * @param key The key of the column. Default is "".
+     * @throw std::invalid_argument If the size of the expression is different from the number of rows of the data.
+     *
+     * @ingroup manipulation
+     * @example
+     * df.push_col_front(df.col("a") - df.col("b"), "diff");
+     */
+    template <class E>
+    void push_col_front(const cdata_expression<E> &expr, const std::string &key = "");
+    /**
+     * @brief Push a column at the back of the data.
      *
      * @param val The column to push.
      * @param key The key of the column. Default is "".
@@ -603,10 +1118,25 @@ public:
      * df.push_col_back({1, 2}, "key1");
      */
     void push_col_back(const std::vector<T> &val, const std::string &key = "");
+    /**
+     * @brief Push a column computed from an expression at the back of the data.
+     *
+     * @param expr The expression over columns to evaluate.
+     * @param key The key of the column. Default is "".
+     * @throw std::invalid_argument If the size of the expression is different from the number of rows of the data.
+     *
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<double> df = cdata_frame<double>({"a", "b", "c"}, cmatrix<double>({{1, 2, 3}, {4, 5, 6}}));
+     * df.push_col_back(df.col("a") * df.col("b") + df.col("c"), "d");
+     */
+    template <class E>
+    void push_col_back(const cdata_expression<E> &expr, const std::string &key = "");
     /**
      * @brief Remove a row at the given position.
      *
      * @param pos The position of the row.
+     * @throw std::out_of_range If the position is out of range.
      *
      * @ingroup manipulation
      * @example
@@ -649,6 +1179,350 @@ public:
      * df.remove_column("key1");
      */
     void remove_column(const std::string &key);
+    /**
+     * @brief Remove the rows at the given positions.
+     *
+     * @param pos The positions of the rows, in any order.
+     * @throw std::out_of_range If a position is out of range.
+     *
+     * @note The rows are marked in a bitmap, then the data, the index and the missing cells are compacted in one pass.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}, {5, 6}}));
+     * df.remove_rows({2, 0}); // {{3, 4}}
+     */
+    void remove_rows(const std::vector<size_t> &pos);
+    /**
+     * @brief Remove the rows at the given indexes.
+     *
+     * @param index The indexes of the rows, in any order.
+     * @throw std::invalid_argument If an index doesn't exist.
+     *
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>(cmatrix<int>({{1, 2}, {3, 4}}), {"index1", "index2"});
+     * df.remove_rows({"index2"});
+     */
+    void remove_rows(const std::vector<std::string> &index);
+    /**
+     * @brief Remove the columns at the given positions.
+     *
+     * @param pos The positions of the columns, in any order.
+     * @throw std::out_of_range If a position is out of range.
+     *
+     * @note The columns are marked in a bitmap, then each row is compacted in parallel.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2", "key3"}, cmatrix<int>({{1, 2, 3}, {4, 5, 6}}));
+     * df.remove_columns({0, 2}); // {{2}, {5}}
+     */
+    void remove_columns(const std::vector<size_t> &pos);
+    /**
+     * @brief Remove the columns at the given keys.
+     *
+     * @param keys The keys of the columns, in any order.
+     * @throw std::invalid_argument If a key doesn't exist.
+     *
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}}));
+     * df.remove_columns({"key1"});
+     */
+    void remove_columns(const std::vector<std::string> &keys);
+    /**
+     * @brief Select the rows of the mask.
+     *
+     * @param mask The mask of the rows to keep.
+     * @return cdata_frame<T> The data frame with the selected rows.
+     * @throw std::invalid_argument If the size of the mask is different from the number of rows of the data.
+     *
+     * @note The rows are copied in one pass, each word of the mask is written at the offset given by the prefix sum of the previous words.
+     * @note If no row is selected, the data frame returned is empty.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}}), {"index1", "index2"});
+     * cdata_frame<int> df2 = df.filter((df.col("key1") > 2) | (df.col("key2") < 2));
+     */
+    cdata_frame<T> filter(const cdata_mask &mask) const;
+    /**
+     * @brief Select the rows whose cell of a column is in a range.
+     *
+     * With zone maps, the blocks whose bounds don't intersect the range are skipped and the blocks inside the range
+     * are selected without reading their cells, so a selection on a sorted column reads only the blocks at the edges
+     * of the range.
+     *
+     * @param key The key of the column.
+     * @param lo The lower bound of the range, included.
+     * @param hi The upper bound of the range, included.
+     * @return cdata_frame<T> The data frame with the selected rows, the missing cells (NA) are never selected.
+     * @throw std::invalid_argument If the key doesn't exist.
+     *
+     * @note A block written through 'cell' is read again, but the writes through the other methods of 'cmatrix' are
+     * not tracked: call 'build_zone_maps' again after them, or the selection may miss or keep stale rows.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"time", "value"}, cmatrix<int>({{1, 5}, {2, 6}, {3, 7}}));
+     * df.build_zone_maps();
+     * cdata_frame<int> df2 = df.select_between("time", 2, 3);
+     */
+    cdata_frame<T> select_between(const std::string &key, const T &lo, const T &hi) const;
+    /**
+     * @brief Enable the zone maps: the minimum, the maximum and the number of missing cells of each block of rows of
+     * each column.
+     *
+     * The zone maps are updated by 'insert_row', 'remove_row' and 'set_na' from the block of the row, and computed
+     * again by the other modifications ('set_data', the columns, 'concatenate', ...).
+     *
+     * @param block_rows The number of rows of a block. Default is 65536.
+     * @param n_threads The number of threads, one column per thread. Default is 0, all the threads.
+     * @throw std::invalid_argument If the blocks are empty.
+     *
+     * @note The cells modified through the methods of 'cmatrix' other than 'cell' are not tracked, call this method
+     * again after.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<double> df = cdata_frame<std::string>::read_csv("data.csv").astype<double>();
+     * df.build_zone_maps(1 << 14);
+     */
+    void build_zone_maps(const size_t &block_rows = size_t(cdata_zone_map<T>::default_block_rows), const unsigned int &n_threads = 0);
+    /**
+     * @brief Disable the zone maps and free them.
+     *
+     * @ingroup manipulation
+     */
+    void drop_zone_maps();
+    /**
+     * @brief Remove the rows containing at least one missing cell (NA).
+     *
+     * @return cdata_frame<T> The data frame without the rows containing NA.
+     *
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<std::string> df = cdata_frame<std::string>::read_csv("data.csv");
+     * cdata_frame<std::string> df2 = df.dropna();
+     */
+    cdata_frame<T> dropna() const;
+    /**
+     * @brief Replace the missing cells (NA) with a value.
+     *
+     * @param val The value of the missing cells.
+     * @return cdata_frame<T> The data frame without NA.
+     *
+     * @note The zone maps of the result are rebuilt from the values filled.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<std::string> df = cdata_frame<std::string>::read_csv("data.csv");
+     * cdata_frame<std::string> df2 = df.fillna("0");
+     */
+    cdata_frame<T> fillna(const T &val) const;
+    /**
+     * @brief Apply a function to each element.
+     *
+     * @tparam Function The type of the function, called as T fn(const T &).
+     * @param fn The function.
+     * @param n_threads The number of threads, 0 for the OpenMP default. Default is 0.
+     * @return cdata_frame<T> The data frame of the results, with the same keys, index and missing cells (NA).
+     *
+     * @note The rows are split between the threads. An exception thrown by the function is rethrown once the threads have
+     * stopped.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}}));
+     * cdata_frame<int> df2 = df.map([](const int &x) { return x * x; }); // {{1, 4}, {9, 16}}
+     */
+    template <class Function>
+    cdata_frame<T> map(Function fn, const unsigned int &n_threads = 0) const;
+    /**
+     * @brief Apply a function to each column or each row, keeping the shape of the data frame.
+     *
+     * @tparam Function The type of the function, called as std::vector<T> fn(const std::vector<T> &).
+     * @param fn The function.
+     * @param axis The axis of the function. 0 for each column and 1 for each row. Default is 0.
+     * @param n_threads The number of threads, 0 for the OpenMP default. Default is 0.
+     * @return cdata_frame<T> The data frame of the results, with the same keys, index and missing cells (NA).
+     * @throw std::invalid_argument If the function changes the size of a column or a row.
+     * @throw std::invalid_argument If the axis is not 0 or 1.
+     *
+     * @note The missing cells (NA) are passed to the function with their placeholder value. An exception thrown by the
+     * function is rethrown once the threads have stopped.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}}));
+     * cdata_frame<int> df2 = df.transform([](std::vector<int> col) { std::reverse(col.begin(), col.end()); return col; });
+     */
+    template <class Function>
+    cdata_frame<T> transform(Function fn, const short unsigned int &axis = 0, const unsigned int &n_threads = 0) const;
+    /**
+     * @brief Reduce each column or each row with a function.
+     *
+     * @tparam Function The type of the function, called as R fn(const std::vector<T> &).
+     * @param fn The function.
+     * @param axis The axis of the function. 0 for each column and 1 for each row. Default is 0.
+     * @param n_threads The number of threads, 0 for the OpenMP default. Default is 0.
+     * @return std::vector<R> The result of each column or row, in the order of the data frame.
+     * @throw std::invalid_argument If the axis is not 0 or 1.
+     *
+     * @note The missing cells (NA) are passed to the function with their placeholder value. An exception thrown by the
+     * function is rethrown once the threads have stopped. R must be default constructible, the results are written in
+     * place.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}}));
+     * std::vector<size_t> sizes = df.apply([](const std::vector<int> &row) { return row.size(); }, 1, 4);
+     */
+    template <class Function, class R = typename std::result_of<Function(const std::vector<T> &)>::type>
+    std::vector<R> apply(Function fn, const short unsigned int &axis = 0, const unsigned int &n_threads = 0) const;
+    /**
+     * @brief Get the distinct values of a column.
+     *
+     * @param key The key of the column.
+     * @param n_threads The number of threads, 0 for the OpenMP default. Default is 0.
+     * @return std::vector<T> The distinct values, in the order of their first row. The missing cells (NA) are skipped.
+     * @throw std::invalid_argument If the key doesn't exist.
+     *
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}, {1, 6}}));
+     * std::vector<int> vals = df.unique("key1"); // {1, 3}
+     */
+    std::vector<T> unique(const std::string &key, const unsigned int &n_threads = 0) const;
+    /**
+     * @brief Count the occurrences of each value of a column.
+     *
+     * @param key The key of the column.
+     * @param n_threads The number of threads, 0 for the OpenMP default. Default is 0.
+     * @return std::vector<std::pair<T, size_t>> The values and their number of rows, the most frequent first
+     * (the ties in the order of their first row). The missing cells (NA) are skipped.
+     * @throw std::invalid_argument If the key doesn't exist.
+     *
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}, {1, 6}}));
+     * std::vector<std::pair<int, size_t>> counts = df.value_counts("key1"); // {{1, 2}, {3, 1}}
+     */
+    std::vector<std::pair<T, size_t>> value_counts(const std::string &key, const unsigned int &n_threads = 0) const;
+    /**
+     * @brief Remove the rows equal to a previous row over a set of columns.
+     *
+     * @param keys The keys of the columns compared. Default is {}, all the columns.
+     * @param n_threads The number of threads, 0 for the OpenMP default. Default is 0.
+     * @return cdata_frame<T> The data frame with the first row of each group of duplicates.
+     * @throw std::invalid_argument If a key doesn't exist.
+     *
+     * @note The missing cells (NA) are equal to each other.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}, {1, 6}}));
+     * cdata_frame<int> df2 = df.drop_duplicates({"key1"}); // {{1, 2}, {3, 4}}
+     */
+    cdata_frame<T> drop_duplicates(const std::vector<std::string> &keys = {}, const unsigned int &n_threads = 0) const;
+    /**
+     * @brief Reshape the data frame from long to wide, without aggregation.
+     *
+     * @param index The key of the column giving the index of the result.
+     * @param columns The key of the column giving the keys of the result.
+     * @param values The key of the column giving the cells of the result.
+     * @return cdata_frame<T> The data frame with one row per label of 'index' and one column per label of 'columns',
+     * in the order of their first row. The pairs without value are missing (NA).
+     * @throw std::invalid_argument If a key doesn't exist.
+     * @throw std::invalid_argument If a pair of labels has several rows.
+     *
+     * @note The labels are the cells formatted like 'print', the rows with a missing label are skipped. The size of the
+     * result is computed first, then each row is scattered at the position of its labels, found by hashing.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"day", "city", "temp"}, cmatrix<int>({{1, 10, 20}, {1, 11, 25}, {2, 10, 22}}));
+     * cdata_frame<int> df2 = df.pivot("day", "city", "temp"); // keys {"10", "11"}, index {"1", "2"}, {{20, 25}, {22, NA}}
+     */
+    cdata_frame<T> pivot(const std::string &index, const std::string &columns, const std::string &values) const;
+    /**
+     * @brief Reshape the data frame from long to wide, aggregating the rows with the same pair of labels.
+     *
+     * @param index The key of the column giving the index of the result.
+     * @param columns The key of the column giving the keys of the result.
+     * @param values The key of the column aggregated.
+     * @param aggfunc The aggregation: "count", "sum", "mean", "min" or "max". Default is "mean".
+     * @return cdata_frame<double> The aggregation of each pair of labels, NA if the pair has no valid value.
+     * @throw std::invalid_argument If a key or the aggregation doesn't exist.
+     *
+     * @note See 'pivot' for the labels. The missing values (NA) are skipped.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"day", "city", "temp"}, cmatrix<int>({{1, 10, 20}, {1, 10, 24}, {2, 10, 22}}));
+     * cdata_frame<double> df2 = df.pivot_table("day", "city", "temp"); // {{22}, {22}}
+     */
+    cdata_frame<double> pivot_table(const std::string &index, const std::string &columns, const std::string &values, const std::string &aggfunc = "mean") const;
+    /**
+     * @brief Reshape the data frame from wide to long: one row per row and per melted column.
+     *
+     * @param id_keys The keys of the columns kept as identifiers.
+     * @param value_keys The keys of the columns melted. Default is {}, all the other columns.
+     * @param var_name The key of the column of the variables. Default is "variable".
+     * @param value_name The key of the column of the values. Default is "value".
+     * @return cdata_frame<T> The data frame with the identifiers, the variable and the value, grouped by variable.
+     * @throw std::invalid_argument If a key doesn't exist.
+     *
+     * @note The variable is the key of the melted column if T can be built from a string, its position in the melted
+     * columns otherwise. The result has no index and is allocated once.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<std::string> df = cdata_frame<std::string>({"id", "a", "b"}, cmatrix<std::string>({{"x", "1", "2"}}));
+     * cdata_frame<std::string> df2 = df.melt({"id"}); // {{"x", "a", "1"}, {"x", "b", "2"}}
+     */
+    cdata_frame<T> melt(const std::vector<std::string> &id_keys, const std::vector<std::string> &value_keys = {}, const std::string &var_name = "variable", const std::string &value_name = "value") const;
+    /**
+     * @brief Transpose the data frame: the rows become the columns, the keys become the index and the index the keys.
+     *
+     * @param n_threads The number of threads, 0 for the OpenMP default. Default is 0.
+     * @return cdata_frame<T> The transposed data frame.
+     *
+     * @note The data is copied by square tiles, so the reads and the writes both stay in the cache. The tiles are copied in parallel.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}, {5, 6}}), {"a", "b", "c"});
+     * cdata_frame<int> df2 = df.transpose(); // keys {"a", "b", "c"}, index {"key1", "key2"}, {{1, 3, 5}, {2, 4, 6}}
+     */
+    cdata_frame<T> transpose(const unsigned int &n_threads = 0) const;
+    /**
+     * @brief Transpose a square data frame without copying it.
+     *
+     * @param n_threads The number of threads, 0 for the OpenMP default. Default is 0.
+     * @throw std::invalid_argument If the data frame is not square.
+     *
+     * @note The tiles above the diagonal are swapped with the tiles below it, in parallel.
+     * @ingroup manipulation
+     */
+    void transpose_inplace(const unsigned int &n_threads = 0);
+    /**
+     * @brief Convert the cells to another type.
+     *
+     * @tparam U The type of the result.
+     * @param errors The policy if a cell can't be converted: raise, coerce to NA or fill. Default is raise.
+     * @param fill The value of the cells that can't be converted, with the policy 'fill'. Default is U().
+     * @param n_threads The number of threads, 0 for the OpenMP default. Default is 0.
+     * @return cdata_frame<U> The converted data frame, with the same keys, index and missing cells (NA).
+     * @throw std::invalid_argument If a cell can't be converted, with the policy 'raise'.
+     *
+     * @note The strings are parsed and the numbers formatted without stream and without locale (see 'cdata_parse').
+     * A number out of the range of U, or NaN converted to an integer, can't be converted. The blocks of rows of each
+     * column are converted in parallel.
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<std::string> df = cdata_frame<std::string>::read_csv("data.csv");
+     * cdata_frame<double> df2 = df.astype<double>(cdata_cast_error::coerce);
+     */
+    template <class U>
+    cdata_frame<U> astype(const cdata_cast_error &errors = cdata_cast_error::raise, const U &fill = U(), const unsigned int &n_threads = 0) const &;
+    /**
+     * @brief Convert the cells of a temporary data frame to another type, its labels are moved instead of copied.
+     *
+     * @see astype
+     * @ingroup manipulation
+     * @example
+     * cdata_frame<double> df = cdata_frame<std::string>::read_csv("data.csv").astype<double>();
+     */
+    template <class U>
+    cdata_frame<U> astype(const cdata_cast_error &errors = cdata_cast_error::raise, const U &fill = U(), const unsigned int &n_threads = 0) &&;
 
     // CHECK
     /**
@@ -669,6 +1543,118 @@ public:
      * @ingroup check
      */
     bool has_index() const;
+    /**
+     * @brief Check if the data frame has missing cells (NA).
+     *
+     * @return true If at least one cell is NA.
+     * @return false If no cell is NA.
+     *
+     * @ingroup check
+     */
+    bool has_na() const;
+    /**
+     * @brief Check if the zone maps are enabled.
+     *
+     * @return true If the zone maps are enabled.
+     *
+     * @ingroup check
+     */
+    bool has_zone_maps() const;
+
+    // STATISTIC
+    /**
+     * @brief Get a rolling window over the rows.
+     *
+     * @param window The number of rows of the window.
+     * @param min_periods The minimum number of valid elements in the window to compute a statistic. Default is 0, the size of the window.
+     * @return cdata_rolling<T> The window, the statistics are computed by its methods.
+     * @throw std::invalid_argument If the window is empty.
+     * @throw std::invalid_argument If the minimum number of periods is greater than the window.
+     *
+     * @note The statistics are updated incrementally, so each column is computed in O(N) whatever the size of the window.
+     * @ingroup statistic
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}, {5, 6}}));
+     * cdata_frame<double> df2 = df.rolling(2).sum(); // {{NA, NA}, {4, 6}, {8, 10}}
+     */
+    cdata_rolling<T> rolling(const size_t &window, const size_t &min_periods = 0) const;
+    /**
+     * @brief Get an expanding window over the rows, from the first row to the current one.
+     *
+     * @param min_periods The minimum number of valid elements in the window to compute a statistic. Default is 1.
+     * @return cdata_rolling<T> The window, the statistics are computed by its methods.
+     *
+     * @ingroup statistic
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}, {5, 6}}));
+     * cdata_frame<double> df2 = df.expanding().max(); // {{1, 2}, {3, 4}, {5, 6}}
+     */
+    cdata_rolling<T> expanding(const size_t &min_periods = 1) const;
+    /**
+     * @brief Compute the summary statistics of each column: count, mean, std, min, 25%, 50%, 75% and max.
+     *
+     * @param n_threads The number of threads. Default is 0, the OpenMP default.
+     * @return cdata_frame<double> The statistics, one row per statistic (indexed by its name) and one column per column.
+     *
+     * @note Each column is read once: the blocks of rows are reduced in parallel (Welford) and their states are merged,
+     * then the quartiles are selected in O(N). The missing cells (NA) are skipped, a statistic without enough valid
+     * elements is NA.
+     * @ingroup statistic
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}, {5, 6}}));
+     * cdata_frame<double> df2 = df.describe(); // df2.cell(1, 0) == 3 (mean of "key1")
+     */
+    cdata_frame<double> describe(const unsigned int &n_threads = 0) const;
+    /**
+     * @brief Compute the exact quantile of a column.
+     *
+     * @param q The quantile, between 0 and 1.
+     * @param key The key of the column.
+     * @return double The quantile, with a linear interpolation between the two closest ranks.
+     * @throw std::invalid_argument If the quantile is not between 0 and 1.
+     * @throw std::invalid_argument If the key doesn't exist.
+     * @throw std::runtime_error If the column has no valid element.
+     *
+     * @note The valid elements are copied in a buffer and the rank is selected in O(N) (introselect), without a sort.
+     * @ingroup statistic
+     * @example
+     * cdata_frame<int> df = cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}, {5, 6}}));
+     * double median = df.quantile(0.5, "key1"); // 3
+     */
+    double quantile(const double &q, const std::string &key) const;
+    /**
+     * @brief Compute several exact quantiles of a column, with one copy of the column.
+     *
+     * @param q The quantiles, between 0 and 1.
+     * @param key The key of the column.
+     * @return std::vector<double> The quantiles, in the order asked.
+     * @throw std::invalid_argument If a quantile is not between 0 and 1.
+     * @throw std::invalid_argument If the key doesn't exist.
+     * @throw std::runtime_error If the column has no valid element.
+     *
+     * @ingroup statistic
+     * @example
+     * std::vector<double> p = df.quantile({0.5, 0.99, 0.999}, "latency");
+     */
+    std::vector<double> quantile(const std::vector<double> &q, const std::string &key) const;
+    /**
+     * @brief Build a t-digest of a column, to approximate its quantiles in a bounded memory.
+     *
+     * @param key The key of the column.
+     * @param compression The compression of the digest. Default is 100.
+     * @param n_threads The number of threads. Default is 0, the OpenMP default.
+     * @return cdata_digest The digest of the valid elements.
+     * @throw std::invalid_argument If the key doesn't exist.
+     *
+     * @note Each thread builds the digest of its rows, then the digests are merged in the order of the threads, so a
+     * number of threads always gives the same digest. The digests of several data frames (e.g. the chunks of a file)
+     * can be merged with 'cdata_digest::merge'.
+     * @note The error grows beyond p999 (up to 35% on p9999 for 1M values), raise the compression for the far tail.
+     * @ingroup statistic
+     * @example
+     * double p999 = df.digest("latency").quantile(0.999);
+     */
+    cdata_digest digest(const std::string &key, const double &compression = double(cdata_digest::default_compression), const unsigned int &n_threads = 0) const;
 
     // STATIC
     /**
@@ -682,11 +1668,84 @@ public:
      *
      * @note If the header is enabled, the first line of the csv file will be used as keys.
      * @note If the data frame is empty, keys and index are empty.
+     * @note The empty fields are marked as missing (NA) while the lines are tokenized.
      * @ingroup general
      * @example
      * cdata_frame<std::string> df = cdata_frame<std::string>::read_csv("data.csv", true, false, ',');
      */
     static cdata_frame<std::string> read_csv(const std::string &path, const bool &header = true, const bool &index = false, const char &sep = ',');
+    /**
+     * @brief Read a csv file, the strings of the cells are allocated in an arena.
+     *
+     * @param path The path of the csv file.
+     * @param header If the csv file has a header. Default is true.
+     * @param index If the csv file has an index. Default is false.
+     * @param sep The separator of the csv file. Default is ','.
+     * @param slab_size The size of a slab of the arena in bytes. Default is 64 KiB.
+     * @return cdata_frame<cdata_string> The data frame read.
+     *
+     * @note The cells share the arena, it is freed slab by slab with the last cell allocated in it.
+     * @note The keys and the index are std::string like in any data frame.
+     * @ingroup general
+     * @example
+     * cdata_frame<cdata_string> df = cdata_frame<cdata_string>::read_csv_arena("data.csv");
+     */
+    static cdata_frame<cdata_string> read_csv_arena(const std::string &path, const bool &header = true, const bool &index = false, const char &sep = ',', const size_t &slab_size = size_t(cdata_arena::default_slab_size));
+    /**
+     * @brief Read a csv file asynchronously.
+     *
+     * A background thread reads the file in large buffers while the complete lines of the buffers already read are
+     * tokenized in parallel, so reading the disk and parsing overlap.
+     *
+     * @param path The path of the csv file.
+     * @param header If the csv file has a header. Default is true.
+     * @param index If the csv file has an index. Default is false.
+     * @param sep The separator of the csv file. Default is ','.
+     * @param n_threads The number of threads tokenizing the lines. Default is 0, all the threads.
+     * @return std::future<cdata_frame<std::string>> The data frame read, equal to the one of 'read_csv'. The errors
+     * of 'read_csv' are thrown by 'get'.
+     *
+     * @note Without 'cdata_reader' (not a POSIX platform), the task only calls 'read_csv'.
+     * @ingroup general
+     * @example
+     * std::future<cdata_frame<std::string>> future = cdata_frame<std::string>::read_csv_async("data.csv");
+     * // ...
+     * cdata_frame<std::string> df = future.get();
+     */
+    static std::future<cdata_frame<std::string>> read_csv_async(const std::string &path, const bool &header = true, const bool &index = false, const char &sep = ',', const unsigned int &n_threads = 0);
+    /**
+     * @brief Read a data frame from an Arrow IPC stream or file.
+     *
+     * The columns of any supported type are converted to the type of the data frame, like 'astype'. The column named
+     * "__index_level_0__", written by pandas and by 'to_arrow', is read as the index. The null values are read as
+     * missing cells (NA).
+     *
+     * @param in The input stream, read until its end.
+     * @return cdata_frame<T> The data frame read. If it has no row, keys and index are empty.
+     * @throw std::runtime_error If the data is not a valid Arrow stream or file, or uses dictionaries, compression or
+     * a type other than integers, floating point numbers, booleans and strings.
+     * @throw std::invalid_argument If a value can't be converted to the type of the data frame.
+     *
+     * @note The values are copied once from the buffers of the stream into the cells.
+     * @ingroup general
+     * @example
+     * std::ifstream in("data.arrows", std::ios::binary);
+     * cdata_frame<double> df = cdata_frame<double>::from_arrow(in);
+     */
+    static cdata_frame<T> from_arrow(std::istream &in);
+    /**
+     * @brief Read a data frame from an Arrow IPC file, like 'from_arrow'.
+     *
+     * @param path The path of the file, in the file or the stream format.
+     * @return cdata_frame<T> The data frame read.
+     * @throw std::invalid_argument If the file doesn't exist.
+     * @throw std::runtime_error If the data is not a valid Arrow stream or file.
+     *
+     * @ingroup general
+     * @example
+     * cdata_frame<double> df = cdata_frame<double>::read_arrow("data.arrow");
+     */
+    static cdata_frame<T> read_arrow(const std::string &path);
     /**
      * @brief Merge two data frames.
      *
@@ -708,40 +1767,121 @@ public:
      * cdata_frame<int> df3 = cdata_frame<int>::merge(df1, df2);
      */
     static cdata_frame<T> merge(const cdata_frame<T> &df1, const cdata_frame<T> &df2, const unsigned int &axis = 0);
+    /**
+     * @brief Concatenate several data frames in one.
+     *
+     * @param dfs The data frames to concatenate, in order.
+     * @param axis The axis to concatenate. 0 for rows and 1 for columns. Default is 0.
+     * @return cdata_frame<T> The data frame concatenated.
+     * @throw std::invalid_argument If the keys of the data frames are not the same (axis 0).
+     * @throw std::invalid_argument If the index of the data frames are not the same (axis 1).
+     * @throw std::invalid_argument If some data frames have an index and others don't (axis 0), or keys (axis 1).
+     * @throw std::invalid_argument If the index (axis 0) or the keys (axis 1) are not unique.
+     * @throw std::invalid_argument If the axis is not 0 or 1.
+     *
+     * @note The shape is computed first and the data is allocated once, then the data frames are copied in parallel.
+     * @note The uniqueness of the labels is checked in one pass with a hash set.
+     * @note The empty data frames are skipped.
+     * @ingroup static
+     * @example
+     * std::vector<cdata_frame<int>> parts = {df1, df2, df3};
+     * cdata_frame<int> df = cdata_frame<int>::concat(parts);
+     */
+    static cdata_frame<T> concat(const std::vector<cdata_frame<T>> &dfs, const short unsigned int &axis = 0);
 
     // GENERAL
     /**
-     * @brief Print the data frame.
+     * @brief Print the data frame in a table.
      *
      * @param true_type The type T is a primitive type.
-     * @param n The number of rows to print.
+     * @param n The number of first rows to print.
+     * @param tail The number of last rows to print.
+     * @param max_columns The maximum number of columns to print, 0 for all.
+     * @return std::string The table.
      *
+     * @note Only the rows printed are formatted, and the widths of the columns are computed from them.
      * @ingroup general
      */
-    std::string __print(std::true_type, const unsigned int &n) const;
+    std::string __print(std::true_type, const unsigned int &n, const unsigned int &tail = 0, const unsigned int &max_columns = 0) const;
     /**
      * @brief Print the data frame.
      *
      * @param false_type The type T is not a primitive type.
-     * @param n The number of rows to print.
+     * @param n The number of first rows to print.
+     * @param tail The number of last rows to print.
+     * @param max_columns Unused, every column is printed.
+     * @return std::string The data frame printed.
      *
      * @ingroup general
      */
-    std::string __print(std::false_type, const unsigned int &n) const;
+    std::string __print(std::false_type, const unsigned int &n, const unsigned int &tail = 0, const unsigned int &max_columns = 0) const;
     /**
      * @brief Print the data frame.
      *
-     * @param n The number of rows to print. Default is 5.
+     * @param n The number of first rows to print. Default is 5.
+     * @param tail The number of last rows to print. Default is 0.
+     * @param max_columns The maximum number of columns to print, 0 for all. Default is 0.
      *
+     * @note The rows and the columns not printed are replaced by '…'. The missing cells (NA) are printed as 'NA'.
+     * @note Only the rows printed are read, so the cost doesn't depend on the number of rows of the data frame.
      * @ingroup general
+     * @example
+     * cdata_frame<std::string> df = cdata_frame<std::string>::read_csv("data.csv");
+     * df.print(5, 5, 10); // The 5 first and 5 last rows, the 5 first and 5 last columns
      */
-    void print(const unsigned int &n = 5) const;
+    void print(const unsigned int &n = 5, const unsigned int &tail = 0, const unsigned int &max_columns = 0) const;
+    /**
+     * @brief Count the bytes held by the data frame.
+     *
+     * @param deep If the heap buffers of the strings (cells, keys and index) are counted. Default is false.
+     * @return cdata_memory_usage The bytes of each column, of the labels, of the bitmaps and the total.
+     *
+     * @note The cells are counted with the size of the type, the storage of the matrix is not exposed by CMatrix.
+     * @note The deep report reads every cell, the columns are counted in parallel.
+     * @ingroup general
+     * @example
+     * cdata_frame<std::string> df = cdata_frame<std::string>::read_csv("data.csv");
+     * size_t bytes = df.memory_usage(true).total;
+     */
+    cdata_memory_usage memory_usage(const bool &deep = false) const;
+    /**
+     * @brief Write the data frame in the Arrow IPC stream format, readable by pyarrow, pandas or polars.
+     *
+     * The data frame is written as a schema and a single record batch. The index is written as a first string column
+     * named "__index_level_0__" with the metadata of pandas, and the missing cells (NA) as null values.
+     *
+     * @param out The output stream, opened in binary mode.
+     * @throw std::invalid_argument If the type of the cells is not an integer, a floating point number or a string.
+     * @throw std::runtime_error If the data frame can't be written.
+     *
+     * @note Each column is gathered once in a contiguous buffer, the storage of the matrix being row-major.
+     * @ingroup general
+     * @example
+     * cdata_frame<double> df = cdata_frame<std::string>::read_csv("data.csv").astype<double>();
+     * std::ofstream out("data.arrows", std::ios::binary);
+     * df.to_arrow(out);
+     */
+    void to_arrow(std::ostream &out) const;
+    /**
+     * @brief Write the data frame in an Arrow IPC file (Feather V2), like 'to_arrow'.
+     *
+     * @param path The path of the file.
+     * @throw std::invalid_argument If the type of the cells has no Arrow type.
+     * @throw std::runtime_error If the file can't be written.
+     *
+     * @ingroup general
+     * @example
+     * df.write_arrow("data.arrow");
+     */
+    void write_arrow(const std::string &path) const;
     /**
      * @brief Show informations about the data frame.
      *
+     * @param deep If the heap buffers of the strings are counted in the memory usage. Default is false.
+     *
      * @ingroup general
      */
-    void info() const;
+    void info(const bool &deep = false) const;
     /**
      * @brief Copy the data frame.
      *
@@ -791,6 +1931,8 @@ public:
     friend std::ostream &operator<<(std::ostream &out, const cdata_frame<U> &df);
 };
 
+#include "../src/CDataAppender.tpp"
+#include "../src/CDataColumn.tpp"
 #include "../src/CDataFrameCheck.tpp"
 #include "../src/CDataFrameConstructor.tpp"
 #include "../src/CDataFrameGetter.tpp"
@@ -798,4 +1940,12 @@ public:
 #include "../src/CDataFrameOperator.tpp"
 #include "../src/CDataFrameSetter.tpp"
 #include "../src/CDataFrameStatic.tpp"
+#include "../src/CDataFrameStatistic.tpp"
+#ifdef CDATA_HAS_MAPPED_FRAME
+#include "../src/CDataMappedFrame.tpp"
+#endif
+#include "../src/CDataRingFrame.tpp"
+#include "../src/CDataRolling.tpp"
+#include "../src/CDataVersioned.tpp"
+#include "../src/CDataZoneMap.tpp"
 #include "../src/CDataFrame.tpp"
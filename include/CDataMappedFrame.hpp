@@ -0,0 +1,289 @@
+/**
+ * @file CDataMappedFrame.hpp
+ * @brief File containing the disk-backed data frame of the 'CDataFrame' library.
+ *
+ * @note The storage uses the POSIX memory mapping (mmap, madvise), the data frame is only defined on the POSIX
+ * platforms, where 'CDATA_HAS_MAPPED_FRAME' is defined.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CDATA_HAS_MAPPED_FRAME
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+template <class T>
+class cdata_frame;
+
+/**
+ * @brief Data frame stored in a scratch file, for data larger than the memory.
+ *
+ * The columns are split in chunks of rows, each chunk is a contiguous range of the file mapped in memory when it is
+ * accessed. The chunks mapped are kept in a least recently used list and unmapped when their size exceeds the
+ * budget, the kernel writes them back to the file. The scans of a column read its chunks in order and ask the kernel
+ * to read the next chunk ahead (madvise).
+ *
+ * The scratch file is removed from the directory when it is created, so it is deleted when the data frame is destroyed.
+ *
+ * @tparam T The type of the data, copied byte by byte to the file.
+ *
+ * @note The data frame has no index and no missing cells (NA). It is not thread safe.
+ * @example
+ * cdata_mapped_frame<double> df({"price", "qty"}, 1 << 16, size_t(1) << 30);
+ * df.push_row_back({9.5, 2});
+ * double total = df.sum("price");
+ */
+template <class T>
+class cdata_mapped_frame
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The cells of a mapped data frame are copied byte by byte.");
+
+private:
+    /**
+     * @brief A chunk mapped in memory and its position in the least recently used list.
+     */
+    struct cdata_chunk
+    {
+        T *data;
+        std::list<size_t>::iterator lru;
+    };
+
+    int m_fd = -1;
+    std::vector<std::string> m_keys;
+    size_t m_width;
+    size_t m_height = 0;
+    size_t m_chunk_rows;
+    size_t m_n_chunks = 0;
+    size_t m_max_resident;
+    mutable std::unordered_map<size_t, cdata_chunk> m_resident = std::unordered_map<size_t, cdata_chunk>();
+    mutable std::list<size_t> m_lru = std::list<size_t>();
+    mutable size_t m_n_maps = 0;
+
+    /**
+     * @brief Get the number of bytes of a chunk.
+     *
+     * @return size_t The number of bytes, a multiple of the page size.
+     */
+    size_t __chunk_bytes() const;
+    /**
+     * @brief Get a chunk, mapped if it is not resident.
+     *
+     * @param col The position of the column.
+     * @param chunk The position of the chunk in the column.
+     * @return T* The cells of the chunk.
+     * @throw std::runtime_error If the chunk can't be mapped.
+     */
+    T *__chunk(const size_t &col, const size_t &chunk) const;
+    /**
+     * @brief Unmap the least recently used chunks until the chunks resident fit in the budget.
+     *
+     * @param keep The number of most recently used chunks kept whatever the budget.
+     */
+    void __evict(const size_t &keep) const;
+    /**
+     * @brief Get the position of a column.
+     *
+     * @param key The key of the column.
+     * @return size_t The position of the column.
+     * @throw std::invalid_argument If the key doesn't exist.
+     */
+    size_t __get_key_pos(const std::string &key) const;
+    /**
+     * @brief Call a function with each chunk of a column, in order, reading the next chunk ahead.
+     *
+     * @param col The position of the column.
+     * @param func The function called with the cells of the chunk and their number.
+     */
+    template <class Function>
+    void __scan(const size_t &col, Function func) const;
+
+public:
+    /**
+     * @brief The default number of rows of a chunk.
+     */
+    static const size_t default_chunk_rows = 1 << 16;
+    /**
+     * @brief The default number of bytes of the chunks resident in memory.
+     */
+    static const size_t default_max_resident = size_t(1) << 30;
+
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a new empty data frame.
+     *
+     * @param keys The keys of the data frame.
+     * @param chunk_rows The number of rows of a chunk, rounded up to a whole number of pages. Default is 65536.
+     * @param max_resident The number of bytes of the chunks resident in memory. Default is 1 GiB.
+     * @param dir The directory of the scratch file. Default is "", $TMPDIR or /tmp.
+     * @throw std::invalid_argument If there is no key or the chunks are empty.
+     * @throw std::runtime_error If the scratch file can't be created.
+     */
+    cdata_mapped_frame(const std::vector<std::string> &keys, const size_t &chunk_rows = size_t(default_chunk_rows), const size_t &max_resident = size_t(default_max_resident), const std::string &dir = "");
+    /**
+     * @brief Construct a new data frame with the data of a data frame.
+     *
+     * @param df The data frame, with keys.
+     * @param chunk_rows The number of rows of a chunk. Default is 65536.
+     * @param max_resident The number of bytes of the chunks resident in memory. Default is 1 GiB.
+     * @param dir The directory of the scratch file. Default is "", $TMPDIR or /tmp.
+     */
+    cdata_mapped_frame(const cdata_frame<T> &df, const size_t &chunk_rows = size_t(default_chunk_rows), const size_t &max_resident = size_t(default_max_resident), const std::string &dir = "");
+    cdata_mapped_frame(const cdata_mapped_frame &) = delete;
+    cdata_mapped_frame &operator=(const cdata_mapped_frame &) = delete;
+    /**
+     * @brief Unmap the chunks and delete the scratch file.
+     */
+    ~cdata_mapped_frame();
+
+    // GETTER
+    /**
+     * @brief Get the number of rows.
+     *
+     * @return size_t The number of rows.
+     */
+    size_t height() const;
+    /**
+     * @brief Get the number of columns.
+     *
+     * @return size_t The number of columns.
+     */
+    size_t width() const;
+    /**
+     * @brief Check if the data frame has no row.
+     *
+     * @return true If the data frame is empty.
+     */
+    bool is_empty() const;
+    /**
+     * @brief Get the keys.
+     *
+     * @return std::vector<std::string> The keys.
+     */
+    std::vector<std::string> keys() const;
+    /**
+     * @brief Get the number of rows of a chunk.
+     *
+     * @return size_t The number of rows, rounded up to a whole number of pages.
+     */
+    size_t chunk_rows() const;
+    /**
+     * @brief Get the number of bytes of the chunks resident in memory.
+     *
+     * @return size_t The number of bytes mapped.
+     */
+    size_t resident() const;
+    /**
+     * @brief Get the number of times a chunk was mapped.
+     *
+     * @return size_t The number of mappings, a chunk evicted and accessed again is mapped again.
+     */
+    size_t n_maps() const;
+    /**
+     * @brief Get a cell.
+     *
+     * @param row The position of the row.
+     * @param col The position of the column.
+     * @return T The cell.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    T get(const size_t &row, const size_t &col) const;
+    /**
+     * @brief Get a column.
+     *
+     * @param key The key of the column.
+     * @return std::vector<T> The cells of the column, in memory.
+     * @throw std::invalid_argument If the key doesn't exist.
+     */
+    std::vector<T> columns_vec(const std::string &key) const;
+    /**
+     * @brief Get the rows between two positions, in memory.
+     *
+     * @param start The position of the first row.
+     * @param end The position of the last row, included.
+     * @return cdata_frame<T> The rows.
+     * @throw std::out_of_range If a position is out of range or the end is before the start.
+     */
+    cdata_frame<T> slice_rows(const size_t &start, const size_t &end) const;
+    /**
+     * @brief Copy the data frame in memory.
+     *
+     * @return cdata_frame<T> The data frame.
+     */
+    cdata_frame<T> to_frame() const;
+
+    // SETTER
+    /**
+     * @brief Set a cell.
+     *
+     * @param row The position of the row.
+     * @param col The position of the column.
+     * @param val The value of the cell.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    void set(const size_t &row, const size_t &col, const T &val);
+    /**
+     * @brief Append a row, the file grows by a chunk of rows when it is full.
+     *
+     * @param val The row.
+     * @throw std::invalid_argument If the row has not the width of the data frame.
+     * @throw std::runtime_error If the scratch file can't grow.
+     */
+    void push_row_back(const std::vector<T> &val);
+
+    // REDUCTION
+    /**
+     * @brief Sum a column, reading its chunks in order.
+     *
+     * @param key The key of the column.
+     * @return T The sum, T() if the data frame is empty.
+     * @throw std::invalid_argument If the key doesn't exist.
+     */
+    T sum(const std::string &key) const;
+    /**
+     * @brief Compute the mean of a column.
+     *
+     * @param key The key of the column.
+     * @return double The mean, NaN if the data frame is empty.
+     * @throw std::invalid_argument If the key doesn't exist.
+     */
+    double mean(const std::string &key) const;
+    /**
+     * @brief Get the minimum of a column.
+     *
+     * @param key The key of the column.
+     * @return T The minimum.
+     * @throw std::invalid_argument If the key doesn't exist.
+     * @throw std::runtime_error If the data frame is empty.
+     */
+    T min(const std::string &key) const;
+    /**
+     * @brief Get the maximum of a column.
+     *
+     * @param key The key of the column.
+     * @return T The maximum.
+     * @throw std::invalid_argument If the key doesn't exist.
+     * @throw std::runtime_error If the data frame is empty.
+     */
+    T max(const std::string &key) const;
+};
+
+#endif
@@ -0,0 +1,318 @@
+/**
+ * @file CDataMask.hpp
+ * @brief File containing the boolean mask class of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <class T>
+class cdata_frame;
+
+/**
+ * @brief Boolean mask over the rows of a data frame.
+ *
+ * The bits are packed in 64-bit words so that combinators and counting work a word at a time.
+ */
+class cdata_mask
+{
+private:
+    std::vector<uint64_t> m_words = std::vector<uint64_t>();
+    size_t m_size = 0;
+
+    template <class T>
+    friend class cdata_frame;
+
+    /**
+     * @brief Reset the unused bits of the last word.
+     *
+     * @note The combinators rely on the unused bits being 0.
+     */
+    void __clear_tail();
+    /**
+     * @brief Check if the mask has the same size as another one.
+     *
+     * @param mask The mask to compare.
+     * @throw std::invalid_argument If the sizes are different.
+     */
+    void __check_same_size(const cdata_mask &mask) const;
+    /**
+     * @brief Get the 64 bits starting at the given position.
+     *
+     * @param pos The position of the first bit.
+     * @return uint64_t The bits, the bits after the end of the mask are 0.
+     */
+    uint64_t __word_at(const size_t &pos) const;
+
+public:
+    /**
+     * @brief The number of bits stored in one word.
+     */
+    static const size_t word_bits = 64;
+
+    /**
+     * @brief Get the number of words needed to store the given number of bits.
+     *
+     * @param size The number of bits.
+     * @return size_t The number of words.
+     */
+    static size_t n_words(const size_t &size);
+    /**
+     * @brief Count the number of bits set in a word.
+     *
+     * @param word The word.
+     * @return size_t The number of bits set.
+     */
+    static size_t popcount(const uint64_t &word);
+    /**
+     * @brief Get the position of the lowest bit set in a word.
+     *
+     * @param word The word, must be non zero.
+     * @return size_t The position of the lowest bit set.
+     */
+    static size_t lowest_bit(const uint64_t &word);
+    /**
+     * @brief Build a mask from a predicate on the positions.
+     *
+     * @param size The number of bits.
+     * @param pred The predicate called with each position.
+     * @return cdata_mask The mask of the positions where the predicate is true.
+     *
+     * @note Each word is built by a single thread, so no bit is shared between threads.
+     * @example
+     * cdata_mask mask = cdata_mask::from_predicate(10, [](size_t i) { return i % 2 == 0; });
+     */
+    template <class Predicate>
+    static cdata_mask from_predicate(const size_t &size, Predicate pred);
+
+    // CONSTRUCTOR
+    /**
+     * @brief Construct an empty mask.
+     */
+    cdata_mask();
+    /**
+     * @brief Construct a mask of the given size.
+     *
+     * @param size The number of bits.
+     * @param val The value of every bit. Default is false.
+     *
+     * @example
+     * cdata_mask mask(3, true);
+     */
+    cdata_mask(const size_t &size, const bool &val = false);
+    /**
+     * @brief Construct a mask from a list of booleans.
+     *
+     * @param vals The values of the bits.
+     *
+     * @example
+     * cdata_mask mask({true, false, true});
+     */
+    cdata_mask(const std::initializer_list<bool> &vals);
+    /**
+     * @brief Construct a mask from a vector of booleans.
+     *
+     * @param vals The values of the bits.
+     */
+    cdata_mask(const std::vector<bool> &vals);
+
+    // GETTER
+    /**
+     * @brief Get the number of bits of the mask.
+     *
+     * @return size_t The number of bits.
+     */
+    size_t size() const;
+    /**
+     * @brief Check if the mask is empty.
+     *
+     * @return true If the mask has no bit.
+     * @return false If the mask has bits.
+     */
+    bool empty() const;
+    /**
+     * @brief Get the bit at the given position.
+     *
+     * @param pos The position of the bit.
+     * @return bool The value of the bit.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    bool get(const size_t &pos) const;
+    /**
+     * @brief Get the words storing the bits.
+     *
+     * @return const std::vector<uint64_t>& The words, bit i is stored in the word i / 64.
+     */
+    const std::vector<uint64_t> &words() const;
+    /**
+     * @brief Count the number of bits set.
+     *
+     * @return size_t The number of bits set.
+     */
+    size_t count() const;
+    /**
+     * @brief Check if all the bits are set.
+     *
+     * @return true If all the bits are set (or the mask is empty).
+     * @return false Otherwise.
+     */
+    bool all() const;
+    /**
+     * @brief Check if at least one bit is set.
+     *
+     * @return true If at least one bit is set.
+     * @return false Otherwise.
+     */
+    bool any() const;
+    /**
+     * @brief Get the positions of the bits set.
+     *
+     * @return std::vector<size_t> The positions in increasing order.
+     */
+    std::vector<size_t> positions() const;
+
+    // SETTER
+    /**
+     * @brief Set the bit at the given position.
+     *
+     * @param pos The position of the bit.
+     * @param val The value of the bit. Default is true.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    void set(const size_t &pos, const bool &val = true);
+
+    // MANIPULATION
+    /**
+     * @brief Push a bit at the back of the mask.
+     *
+     * @param val The value of the bit.
+     */
+    void push_back(const bool &val);
+    /**
+     * @brief Insert a bit at the given position.
+     *
+     * @param pos The position of the bit.
+     * @param val The value of the bit.
+     * @throw std::out_of_range If the position is greater than the size.
+     *
+     * @note The bits after the position are shifted a word at a time.
+     */
+    void insert(const size_t &pos, const bool &val);
+    /**
+     * @brief Remove the bit at the given position.
+     *
+     * @param pos The position of the bit.
+     * @throw std::out_of_range If the position is out of range.
+     *
+     * @note The bits after the position are shifted a word at a time.
+     */
+    void erase(const size_t &pos);
+    /**
+     * @brief Append the bits of another mask.
+     *
+     * @param mask The mask to append.
+     */
+    void append(const cdata_mask &mask);
+    /**
+     * @brief Get the bits between the given positions.
+     *
+     * @param start The start position (included).
+     * @param end The end position (included).
+     * @return cdata_mask The bits between the positions.
+     * @throw std::invalid_argument If the start position is greater than the end position.
+     * @throw std::out_of_range If the end position is out of range.
+     */
+    cdata_mask slice(const size_t &start, const size_t &end) const;
+
+    // OPERATOR
+    /**
+     * @brief Get the bit at the given position.
+     *
+     * @param pos The position of the bit.
+     * @return bool The value of the bit.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    bool operator[](const size_t &pos) const;
+    /**
+     * @brief The bitwise and operator.
+     *
+     * @param mask The mask to combine.
+     * @return cdata_mask The bits set in both masks.
+     * @throw std::invalid_argument If the sizes are different.
+     */
+    cdata_mask operator&(const cdata_mask &mask) const;
+    /**
+     * @brief The bitwise or operator.
+     *
+     * @param mask The mask to combine.
+     * @return cdata_mask The bits set in at least one mask.
+     * @throw std::invalid_argument If the sizes are different.
+     */
+    cdata_mask operator|(const cdata_mask &mask) const;
+    /**
+     * @brief The bitwise xor operator.
+     *
+     * @param mask The mask to combine.
+     * @return cdata_mask The bits set in exactly one mask.
+     * @throw std::invalid_argument If the sizes are different.
+     */
+    cdata_mask operator^(const cdata_mask &mask) const;
+    /**
+     * @brief The bitwise not operator.
+     *
+     * @return cdata_mask The bits not set in the mask.
+     */
+    cdata_mask operator~() const;
+    /**
+     * @brief The bitwise and assignment operator.
+     *
+     * @param mask The mask to combine.
+     * @return cdata_mask& The mask.
+     * @throw std::invalid_argument If the sizes are different.
+     */
+    cdata_mask &operator&=(const cdata_mask &mask);
+    /**
+     * @brief The bitwise or assignment operator.
+     *
+     * @param mask The mask to combine.
+     * @return cdata_mask& The mask.
+     * @throw std::invalid_argument If the sizes are different.
+     */
+    cdata_mask &operator|=(const cdata_mask &mask);
+    /**
+     * @brief The bitwise xor assignment operator.
+     *
+     * @param mask The mask to combine.
+     * @return cdata_mask& The mask.
+     * @throw std::invalid_argument If the sizes are different.
+     */
+    cdata_mask &operator^=(const cdata_mask &mask);
+    /**
+     * @brief The equality operator.
+     *
+     * @param mask The mask to compare.
+     * @return true If the masks have the same bits.
+     * @return false Otherwise.
+     */
+    bool operator==(const cdata_mask &mask) const;
+    /**
+     * @brief The inequality operator.
+     *
+     * @param mask The mask to compare.
+     * @return true If the masks have different bits.
+     * @return false Otherwise.
+     */
+    bool operator!=(const cdata_mask &mask) const;
+};
+
+#include "../src/CDataMask.tpp"
@@ -0,0 +1,46 @@
+/**
+ * @file CDataMemory.hpp
+ * @brief File containing the memory report of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Number of bytes held by a data frame, see 'cdata_frame::memory_usage'.
+ *
+ * The heap buffers of the strings are only counted by a deep report.
+ */
+struct cdata_memory_usage
+{
+    /**
+     * @brief The bytes of each column: the cells, and their heap buffers if deep.
+     */
+    std::vector<size_t> columns = std::vector<size_t>();
+    /**
+     * @brief The bytes of the index.
+     */
+    size_t index = 0;
+    /**
+     * @brief The bytes of the keys.
+     */
+    size_t keys = 0;
+    /**
+     * @brief The bytes of the validity bitmaps of the missing cells (NA).
+     */
+    size_t valid = 0;
+    /**
+     * @brief The bytes reserved but not used: the capacity of the labels, bitmaps and strings beyond their size.
+     */
+    size_t slack = 0;
+    /**
+     * @brief The bytes of the data frame, including the slack.
+     */
+    size_t total = 0;
+};
@@ -0,0 +1,115 @@
+/**
+ * @file CDataParse.hpp
+ * @brief File containing the number parsing and formatting of the 'CDataFrame' library.
+ *
+ * The numbers are read and written without stream and without locale, like 'std::from_chars' and 'std::to_chars'.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <clocale>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Check if a type is a string, whatever its allocator.
+ *
+ * @tparam S The type.
+ */
+template <class S>
+struct cdata_is_string : std::false_type
+{
+};
+
+template <class Traits, class Alloc>
+struct cdata_is_string<std::basic_string<char, Traits, Alloc>> : std::true_type
+{
+};
+
+/**
+ * @brief Policy of a conversion when a cell can't be converted, see 'cdata_frame::astype'.
+ */
+enum class cdata_cast_error
+{
+    /**
+     * @brief Throw an exception.
+     */
+    raise,
+    /**
+     * @brief Mark the cell as missing (NA).
+     */
+    coerce,
+    /**
+     * @brief Replace the cell with a default value.
+     */
+    fill
+};
+
+/**
+ * @brief Parsing and formatting of the numbers.
+ */
+struct cdata_parse
+{
+    /**
+     * @brief Parse a number, the spaces around it are skipped.
+     *
+     * @tparam U The type of the number, integral or floating point.
+     * @param first The first character.
+     * @param last The end of the characters.
+     * @param out The number, unchanged if the parsing fails.
+     * @return true If the characters are a number of the type.
+     * @return false If the characters are not a number, or if it is out of the range of the type.
+     *
+     * @note The floating point numbers whose digits and power of 10 are exact in the type (e.g. an exponent of at most
+     * 22 for a double, 10 for a float) are computed from their digits (Clinger's fast path), the others are read in the
+     * type with the classic locale. Both round once, to the nearest number of the type.
+     *
+     * @example
+     * double val;
+     * bool ok = cdata_parse::parse(str.data(), str.data() + str.size(), val);
+     */
+    template <class U>
+    static bool parse(const char *first, const char *last, U &out);
+    /**
+     * @brief Append a number to a buffer.
+     *
+     * @tparam U The type of the number, integral or floating point.
+     * @param out The buffer.
+     * @param val The number.
+     *
+     * @note The floating point numbers are written with the fewest digits (15 or 17) that read back to the same number.
+     */
+    template <class U>
+    static void format(std::string &out, const U &val);
+
+    template <class U>
+    static bool __parse(const char *first, const char *last, U &out, std::true_type);
+    template <class U>
+    static bool __parse(const char *first, const char *last, U &out, std::false_type);
+    template <class U>
+    static void __format(std::string &out, const U &val, std::true_type);
+    template <class U>
+    static void __format(std::string &out, const U &val, std::false_type);
+    /**
+     * @brief Compare the next characters with a word, ignoring the case.
+     *
+     * @param first The first character, moved after the word if it matches.
+     * @param last The end of the characters.
+     * @param word The word, in lower case.
+     * @return true If the word matches.
+     */
+    static bool __match(const char *&first, const char *last, const char *word);
+};
+
+#include "../src/CDataParse.tpp"
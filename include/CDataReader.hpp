@@ -0,0 +1,124 @@
+/**
+ * @file CDataReader.hpp
+ * @brief File containing the background file reader of the 'CDataFrame' library.
+ *
+ * @note The file is read with the POSIX functions (open, pread, posix_fadvise), the reader is only defined on the POSIX
+ * platforms, where 'CDATA_HAS_READER' is defined.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CDATA_HAS_READER
+
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @brief File read ahead by a background thread, in large buffers consumed in order.
+ *
+ * The thread fills the free buffers with 'pread' while the consumer copies the filled ones, so the disk keeps
+ * reading while the data is parsed. The buffers are aligned on pages and recycled, the memory used is bounded by
+ * the number of buffers.
+ *
+ * @note A single thread consumes the buffers.
+ * @example
+ * cdata_reader reader("data.csv");
+ * std::string text;
+ * while (reader.read(text))
+ *     consume(text);
+ */
+class cdata_reader
+{
+private:
+    /**
+     * @brief A buffer filled by the thread.
+     */
+    struct cdata_block
+    {
+        char *data;
+        size_t size;
+    };
+
+    int m_fd = -1;
+    size_t m_buffer_size;
+    std::vector<char *> m_buffers = std::vector<char *>();
+    std::vector<char *> m_free = std::vector<char *>();
+    std::deque<cdata_block> m_filled = std::deque<cdata_block>();
+    bool m_eof = false;
+    bool m_stop = false;
+    std::exception_ptr m_error = nullptr;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::thread m_thread;
+
+    /**
+     * @brief Fill the free buffers until the end of the file, run by the thread.
+     */
+    void __run();
+
+public:
+    /**
+     * @brief The default number of bytes of a buffer.
+     */
+    static const size_t default_buffer_size = 1 << 22;
+    /**
+     * @brief The default number of buffers.
+     */
+    static const size_t default_n_buffers = 4;
+
+    // CONSTRUCTOR
+    /**
+     * @brief Open a file and start reading it.
+     *
+     * @param path The path of the file.
+     * @param buffer_size The number of bytes of a buffer, rounded up to a whole number of pages. Default is 4 MiB.
+     * @param n_buffers The number of buffers, at least 2 so the reading overlaps the consumer. Default is 4.
+     * @throw std::invalid_argument If there are less than 2 buffers or they are empty.
+     * @throw std::runtime_error If the file can't be opened.
+     */
+    cdata_reader(const std::string &path, const size_t &buffer_size = size_t(default_buffer_size), const size_t &n_buffers = size_t(default_n_buffers));
+    cdata_reader(const cdata_reader &) = delete;
+    cdata_reader &operator=(const cdata_reader &) = delete;
+    /**
+     * @brief Stop the thread and close the file.
+     */
+    ~cdata_reader();
+
+    /**
+     * @brief Append the next buffer of the file to a string, waiting for it if it is not read yet.
+     *
+     * @param out The string.
+     * @return true If a buffer was appended.
+     * @return false If the end of the file is reached.
+     * @throw std::runtime_error If the file can't be read.
+     */
+    bool read(std::string &out);
+    /**
+     * @brief Get the number of bytes of a buffer.
+     *
+     * @return size_t The number of bytes.
+     */
+    size_t buffer_size() const;
+};
+
+#include "../src/CDataReader.tpp"
+
+#endif
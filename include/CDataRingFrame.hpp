@@ -0,0 +1,232 @@
+/**
+ * @file CDataRingFrame.hpp
+ * @brief File containing the ring buffer data frame of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+template <class T>
+class cdata_frame;
+
+/**
+ * @brief Data frame stored in a ring buffer of rows, for queue-like workloads.
+ *
+ * The rows are stored in a ring of power-of-two capacity and addressed from the position of the first row,
+ * so pushing or popping a row at either end is amortized O(1). Inserting or removing a row inside the frame
+ * moves the rows of the shortest side only. The slots of the removed rows are reused by the next pushes.
+ *
+ * The contiguous data frame is only built when it is requested with 'to_frame'.
+ *
+ * @tparam T The type of the data.
+ *
+ * @example
+ * cdata_ring_frame<int> ring({"key1", "key2"});
+ * ring.push_row_back({1, 2}, "index1");
+ * ring.push_row_back({3, 4}, "index2");
+ * ring.pop_row_front();
+ * cdata_frame<int> df = ring.to_frame(); // {{3, 4}}
+ */
+template <class T>
+class cdata_ring_frame
+{
+private:
+    std::vector<std::string> m_keys = std::vector<std::string>();
+    std::vector<std::vector<T>> m_rows = std::vector<std::vector<T>>();
+    std::vector<std::string> m_index = std::vector<std::string>();
+    std::unordered_set<std::string> m_labels = std::unordered_set<std::string>();
+    size_t m_head = 0;
+    size_t m_height = 0;
+    size_t m_width = 0;
+
+    /**
+     * @brief Get the slot of a row in the ring.
+     *
+     * @param pos The position of the row.
+     * @return size_t The slot of the row.
+     */
+    size_t __slot(const size_t &pos) const;
+    /**
+     * @brief Check if a position is a row of the data frame.
+     *
+     * @param pos The position of the row.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    void __check_pos(const size_t &pos) const;
+    /**
+     * @brief Check if a row has the width of the data frame, and set the width of an empty data frame without keys.
+     *
+     * @param val The row.
+     * @throw std::invalid_argument If the row has not the width of the data frame.
+     */
+    void __check_row(const std::vector<T> &val);
+    /**
+     * @brief Check if the label of a new row is unique and add it, as 'cdata_frame' the first label labels the other
+     * rows by their position.
+     *
+     * @param index The label of the row.
+     * @throw std::runtime_error If the data frame has an index with the label.
+     */
+    void __insert_label(const std::string &index);
+    /**
+     * @brief Remove the label of a row before it is removed.
+     *
+     * @param slot The slot of the row.
+     */
+    void __erase_label(const size_t &slot);
+
+public:
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a new empty data frame.
+     *
+     * @param keys The keys of the data frame, the width is given by the first row if empty. Default is empty.
+     */
+    cdata_ring_frame(const std::vector<std::string> &keys = std::vector<std::string>());
+    /**
+     * @brief Construct a new data frame with the rows of a data frame.
+     *
+     * @param df The data frame.
+     *
+     * @note The missing cells (NA) are not kept.
+     */
+    cdata_ring_frame(const cdata_frame<T> &df);
+
+    // GETTER
+    /**
+     * @brief Get the number of rows.
+     *
+     * @return size_t The number of rows.
+     */
+    size_t height() const;
+    /**
+     * @brief Get the number of columns.
+     *
+     * @return size_t The number of columns.
+     */
+    size_t width() const;
+    /**
+     * @brief Get the number of rows the ring can store without growing.
+     *
+     * @return size_t The capacity of the ring.
+     */
+    size_t capacity() const;
+    /**
+     * @brief Check if the data frame has no row.
+     *
+     * @return true If the data frame has no row.
+     * @return false If the data frame has at least one row.
+     */
+    bool is_empty() const;
+    /**
+     * @brief Get the keys.
+     *
+     * @return std::vector<std::string> The keys.
+     */
+    std::vector<std::string> keys() const;
+    /**
+     * @brief Get the index of a row.
+     *
+     * @param pos The position of the row.
+     * @return const std::string& The index, empty if the row has no index.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    const std::string &index(const size_t &pos) const;
+    /**
+     * @brief Get a row.
+     *
+     * @param pos The position of the row.
+     * @return const std::vector<T>& The row.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    const std::vector<T> &row(const size_t &pos) const;
+    /**
+     * @brief Get an element.
+     *
+     * @param row The position of the row.
+     * @param col The position of the column.
+     * @return T& The element.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    T &cell(const size_t &row, const size_t &col);
+    const T &cell(const size_t &row, const size_t &col) const;
+
+    // MANIPULATION
+    /**
+     * @brief Push a row at the back of the data frame, in amortized O(1).
+     *
+     * @param val The row.
+     * @param index The index of the row. Default is empty.
+     * @throw std::invalid_argument If the row has not the width of the data frame.
+     * @throw std::runtime_error If the index already exists.
+     */
+    void push_row_back(const std::vector<T> &val, const std::string &index = "");
+    /**
+     * @brief Push a row at the front of the data frame, in amortized O(1).
+     *
+     * @param val The row.
+     * @param index The index of the row. Default is empty.
+     * @throw std::invalid_argument If the row has not the width of the data frame.
+     * @throw std::runtime_error If the index already exists.
+     */
+    void push_row_front(const std::vector<T> &val, const std::string &index = "");
+    /**
+     * @brief Remove the first row, in O(1).
+     *
+     * @throw std::out_of_range If the data frame is empty.
+     */
+    void pop_row_front();
+    /**
+     * @brief Remove the last row, in O(1).
+     *
+     * @throw std::out_of_range If the data frame is empty.
+     */
+    void pop_row_back();
+    /**
+     * @brief Insert a row at the given position, moving the rows of the shortest side.
+     *
+     * @param pos The position of the row.
+     * @param val The row.
+     * @param index The index of the row. Default is empty.
+     * @throw std::out_of_range If the position is greater than the number of rows.
+     * @throw std::invalid_argument If the row has not the width of the data frame.
+     * @throw std::runtime_error If the index already exists.
+     */
+    void insert_row(const size_t &pos, const std::vector<T> &val, const std::string &index = "");
+    /**
+     * @brief Remove a row at the given position, moving the rows of the shortest side.
+     *
+     * @param pos The position of the row.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    void remove_row(const size_t &pos);
+    /**
+     * @brief Reserve the slots of a number of rows.
+     *
+     * @param n The number of rows.
+     *
+     * @note The capacity is rounded up to a power of two, so a full ring doubles.
+     */
+    void reserve(const size_t &n);
+    /**
+     * @brief Remove all the rows, the keys are kept.
+     */
+    void clear();
+
+    // CONVERSION
+    /**
+     * @brief Build the contiguous data frame.
+     *
+     * @return cdata_frame<T> The data frame, with the keys and the index if a row has one.
+     */
+    cdata_frame<T> to_frame() const;
+};
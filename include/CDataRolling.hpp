@@ -0,0 +1,129 @@
+/**
+ * @file CDataRolling.hpp
+ * @brief File containing the window operations of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <class T>
+class cdata_frame;
+
+/**
+ * @brief Rolling or expanding window over the rows of a data frame.
+ *
+ * Each statistic is updated incrementally when a row enters or leaves the window, so a column is computed
+ * in O(N) whatever the size of the window. The columns are computed in parallel.
+ *
+ * The window doesn't copy the data, so it must not outlive the data frame.
+ *
+ * @tparam T The type of the data.
+ */
+template <class T>
+class cdata_rolling
+{
+private:
+    const cdata_frame<T> *m_df;
+    size_t m_window;
+    size_t m_min_periods;
+
+    /**
+     * @brief Compute a statistic over the windows of each column.
+     *
+     * @tparam Accumulator The incremental statistic, see the accumulators in CDataRolling.tpp.
+     * @return cdata_frame<double> The statistic of the window ending at each row, NA if the window has not enough valid elements.
+     */
+    template <class Accumulator>
+    cdata_frame<double> __apply() const;
+
+public:
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a new window over the rows of a data frame.
+     *
+     * @param df The data frame.
+     * @param window The number of rows of the window, 0 for an expanding window.
+     * @param min_periods The minimum number of valid elements in the window to compute the statistic.
+     */
+    cdata_rolling(const cdata_frame<T> &df, const size_t &window, const size_t &min_periods);
+
+    // GETTER
+    /**
+     * @brief Get the number of rows of the window.
+     *
+     * @return size_t The number of rows, 0 for an expanding window.
+     */
+    size_t window() const;
+    /**
+     * @brief Get the minimum number of valid elements in the window to compute the statistic.
+     *
+     * @return size_t The minimum number of valid elements.
+     */
+    size_t min_periods() const;
+
+    // STATISTIC
+    /**
+     * @brief Count the valid elements of each window.
+     *
+     * @return cdata_frame<double> The number of valid elements.
+     */
+    cdata_frame<double> count() const;
+    /**
+     * @brief Sum the elements of each window.
+     *
+     * @return cdata_frame<double> The sums, computed with a compensated running sum.
+     */
+    cdata_frame<double> sum() const;
+    /**
+     * @brief Compute the mean of each window.
+     *
+     * @return cdata_frame<double> The means.
+     */
+    cdata_frame<double> mean() const;
+    /**
+     * @brief Compute the sample variance of each window.
+     *
+     * @return cdata_frame<double> The variances, NA if the window has less than 2 valid elements.
+     */
+    cdata_frame<double> var() const;
+    /**
+     * @brief Compute the sample standard deviation of each window.
+     *
+     * @return cdata_frame<double> The standard deviations, NA if the window has less than 2 valid elements.
+     */
+    cdata_frame<double> std() const;
+    /**
+     * @brief Get the minimum of each window.
+     *
+     * @return cdata_frame<double> The minimums, computed with a monotonic deque.
+     */
+    cdata_frame<double> min() const;
+    /**
+     * @brief Get the maximum of each window.
+     *
+     * @return cdata_frame<double> The maximums, computed with a monotonic deque.
+     */
+    cdata_frame<double> max() const;
+    /**
+     * @brief Compute a statistic by its name.
+     *
+     * @param func The name of the statistic: "count", "sum", "mean", "var", "std", "min" or "max".
+     * @return cdata_frame<double> The statistic of each window.
+     * @throw std::invalid_argument If the statistic doesn't exist.
+     *
+     * @example
+     * cdata_frame<double> df2 = df.rolling(10000).agg("mean");
+     */
+    cdata_frame<double> agg(const std::string &func) const;
+};
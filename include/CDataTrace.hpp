@@ -0,0 +1,231 @@
+/**
+ * @file CDataTrace.hpp
+ * @brief File containing the operation tracing of the 'CDataFrame' library.
+ *
+ * The operations of the data frame are only traced when the library is compiled with 'CDATA_TRACE' defined
+ * (e.g. 'make test TRACE=1'), otherwise the trace points are compiled out and cost nothing.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief One call of a traced operation.
+ */
+struct cdata_trace_event
+{
+    /**
+     * @brief The name of the operation.
+     */
+    const char *name = nullptr;
+    /**
+     * @brief The start of the call, in nanoseconds since the creation of the registry.
+     */
+    uint64_t start = 0;
+    /**
+     * @brief The wall time of the call, in nanoseconds.
+     */
+    uint64_t duration = 0;
+    /**
+     * @brief The number of rows touched.
+     */
+    size_t rows = 0;
+    /**
+     * @brief The number of bytes copied.
+     */
+    size_t bytes = 0;
+    /**
+     * @brief The number of buffers allocated.
+     */
+    size_t allocations = 0;
+    /**
+     * @brief The thread of the call, numbered in order of appearance.
+     */
+    size_t thread = 0;
+};
+
+/**
+ * @brief Counters of a traced operation, summed over its calls.
+ */
+struct cdata_trace_stats
+{
+    size_t calls = 0;
+    uint64_t duration = 0;
+    size_t rows = 0;
+    size_t bytes = 0;
+    size_t allocations = 0;
+};
+
+/**
+ * @brief Registry of the traced operations, shared by the whole program.
+ *
+ * The counters of each operation are always updated, the events are kept until 'max_events' is reached
+ * so a long run doesn't grow without limit.
+ *
+ * @note The registry is thread safe.
+ */
+class cdata_trace
+{
+private:
+    std::chrono::steady_clock::time_point m_origin;
+    std::map<std::string, cdata_trace_stats> m_stats = std::map<std::string, cdata_trace_stats>();
+    std::vector<cdata_trace_event> m_events = std::vector<cdata_trace_event>();
+    std::map<std::thread::id, size_t> m_threads = std::map<std::thread::id, size_t>();
+    size_t m_max_events;
+    size_t m_dropped = 0;
+    mutable std::mutex m_mutex;
+
+    cdata_trace();
+
+    /**
+     * @brief Escape a string for JSON.
+     *
+     * @param str The string.
+     * @return std::string The escaped string.
+     */
+    static std::string __escape_json(const std::string &str);
+
+public:
+    /**
+     * @brief The default maximum number of events kept.
+     */
+    static const size_t default_max_events = 1 << 20;
+
+    cdata_trace(const cdata_trace &) = delete;
+    cdata_trace &operator=(const cdata_trace &) = delete;
+
+    /**
+     * @brief Get the registry.
+     *
+     * @return cdata_trace& The registry.
+     */
+    static cdata_trace &instance();
+
+    // RECORD
+    /**
+     * @brief Get the time elapsed since the creation of the registry.
+     *
+     * @return uint64_t The time in nanoseconds.
+     */
+    uint64_t now() const;
+    /**
+     * @brief Record a call of an operation.
+     *
+     * @param event The call. The thread is set by the registry.
+     */
+    void record(cdata_trace_event event);
+    /**
+     * @brief Remove the events and reset the counters.
+     */
+    void clear();
+    /**
+     * @brief Set the maximum number of events kept, the counters are updated anyway.
+     *
+     * @param max_events The maximum number of events.
+     */
+    void set_max_events(const size_t &max_events);
+
+    // QUERY
+    /**
+     * @brief Get the counters of an operation.
+     *
+     * @param name The name of the operation.
+     * @return cdata_trace_stats The counters, all 0 if the operation was never called.
+     */
+    cdata_trace_stats stats(const std::string &name) const;
+    /**
+     * @brief Get the counters of all the operations.
+     *
+     * @return std::map<std::string, cdata_trace_stats> The counters by name of operation.
+     */
+    std::map<std::string, cdata_trace_stats> stats() const;
+    /**
+     * @brief Get the events kept.
+     *
+     * @return std::vector<cdata_trace_event> The events, in order of completion.
+     */
+    std::vector<cdata_trace_event> events() const;
+    /**
+     * @brief Get the number of events not kept because the limit was reached.
+     *
+     * @return size_t The number of events dropped.
+     */
+    size_t dropped() const;
+
+    // EXPORT
+    /**
+     * @brief Write the events in the Chrome trace event format, readable by 'chrome://tracing' or Perfetto.
+     *
+     * @param out The output stream.
+     */
+    void write_chrome_trace(std::ostream &out) const;
+    /**
+     * @brief Write the events in a file in the Chrome trace event format.
+     *
+     * @param path The path of the file.
+     * @throw std::invalid_argument If the file can't be opened.
+     *
+     * @example
+     * cdata_trace::instance().write_chrome_trace("trace.json");
+     */
+    void write_chrome_trace(const std::string &path) const;
+};
+
+/**
+ * @brief Trace the call of an operation from its construction to its destruction.
+ */
+class cdata_trace_scope
+{
+private:
+    cdata_trace_event m_event;
+
+public:
+    /**
+     * @brief Start the trace of a call.
+     *
+     * @param name The name of the operation, must be a string literal.
+     */
+    explicit cdata_trace_scope(const char *name);
+    cdata_trace_scope(const cdata_trace_scope &) = delete;
+    cdata_trace_scope &operator=(const cdata_trace_scope &) = delete;
+    /**
+     * @brief Record the call in the registry.
+     */
+    ~cdata_trace_scope();
+
+    /**
+     * @brief Add to the counters of the call.
+     *
+     * @param rows The number of rows touched.
+     * @param bytes The number of bytes copied.
+     * @param allocations The number of buffers allocated.
+     */
+    void add(const size_t &rows, const size_t &bytes, const size_t &allocations);
+};
+
+#ifdef CDATA_TRACE
+/** @brief Trace the enclosing scope under the given name. */
+#define CDATA_TRACE_SCOPE(name) cdata_trace_scope __cdata_trace_scope(name)
+/** @brief Add to the counters of the scope traced by 'CDATA_TRACE_SCOPE'. */
+#define CDATA_TRACE_COUNT(rows, bytes, allocations) __cdata_trace_scope.add(rows, bytes, allocations)
+#else
+#define CDATA_TRACE_SCOPE(name) ((void)0)
+#define CDATA_TRACE_COUNT(rows, bytes, allocations) ((void)0)
+#endif
+
+#include "../src/CDataTrace.tpp"
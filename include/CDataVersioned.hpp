@@ -0,0 +1,330 @@
+/**
+ * @file CDataVersioned.hpp
+ * @brief File containing the versioned data frame and its snapshots of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+template <class T>
+class cdata_frame;
+
+/**
+ * @brief A version of a data frame, never modified once it is published.
+ *
+ * The rows are split in chunks, the same for all the columns. A chunk of a column is shared by all the versions in
+ * which it is unchanged.
+ *
+ * @tparam T The type of the data.
+ */
+template <class T>
+struct cdata_version
+{
+    /**
+     * @brief The number of the version, 0 for the first one.
+     */
+    size_t version = 0;
+    /**
+     * @brief The number of columns.
+     */
+    size_t width = 0;
+    /**
+     * @brief The keys of the columns, empty if the data frame has no key.
+     */
+    std::vector<std::string> keys = std::vector<std::string>();
+    /**
+     * @brief The position of the first row of each chunk, followed by the number of rows.
+     */
+    std::vector<size_t> offsets = std::vector<size_t>(1, 0);
+    /**
+     * @brief The chunks of each column.
+     */
+    std::vector<std::vector<std::shared_ptr<const std::vector<T>>>> columns = std::vector<std::vector<std::shared_ptr<const std::vector<T>>>>();
+    /**
+     * @brief The chunks of the labels of the rows, an empty label for a row without index.
+     */
+    std::vector<std::shared_ptr<const std::vector<std::string>>> index = std::vector<std::shared_ptr<const std::vector<std::string>>>();
+};
+
+/**
+ * @brief Immutable and cheap reference to a version of a data frame.
+ *
+ * A snapshot is a shared pointer to its version: copying it doesn't copy the data, and it stays valid and unchanged
+ * while the data frame is modified.
+ *
+ * @tparam T The type of the data.
+ *
+ * @note The missing cells (NA) are not supported.
+ */
+template <class T>
+class cdata_snapshot
+{
+private:
+    std::shared_ptr<const cdata_version<T>> m_version;
+
+    /**
+     * @brief Get the chunk of a row.
+     *
+     * @param pos The position of the row.
+     * @return size_t The position of the chunk.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    size_t __find(const size_t &pos) const;
+
+public:
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a snapshot of a version.
+     *
+     * @param version The version.
+     */
+    cdata_snapshot(const std::shared_ptr<const cdata_version<T>> &version);
+
+    // GETTER
+    /**
+     * @brief Get the number of the version.
+     *
+     * @return size_t The number of the version, incremented by each modification.
+     */
+    size_t version() const;
+    /**
+     * @brief Get the number of rows.
+     *
+     * @return size_t The number of rows.
+     */
+    size_t height() const;
+    /**
+     * @brief Get the number of columns.
+     *
+     * @return size_t The number of columns.
+     */
+    size_t width() const;
+    /**
+     * @brief Check if the snapshot has no row.
+     *
+     * @return true If the snapshot is empty.
+     */
+    bool is_empty() const;
+    /**
+     * @brief Get the keys.
+     *
+     * @return std::vector<std::string> The keys.
+     */
+    std::vector<std::string> keys() const;
+    /**
+     * @brief Get the index of a row.
+     *
+     * @param pos The position of the row.
+     * @return const std::string& The index, empty if the row has no index.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    const std::string &index(const size_t &pos) const;
+    /**
+     * @brief Get an element.
+     *
+     * @param row The position of the row.
+     * @param col The position of the column.
+     * @return const T& The element.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    const T &get(const size_t &row, const size_t &col) const;
+    /**
+     * @brief Get a row.
+     *
+     * @param pos The position of the row.
+     * @return std::vector<T> The row.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    std::vector<T> rows_vec(const size_t &pos) const;
+    /**
+     * @brief Get a column.
+     *
+     * @param key The key of the column.
+     * @return std::vector<T> The column.
+     * @throw std::invalid_argument If the key doesn't exist.
+     */
+    std::vector<T> columns_vec(const std::string &key) const;
+    /**
+     * @brief Count the chunks of columns shared with another snapshot.
+     *
+     * @param other The other snapshot.
+     * @return size_t The number of chunks stored once for both snapshots.
+     */
+    size_t n_shared(const cdata_snapshot<T> &other) const;
+    /**
+     * @brief Copy the snapshot in a data frame.
+     *
+     * @return cdata_frame<T> The data frame, with an index if a row has a label.
+     */
+    cdata_frame<T> to_frame() const;
+};
+
+/**
+ * @brief Data frame modified by a writer while readers take consistent snapshots.
+ *
+ * Each modification builds a new version that copies only the chunks it changes, the other chunks are shared with
+ * the previous version. The new version is then published by swapping a shared pointer atomically, so the readers
+ * never wait for a modification and never see a version partially written. The old versions are freed when their
+ * last snapshot is released.
+ *
+ * @tparam T The type of the data.
+ *
+ * @note The writers are serialized by a lock, the readers take no lock.
+ * @example
+ * cdata_versioned<int> df(cdata_frame<int>({"key1", "key2"}, cmatrix<int>({{1, 2}, {3, 4}})));
+ * cdata_snapshot<int> before = df.snapshot();
+ * df.set(0, 1, 5);
+ * int old = before.get(0, 1); // 2
+ */
+template <class T>
+class cdata_versioned
+{
+private:
+    std::shared_ptr<const cdata_version<T>> m_current;
+    std::mutex m_write;
+    std::unordered_set<std::string> m_labels = std::unordered_set<std::string>();
+    size_t m_chunk_rows;
+
+    /**
+     * @brief Build a version from a data frame.
+     *
+     * @param df The data frame.
+     * @param version The number of the version.
+     */
+    void __load(const cdata_frame<T> &df, const size_t &version);
+    /**
+     * @brief Insert a row, the writer lock is held.
+     *
+     * @param pos The position of the row.
+     * @param val The row.
+     * @param index The index of the row.
+     */
+    void __insert_row(const size_t &pos, const std::vector<T> &val, const std::string &index);
+    /**
+     * @brief Copy the current version to modify it.
+     *
+     * @return std::shared_ptr<cdata_version<T>> The new version, sharing all the chunks.
+     */
+    std::shared_ptr<cdata_version<T>> __next() const;
+    /**
+     * @brief Publish a new version.
+     *
+     * @param next The new version.
+     */
+    void __commit(const std::shared_ptr<cdata_version<T>> &next);
+    /**
+     * @brief Get the chunk of a row.
+     *
+     * @param version The version.
+     * @param pos The position of the row.
+     * @return size_t The position of the chunk.
+     */
+    static size_t __find(const cdata_version<T> &version, const size_t &pos);
+    /**
+     * @brief Split a chunk larger than the size of a chunk, in all the columns.
+     *
+     * @param version The version.
+     * @param pos The position of the chunk.
+     */
+    void __split(cdata_version<T> &version, const size_t &pos) const;
+
+public:
+    /**
+     * @brief The default number of rows of a chunk.
+     */
+    static const size_t default_chunk_rows = 1 << 12;
+
+    // CONSTRUCTOR
+    /**
+     * @brief Construct a versioned data frame.
+     *
+     * @param df The first version. Default is an empty data frame, its width is given by the first row.
+     * @param chunk_rows The number of rows of a chunk. Default is 4096.
+     * @throw std::invalid_argument If the chunks are empty.
+     */
+    cdata_versioned(const cdata_frame<T> &df = cdata_frame<T>(), const size_t &chunk_rows = size_t(default_chunk_rows));
+
+    // GETTER
+    /**
+     * @brief Get a snapshot of the current version.
+     *
+     * @return cdata_snapshot<T> The snapshot, unchanged by the next modifications.
+     */
+    cdata_snapshot<T> snapshot() const;
+    /**
+     * @brief Get the number of the current version.
+     *
+     * @return size_t The number of the version.
+     */
+    size_t version() const;
+
+    // SETTER
+    /**
+     * @brief Set an element, only its chunk is copied.
+     *
+     * @param row The position of the row.
+     * @param col The position of the column.
+     * @param val The value.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    void set(const size_t &row, const size_t &col, const T &val);
+    /**
+     * @brief Set a row in a single version.
+     *
+     * @param pos The position of the row.
+     * @param val The row.
+     * @throw std::out_of_range If the position is out of range.
+     * @throw std::invalid_argument If the row has not the width of the data frame.
+     */
+    void set_row(const size_t &pos, const std::vector<T> &val);
+    /**
+     * @brief Replace the data frame.
+     *
+     * @param df The data frame.
+     */
+    void set_data(const cdata_frame<T> &df);
+
+    // MANIPULATION
+    /**
+     * @brief Insert a row, only its chunk is copied.
+     *
+     * @param pos The position of the row.
+     * @param val The row.
+     * @param index The index of the row. Default is no index.
+     * @throw std::out_of_range If the position is after the last row.
+     * @throw std::invalid_argument If the row has not the width of the data frame.
+     * @throw std::runtime_error If the index already exists.
+     *
+     * @note As 'cdata_frame', the first label labels the other rows by their position, then the labels must be unique.
+     */
+    void insert_row(const size_t &pos, const std::vector<T> &val, const std::string &index = "");
+    /**
+     * @brief Insert a row after the last row.
+     *
+     * @param val The row.
+     * @param index The index of the row. Default is no index.
+     * @throw std::invalid_argument If the row has not the width of the data frame.
+     * @throw std::runtime_error If the index already exists.
+     *
+     * @note As 'cdata_frame', the first label labels the other rows by their position, then the labels must be unique.
+     */
+    void push_row_back(const std::vector<T> &val, const std::string &index = "");
+    /**
+     * @brief Remove a row, only its chunk is copied.
+     *
+     * @param pos The position of the row.
+     * @throw std::out_of_range If the position is out of range.
+     */
+    void remove_row(const size_t &pos);
+};
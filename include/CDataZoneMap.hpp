@@ -0,0 +1,212 @@
+/**
+ * @file CDataZoneMap.hpp
+ * @brief File containing the zone maps (statistics of the blocks of rows) of the 'CDataFrame' library.
+ *
+ * @author Manitas Bahri <https://github.com/b-manitas>
+ * @date 2023
+ * @license MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Minimum, maximum and number of missing cells of each block of rows of a column.
+ *
+ * A range selection reads only the blocks whose bounds intersect the range. The bounds are kept up to date by the
+ * insertions and stay valid, though possibly wider than the values, after a removal or a cell set as missing. A write
+ * to a cell only counts a modification of its block: the bounds of a modified block are not used until the block is
+ * computed again.
+ *
+ * The blocks have a target number of rows: a block grows with the insertions and is split in two when it reaches twice
+ * this number, so an insertion only reads the rows of its block.
+ *
+ * @tparam T The type of the data, ordered by 'operator<'.
+ *
+ * @example
+ * cdata_zone_map<int> zone(2);
+ * std::vector<int> values = {4, 1, 9, 7};
+ * zone.build(values.size(), [&](const size_t &r) -> const int & { return values[r]; }, [](const size_t &) { return true; });
+ * bool skip = not zone.may_contain(0, 5, 6); // The block {4, 1} has no value between 5 and 6
+ */
+template <class T>
+class cdata_zone_map
+{
+private:
+    size_t m_block_rows;
+    std::vector<size_t> m_offsets = std::vector<size_t>(1, 0);
+    std::vector<T> m_min = std::vector<T>();
+    std::vector<T> m_max = std::vector<T>();
+    std::vector<size_t> m_null = std::vector<size_t>();
+    std::vector<size_t> m_writes = std::vector<size_t>();
+
+    /**
+     * @brief Get the block of a row.
+     *
+     * @param pos The position of the row.
+     * @return size_t The position of the block.
+     */
+    size_t __find(const size_t &pos) const;
+    /**
+     * @brief Compute the statistics of a block from the cells.
+     *
+     * @tparam Function The type of the getter of the cells.
+     * @tparam Valid The type of the getter of the validity of the cells.
+     * @param pos The position of the block.
+     * @param cell The getter of a cell from its row.
+     * @param valid The getter of the validity of a cell from its row.
+     */
+    template <class Function, class Valid>
+    void __compute(const size_t &pos, Function cell, Valid valid);
+
+public:
+    /**
+     * @brief The default number of rows of a block.
+     */
+    static const size_t default_block_rows = 1 << 16;
+
+    // CONSTRUCTOR
+    /**
+     * @brief Construct empty zone maps.
+     *
+     * @param block_rows The number of rows of a block. Default is 65536.
+     * @throw std::invalid_argument If the blocks are empty.
+     */
+    cdata_zone_map(const size_t &block_rows = size_t(default_block_rows));
+
+    // MANIPULATION
+    /**
+     * @brief Compute the statistics of all the blocks of a column.
+     *
+     * @tparam Function The type of the getter of the cells.
+     * @tparam Valid The type of the getter of the validity of the cells.
+     * @param height The number of rows.
+     * @param cell The getter of a cell from its row.
+     * @param valid The getter of the validity of a cell from its row.
+     */
+    template <class Function, class Valid>
+    void build(const size_t &height, Function cell, Valid valid);
+    /**
+     * @brief Update the statistics after a row is inserted in the column.
+     *
+     * @tparam Function The type of the getter of the cells.
+     * @tparam Valid The type of the getter of the validity of the cells.
+     * @param pos The position of the row inserted.
+     * @param cell The getter of a cell from its row, after the insertion.
+     * @param valid The getter of the validity of a cell from its row, after the insertion.
+     *
+     * @note Only the block of the row is read, when it is split.
+     */
+    template <class Function, class Valid>
+    void insert(const size_t &pos, Function cell, Valid valid);
+    /**
+     * @brief Update the statistics before a row is removed from the column.
+     *
+     * @param pos The position of the row.
+     * @param valid If the cell of the row is not missing.
+     *
+     * @note The bounds of the block are kept, they still hold its values.
+     */
+    void erase(const size_t &pos, const bool &valid);
+    /**
+     * @brief Update the statistics after a cell is set as missing.
+     *
+     * @param pos The position of the row, its cell was not missing.
+     */
+    void set_na(const size_t &pos);
+    /**
+     * @brief Count a write to a cell, its value is unknown.
+     *
+     * @param pos The position of the row.
+     *
+     * @note The block is always read by a range selection, until it is computed again.
+     */
+    void modify(const size_t &pos);
+
+    // GETTER
+    /**
+     * @brief Get the target number of rows of a block.
+     *
+     * @return size_t The number of rows.
+     */
+    size_t block_rows() const;
+    /**
+     * @brief Get the number of blocks.
+     *
+     * @return size_t The number of blocks.
+     */
+    size_t n_blocks() const;
+    /**
+     * @brief Get the first row of a block.
+     *
+     * @param pos The position of the block.
+     * @return size_t The position of the row.
+     */
+    size_t start(const size_t &pos) const;
+    /**
+     * @brief Get the row after the last row of a block.
+     *
+     * @param pos The position of the block.
+     * @return size_t The position of the row.
+     */
+    size_t end(const size_t &pos) const;
+    /**
+     * @brief Get the lower bound of the values of a block.
+     *
+     * @param pos The position of the block.
+     * @return const T& The bound, meaningless if the block has no value.
+     */
+    const T &min(const size_t &pos) const;
+    /**
+     * @brief Get the upper bound of the values of a block.
+     *
+     * @param pos The position of the block.
+     * @return const T& The bound, meaningless if the block has no value.
+     */
+    const T &max(const size_t &pos) const;
+    /**
+     * @brief Get the number of missing cells of a block.
+     *
+     * @param pos The position of the block.
+     * @return size_t The number of missing cells.
+     */
+    size_t null_count(const size_t &pos) const;
+    /**
+     * @brief Get the number of writes to the cells of a block since its bounds were computed.
+     *
+     * @param pos The position of the block.
+     * @return size_t The number of writes, the bounds are meaningless if it is not 0.
+     */
+    size_t modifications(const size_t &pos) const;
+
+    // CHECK
+    /**
+     * @brief Check if a block has a cell not missing.
+     *
+     * @param pos The position of the block.
+     * @return true If the block has a value.
+     */
+    bool has_values(const size_t &pos) const;
+    /**
+     * @brief Check if a block may have a value in a range.
+     *
+     * @param pos The position of the block.
+     * @param lo The lower bound of the range, included.
+     * @param hi The upper bound of the range, included.
+     * @return true If the block must be read.
+     * @return false If no value of the block is in the range.
+     */
+    bool may_contain(const size_t &pos, const T &lo, const T &hi) const;
+    /**
+     * @brief Check if all the cells of a block are in a range.
+     *
+     * @param pos The position of the block.
+     * @param lo The lower bound of the range, included.
+     * @param hi The upper bound of the range, included.
+     * @return true If the block has no missing cell, was not modified and its bounds are in the range.
+     */
+    bool contains_all(const size_t &pos, const T &lo, const T &hi) const;
+};
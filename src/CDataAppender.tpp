@@ -0,0 +1,342 @@
+/**
+ * @file CDataAppender.tpp
+ * @brief File containing the implementation of the 'cdata_appender' class.
+ *
+ * @see CDataAppender.hpp
+ * @defgroup appender
+ */
+
+// ==================================================
+// CONSTRUCTOR
+
+template <class T>
+cdata_appender<T>::cdata_appender(const std::vector<std::string> &keys, const size_t &capacity, const size_t &chunk_rows)
+    : m_keys(keys), m_width(keys.size()), m_chunk_rows(chunk_rows), m_capacity(capacity), m_cursor(0), m_published(0)
+{
+    if (keys.empty())
+        throw std::invalid_argument("The appender must have at least one key.");
+
+    if (chunk_rows == 0)
+        throw std::invalid_argument("The chunks must have at least one row.");
+
+    // The table of the chunks never moves, so the producers allocate their chunks without lock
+    const size_t n_chunks = (capacity + chunk_rows - 1) / chunk_rows;
+    m_chunks.reset(new std::atomic<cdata_chunk *>[n_chunks]);
+
+    for (size_t i = 0; i < n_chunks; i++)
+        m_chunks[i].store(nullptr, std::memory_order_relaxed);
+}
+
+template <class T>
+cdata_appender<T>::~cdata_appender()
+{
+    const size_t n_chunks = (m_capacity + m_chunk_rows - 1) / m_chunk_rows;
+
+    for (size_t i = 0; i < n_chunks; i++)
+        delete m_chunks[i].load(std::memory_order_relaxed);
+}
+
+// ==================================================
+// GETTER
+
+template <class T>
+size_t cdata_appender<T>::height() const
+{
+    return m_published.load();
+}
+
+template <class T>
+size_t cdata_appender<T>::reserved() const
+{
+    return m_cursor.load();
+}
+
+template <class T>
+size_t cdata_appender<T>::width() const
+{
+    return m_width;
+}
+
+template <class T>
+size_t cdata_appender<T>::capacity() const
+{
+    return m_capacity;
+}
+
+template <class T>
+std::vector<std::string> cdata_appender<T>::keys() const
+{
+    return m_keys;
+}
+
+template <class T>
+bool cdata_appender<T>::contains(const std::string &label)
+{
+    cdata_shard &shard = m_shards[std::hash<std::string>()(label) % n_shards];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    return shard.labels.count(label) != 0;
+}
+
+template <class T>
+const T &cdata_appender<T>::get(const size_t &row, const size_t &col) const
+{
+    __check_pos(row);
+
+    if (col >= m_width)
+        throw std::out_of_range("The column " + std::to_string(col) + " is out of range.");
+
+    return m_chunks[row / m_chunk_rows].load()->cells[row % m_chunk_rows * m_width + col];
+}
+
+template <class T>
+const std::string &cdata_appender<T>::index(const size_t &pos) const
+{
+    __check_pos(pos);
+
+    return m_chunks[pos / m_chunk_rows].load()->labels[pos % m_chunk_rows];
+}
+
+template <class T>
+cdata_frame<T> cdata_appender<T>::to_frame() const
+{
+    // The rows published when the copy starts
+    const size_t height = m_published.load();
+
+    if (height == 0)
+        return cdata_frame<T>();
+
+    std::vector<std::vector<T>> data(height);
+    std::vector<std::string> index(height);
+    bool has_index = false;
+
+    for (size_t i = 0; i < height; i++)
+    {
+        const cdata_chunk *chunk = m_chunks[i / m_chunk_rows].load();
+        const size_t slot = i % m_chunk_rows;
+
+        data[i].assign(chunk->cells.begin() + slot * m_width, chunk->cells.begin() + (slot + 1) * m_width);
+        index[i] = chunk->labels[slot];
+        has_index = has_index || not index[i].empty();
+    }
+
+    // The rows without label are labelled by their position, as 'cdata_frame' does for the rows before the first label
+    if (has_index)
+    {
+        std::unordered_set<std::string> used(index.begin(), index.end());
+
+        for (size_t i = 0; i < height; i++)
+            if (index[i].empty())
+            {
+                std::string uid = std::to_string(i);
+
+                while (used.count(uid) != 0)
+                    uid = "_" + uid;
+
+                index[i] = uid;
+                used.insert(uid);
+            }
+    }
+
+    return has_index ? cdata_frame<T>(m_keys, cmatrix<T>(data), index) : cdata_frame<T>(m_keys, cmatrix<T>(data));
+}
+
+// ==================================================
+// MANIPULATION
+
+template <class T>
+size_t cdata_appender<T>::append_row(const std::vector<T> &val, const std::string &label)
+{
+    __check_row(val);
+
+    if (not __insert_label(label))
+        throw std::runtime_error("The index '" + label + "' already exists.");
+
+    size_t pos;
+
+    try
+    {
+        pos = __reserve(1);
+    }
+    catch (const std::runtime_error &)
+    {
+        __erase_label(label);
+        throw;
+    }
+
+    __write(pos, val, label);
+    __publish();
+
+    return pos;
+}
+
+template <class T>
+size_t cdata_appender<T>::append_rows(const std::vector<std::vector<T>> &val, const std::vector<std::string> &labels)
+{
+    if (not labels.empty() && labels.size() != val.size())
+        throw std::invalid_argument("The number of labels must be equal to the number of rows. Actual: " +
+                                    std::to_string(labels.size()) +
+                                    ", Expected: " +
+                                    std::to_string(val.size()) +
+                                    ".");
+
+    for (const std::vector<T> &row : val)
+        __check_row(row);
+
+    // Insert the labels, the batch is rejected as a whole if one of them exists
+    for (size_t i = 0; i < labels.size(); i++)
+        if (not __insert_label(labels[i]))
+        {
+            for (size_t j = 0; j < i; j++)
+                __erase_label(labels[j]);
+
+            throw std::runtime_error("The index '" + labels[i] + "' already exists.");
+        }
+
+    size_t pos;
+
+    try
+    {
+        pos = __reserve(val.size());
+    }
+    catch (const std::runtime_error &)
+    {
+        for (const std::string &label : labels)
+            __erase_label(label);
+
+        throw;
+    }
+
+    for (size_t i = 0; i < val.size(); i++)
+        __write(pos + i, val[i], labels.empty() ? std::string() : labels[i]);
+
+    __publish();
+
+    return pos;
+}
+
+// ==================================================
+// PRIVATE
+
+template <class T>
+typename cdata_appender<T>::cdata_chunk *cdata_appender<T>::__get_chunk(const size_t &pos)
+{
+    cdata_chunk *chunk = m_chunks[pos].load(std::memory_order_acquire);
+
+    if (chunk != nullptr)
+        return chunk;
+
+    // Several producers may allocate the chunk, the first one to store it wins
+    std::unique_ptr<cdata_chunk> created(new cdata_chunk());
+    created->cells.resize(m_chunk_rows * m_width);
+    created->labels.resize(m_chunk_rows);
+    created->ready.reset(new std::atomic<bool>[m_chunk_rows]);
+
+    for (size_t i = 0; i < m_chunk_rows; i++)
+        created->ready[i].store(false, std::memory_order_relaxed);
+
+    if (m_chunks[pos].compare_exchange_strong(chunk, created.get(), std::memory_order_acq_rel))
+        return created.release();
+
+    return chunk;
+}
+
+template <class T>
+size_t cdata_appender<T>::__reserve(const size_t &n)
+{
+    size_t pos = m_cursor.load(std::memory_order_relaxed);
+
+    do
+    {
+        if (n > m_capacity - pos)
+            throw std::runtime_error("The appender is full. Capacity: " + std::to_string(m_capacity) + ".");
+
+    } while (not m_cursor.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed));
+
+    return pos;
+}
+
+template <class T>
+void cdata_appender<T>::__write(const size_t &pos, const std::vector<T> &val, const std::string &label)
+{
+    cdata_chunk *chunk = __get_chunk(pos / m_chunk_rows);
+    const size_t slot = pos % m_chunk_rows;
+
+    std::copy(val.begin(), val.end(), chunk->cells.begin() + slot * m_width);
+    chunk->labels[slot] = label;
+
+    // Sequentially consistent, so a producer that stops on this row is seen by the producer of this row
+    chunk->ready[slot].store(true);
+}
+
+template <class T>
+void cdata_appender<T>::__publish()
+{
+    size_t published = m_published.load();
+
+    for (;;)
+    {
+        // Count the ready rows after the published ones, a chunk not allocated yet has no ready row
+        const size_t reserved = m_cursor.load();
+        size_t end = published;
+
+        while (end < reserved)
+        {
+            const cdata_chunk *chunk = m_chunks[end / m_chunk_rows].load();
+
+            if (chunk == nullptr || not chunk->ready[end % m_chunk_rows].load())
+                break;
+
+            end++;
+        }
+
+        if (end == published)
+            return;
+
+        // On failure another producer moved the cursor, count again from its position
+        if (m_published.compare_exchange_weak(published, end))
+            published = end;
+    }
+}
+
+template <class T>
+bool cdata_appender<T>::__insert_label(const std::string &label)
+{
+    if (label.empty())
+        return true;
+
+    cdata_shard &shard = m_shards[std::hash<std::string>()(label) % n_shards];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    return shard.labels.insert(label).second;
+}
+
+template <class T>
+void cdata_appender<T>::__erase_label(const std::string &label)
+{
+    if (label.empty())
+        return;
+
+    cdata_shard &shard = m_shards[std::hash<std::string>()(label) % n_shards];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    shard.labels.erase(label);
+}
+
+template <class T>
+void cdata_appender<T>::__check_row(const std::vector<T> &val) const
+{
+    if (val.size() != m_width)
+        throw std::invalid_argument("The size of the row must be equal to the number of columns. Actual: " +
+                                    std::to_string(val.size()) +
+                                    ", Expected: " +
+                                    std::to_string(m_width) +
+                                    ".");
+}
+
+template <class T>
+void cdata_appender<T>::__check_pos(const size_t &pos) const
+{
+    if (pos >= m_published.load())
+        throw std::out_of_range("The row " + std::to_string(pos) + " is not published.");
+}
@@ -0,0 +1,117 @@
+/**
+ * @file CDataArena.tpp
+ * @brief File containing the implementation of the 'cdata_arena' and 'cdata_arena_allocator' classes.
+ *
+ * @see CDataArena.hpp
+ * @defgroup arena
+ */
+
+// ==================================================
+// ARENA
+
+inline cdata_arena::cdata_arena(const size_t &slab_size) : m_slab_size(slab_size)
+{
+    if (slab_size == 0)
+        throw std::invalid_argument("The size of a slab must be greater than 0.");
+}
+
+inline void *cdata_arena::allocate(const size_t &size, const size_t &align)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Padding needed to align the current position
+    size_t padding = (align - reinterpret_cast<uintptr_t>(m_cur) % align) % align;
+
+    if (m_cur == nullptr || padding + size > m_left)
+    {
+        // A request larger than a slab gets its own slab, the current slab is kept for the next requests
+        if (size + align > m_slab_size)
+        {
+            m_slabs.emplace_back(new char[size + align]);
+            m_capacity += size + align;
+
+            char *slab = m_slabs.back().get();
+            padding = (align - reinterpret_cast<uintptr_t>(slab) % align) % align;
+            m_used += padding + size;
+
+            return slab + padding;
+        }
+
+        // Otherwise, the rest of the current slab is lost
+        m_slabs.emplace_back(new char[m_slab_size]);
+        m_capacity += m_slab_size;
+
+        m_cur = m_slabs.back().get();
+        m_left = m_slab_size;
+        padding = (align - reinterpret_cast<uintptr_t>(m_cur) % align) % align;
+    }
+
+    void *ptr = m_cur + padding;
+    m_cur += padding + size;
+    m_left -= padding + size;
+    m_used += padding + size;
+
+    return ptr;
+}
+
+inline size_t cdata_arena::n_slabs() const
+{
+    return m_slabs.size();
+}
+
+inline size_t cdata_arena::used() const
+{
+    return m_used;
+}
+
+inline size_t cdata_arena::capacity() const
+{
+    return m_capacity;
+}
+
+// ==================================================
+// ALLOCATOR
+
+template <class U>
+cdata_arena_allocator<U>::cdata_arena_allocator(const std::shared_ptr<cdata_arena> &arena) : m_arena(arena) {}
+
+template <class U>
+template <class V>
+cdata_arena_allocator<U>::cdata_arena_allocator(const cdata_arena_allocator<V> &alloc) : m_arena(alloc.m_arena) {}
+
+template <class U>
+U *cdata_arena_allocator<U>::allocate(const size_t &n)
+{
+    if (m_arena == nullptr)
+        return static_cast<U *>(::operator new(n * sizeof(U)));
+
+    return static_cast<U *>(m_arena->allocate(n * sizeof(U), alignof(U)));
+}
+
+template <class U>
+void cdata_arena_allocator<U>::deallocate(U *ptr, const size_t &)
+{
+    // The memory of the arena is released with its slabs
+    if (m_arena == nullptr)
+        ::operator delete(ptr);
+}
+
+template <class U>
+const std::shared_ptr<cdata_arena> &cdata_arena_allocator<U>::arena() const
+{
+    return m_arena;
+}
+
+template <class U>
+template <class V>
+bool cdata_arena_allocator<U>::operator==(const cdata_arena_allocator<V> &alloc) const
+{
+    return m_arena == alloc.m_arena;
+}
+
+template <class U>
+template <class V>
+bool cdata_arena_allocator<U>::operator!=(const cdata_arena_allocator<V> &alloc) const
+{
+    return not(*this == alloc);
+}
@@ -0,0 +1,742 @@
+/**
+ * @file CDataArrow.tpp
+ * @brief File containing the implementation of the Arrow IPC format.
+ *
+ * @see CDataArrow.hpp
+ * @defgroup arrow
+ */
+
+// ==================================================
+// FLATBUFFER
+
+inline size_t cdata_flatbuffer::size() const
+{
+    return m_bytes.size();
+}
+
+template <class U>
+void cdata_flatbuffer::push(const U &val)
+{
+    __pre_align(sizeof(U), sizeof(U));
+
+    // The bytes are stored reversed, the most significant first
+    const uint64_t bits = static_cast<uint64_t>(val);
+    for (size_t k = sizeof(U); k-- > 0;)
+        m_bytes.push_back(static_cast<char>((bits >> (8 * k)) & 0xff));
+}
+
+inline size_t cdata_flatbuffer::string(const std::string &val)
+{
+    __pre_align(val.size() + 1, 4);
+
+    m_bytes.push_back('\0');
+    m_bytes.append(val.rbegin(), val.rend());
+    push<uint32_t>(val.size());
+
+    return size();
+}
+
+inline size_t cdata_flatbuffer::vector(const std::vector<size_t> &refs)
+{
+    __pre_align(4 * refs.size(), 4);
+
+    for (size_t i = refs.size(); i-- > 0;)
+        push<uint32_t>(__refer(refs[i]));
+
+    push<uint32_t>(refs.size());
+
+    return size();
+}
+
+inline size_t cdata_flatbuffer::vector(const std::string &bytes, const size_t &count, const size_t &align)
+{
+    __pre_align(bytes.size(), std::max<size_t>(align, 4));
+
+    m_bytes.append(bytes.rbegin(), bytes.rend());
+    push<uint32_t>(count);
+
+    return size();
+}
+
+inline void cdata_flatbuffer::start_table()
+{
+    m_fields.clear();
+    m_table = size();
+}
+
+template <class U>
+void cdata_flatbuffer::add(const uint16_t &slot, const U &val)
+{
+    push(val);
+    m_fields.push_back(std::make_pair(slot, size()));
+}
+
+inline void cdata_flatbuffer::add_offset(const uint16_t &slot, const size_t &ref)
+{
+    push<uint32_t>(__refer(ref));
+    m_fields.push_back(std::make_pair(slot, size()));
+}
+
+inline size_t cdata_flatbuffer::end_table()
+{
+    // The offset to the vtable, written once the vtable is built
+    push<int32_t>(0);
+    const size_t table = size();
+
+    size_t n_slots = 0;
+    for (const std::pair<uint16_t, size_t> &field : m_fields)
+        n_slots = std::max<size_t>(n_slots, field.first + 1);
+
+    std::vector<uint16_t> offsets(n_slots, 0);
+    for (const std::pair<uint16_t, size_t> &field : m_fields)
+        offsets[field.first] = table - field.second;
+
+    for (size_t i = n_slots; i-- > 0;)
+        push<uint16_t>(offsets[i]);
+
+    push<uint16_t>(table - m_table);
+    push<uint16_t>(4 + 2 * n_slots);
+
+    // The vtable is before the table, at a negative offset
+    const uint32_t soffset = size() - table;
+    for (size_t k = 0; k < 4; k++)
+        m_bytes[table - 1 - k] = static_cast<char>((soffset >> (8 * k)) & 0xff);
+
+    m_fields.clear();
+
+    return table;
+}
+
+inline std::string cdata_flatbuffer::finish(const size_t &root)
+{
+    __pre_align(4, m_min_align);
+    push<uint32_t>(__refer(root));
+
+    return std::string(m_bytes.rbegin(), m_bytes.rend());
+}
+
+inline void cdata_flatbuffer::__pre_align(const size_t &len, const size_t &align)
+{
+    m_min_align = std::max(m_min_align, align);
+    m_bytes.append((~(m_bytes.size() + len) + 1) & (align - 1), '\0');
+}
+
+inline uint32_t cdata_flatbuffer::__refer(const size_t &ref)
+{
+    __pre_align(4, 4);
+    return size() + 4 - ref;
+}
+
+// ==================================================
+// FLATBUFFER VIEW
+
+inline cdata_flatbuffer_view::cdata_flatbuffer_view(const char *data, const size_t &size)
+    : m_data(data), m_size(size)
+{
+}
+
+template <class U>
+U cdata_flatbuffer_view::read(const size_t &pos) const
+{
+    if (pos > m_size || sizeof(U) > m_size - pos)
+        throw std::runtime_error("The Arrow metadata is corrupted.");
+
+    uint64_t bits = 0;
+    for (size_t k = 0; k < sizeof(U); k++)
+        bits |= static_cast<uint64_t>(static_cast<uint8_t>(m_data[pos + k])) << (8 * k);
+
+    return static_cast<U>(bits);
+}
+
+inline size_t cdata_flatbuffer_view::root() const
+{
+    return read<uint32_t>(0);
+}
+
+inline size_t cdata_flatbuffer_view::field(const size_t &table, const uint16_t &slot) const
+{
+    const int64_t vtable = static_cast<int64_t>(table) - read<int32_t>(table);
+    if (vtable < 0)
+        throw std::runtime_error("The Arrow metadata is corrupted.");
+
+    // A field after the end of the vtable was added to the schema after the writer
+    if (4 + 2 * size_t(slot) + 2 > read<uint16_t>(vtable))
+        return 0;
+
+    return read<uint16_t>(vtable + 4 + 2 * size_t(slot));
+}
+
+template <class U>
+U cdata_flatbuffer_view::scalar(const size_t &table, const uint16_t &slot, const U &def) const
+{
+    const size_t offset = field(table, slot);
+
+    return offset ? read<U>(table + offset) : def;
+}
+
+inline size_t cdata_flatbuffer_view::ref(const size_t &table, const uint16_t &slot) const
+{
+    const size_t offset = field(table, slot);
+    if (not offset)
+        return 0;
+
+    return table + offset + read<uint32_t>(table + offset);
+}
+
+inline size_t cdata_flatbuffer_view::length(const size_t &vec) const
+{
+    return vec ? read<uint32_t>(vec) : 0;
+}
+
+inline size_t cdata_flatbuffer_view::at(const size_t &vec, const size_t &pos) const
+{
+    const size_t elem = vec + 4 + 4 * pos;
+
+    return elem + read<uint32_t>(elem);
+}
+
+inline std::string cdata_flatbuffer_view::string(const size_t &pos) const
+{
+    if (not pos)
+        return "";
+
+    const size_t len = read<uint32_t>(pos);
+    if (len > m_size - pos - 4)
+        throw std::runtime_error("The Arrow metadata is corrupted.");
+
+    return std::string(m_data + pos + 4, len);
+}
+
+// ==================================================
+// COLUMN
+
+inline bool cdata_arrow_column::is_valid(const size_t &pos) const
+{
+    return validity == nullptr || (validity[pos >> 3] >> (pos & 7)) & 1;
+}
+
+template <class U>
+void cdata_arrow_column::value(const size_t &pos, U &out) const
+{
+    if (field.type == cdata_arrow::type_bool)
+        out = static_cast<U>((static_cast<uint8_t>(data[pos >> 3]) >> (pos & 7)) & 1);
+    else if (field.type == cdata_arrow::type_float)
+        out = field.precision == 1 ? static_cast<U>(__load<float>(data + 4 * pos)) : static_cast<U>(__load<double>(data + 8 * pos));
+    else if (field.bit_width == 8)
+        out = field.is_signed ? static_cast<U>(__load<int8_t>(data + pos)) : static_cast<U>(__load<uint8_t>(data + pos));
+    else if (field.bit_width == 16)
+        out = field.is_signed ? static_cast<U>(__load<int16_t>(data + 2 * pos)) : static_cast<U>(__load<uint16_t>(data + 2 * pos));
+    else if (field.bit_width == 32)
+        out = field.is_signed ? static_cast<U>(__load<int32_t>(data + 4 * pos)) : static_cast<U>(__load<uint32_t>(data + 4 * pos));
+    else
+        out = field.is_signed ? static_cast<U>(__load<int64_t>(data + 8 * pos)) : static_cast<U>(__load<uint64_t>(data + 8 * pos));
+}
+
+inline void cdata_arrow_column::value(const size_t &pos, std::string &out) const
+{
+    int64_t start, end;
+
+    if (field.type == cdata_arrow::type_large_utf8)
+    {
+        start = __load<int64_t>(offsets + 8 * pos);
+        end = __load<int64_t>(offsets + 8 * (pos + 1));
+    }
+    else
+    {
+        start = __load<int32_t>(offsets + 4 * pos);
+        end = __load<int32_t>(offsets + 4 * (pos + 1));
+    }
+
+    if (start < 0 || start > end || static_cast<uint64_t>(end) > data_size)
+        throw std::runtime_error("The Arrow data is corrupted.");
+
+    out.assign(data + start, end - start);
+}
+
+template <class U>
+U cdata_arrow_column::__load(const char *data)
+{
+    U val;
+    std::memcpy(&val, data, sizeof(U));
+
+    return val;
+}
+
+// ==================================================
+// WRITE
+
+inline const char *cdata_arrow::index_name()
+{
+    return "__index_level_0__";
+}
+
+template <class U>
+std::string cdata_arrow::pandas(const std::vector<std::string> &names)
+{
+    std::string numpy_type, pandas_type;
+    const cdata_arrow_field type = field<U>("");
+
+    if (type.type == type_utf8)
+        numpy_type = "object", pandas_type = "unicode";
+    else if (type.type == type_float)
+        numpy_type = pandas_type = type.precision == 1 ? "float32" : "float64";
+    else
+        numpy_type = pandas_type = (type.is_signed ? "int" : "uint") + std::to_string(type.bit_width);
+
+    std::string json = "{\"index_columns\": [" + __json(index_name()) + "], \"column_indexes\": [], \"columns\": [";
+
+    for (const std::string &name : names)
+        json += "{\"name\": " + __json(name) + ", \"field_name\": " + __json(name) + ", \"pandas_type\": \"" + pandas_type + "\", \"numpy_type\": \"" + numpy_type + "\", \"metadata\": null}, ";
+
+    json += "{\"name\": null, \"field_name\": " + __json(index_name()) + ", \"pandas_type\": \"unicode\", \"numpy_type\": \"object\", \"metadata\": null}], ";
+    json += "\"creator\": {\"library\": \"cdataframe\", \"version\": \"1.0\"}, \"pandas_version\": \"1.0.0\"}";
+
+    return json;
+}
+
+template <class U>
+cdata_arrow_field cdata_arrow::field(const std::string &name)
+{
+    cdata_arrow_field field;
+    field.name = name;
+
+    if (cdata_is_string<U>::value)
+        field.type = type_utf8;
+    else if (std::is_integral<U>::value && not std::is_same<U, bool>::value)
+    {
+        field.type = type_int;
+        field.bit_width = 8 * sizeof(U);
+        field.is_signed = std::is_signed<U>::value;
+    }
+    else if (std::is_floating_point<U>::value && (sizeof(U) == 4 || sizeof(U) == 8))
+    {
+        field.type = type_float;
+        field.precision = sizeof(U) == 4 ? 1 : 2;
+    }
+    else
+        throw std::invalid_argument("The type of the cells has no Arrow type.");
+
+    return field;
+}
+
+template <class U, class Function>
+void cdata_arrow::append_column(std::string &body, std::vector<cdata_arrow_buffer> &buffers, const size_t &length, const std::vector<uint64_t> *valid, Function cell)
+{
+    // The validity bitmap has the layout of the words of a mask on a little-endian host
+    std::string bits;
+
+    if (valid)
+    {
+        bits.resize((length + 7) / 8);
+        for (size_t i = 0; i < bits.size(); i++)
+            bits[i] = static_cast<char>(((*valid)[i / 8] >> (8 * (i % 8))) & 0xff);
+    }
+
+    __append_buffer(body, buffers, bits.data(), bits.size());
+    __append_values<U>(body, buffers, length, valid, cell, cdata_is_string<U>());
+}
+
+inline size_t cdata_arrow::write_message(std::ostream &out, const std::string &metadata, const std::string &body)
+{
+    // The continuation marker, then the size of the metadata padded to 8 bytes
+    std::string prefix;
+    __put<uint32_t>(prefix, 0xffffffff);
+    __put<int32_t>(prefix, metadata.size());
+
+    out.write(prefix.data(), prefix.size());
+    out.write(metadata.data(), metadata.size());
+    out.write(body.data(), body.size());
+
+    return prefix.size() + metadata.size();
+}
+
+inline std::string cdata_arrow::schema(const std::vector<cdata_arrow_field> &fields, const std::vector<std::pair<std::string, std::string>> &metadata)
+{
+    cdata_flatbuffer fb;
+    const size_t schema = __schema(fb, fields, metadata);
+
+    return __message(fb, 1, schema, 0);
+}
+
+inline std::string cdata_arrow::record_batch(const int64_t &length, const std::vector<std::pair<int64_t, int64_t>> &nodes, const std::vector<cdata_arrow_buffer> &buffers, const int64_t &body_length)
+{
+    std::string node_bytes, buffer_bytes;
+
+    for (const std::pair<int64_t, int64_t> &node : nodes)
+    {
+        __put<int64_t>(node_bytes, node.first);
+        __put<int64_t>(node_bytes, node.second);
+    }
+
+    for (const cdata_arrow_buffer &buffer : buffers)
+    {
+        __put<int64_t>(buffer_bytes, buffer.offset);
+        __put<int64_t>(buffer_bytes, buffer.length);
+    }
+
+    cdata_flatbuffer fb;
+    const size_t nodes_ref = fb.vector(node_bytes, nodes.size(), 8);
+    const size_t buffers_ref = fb.vector(buffer_bytes, buffers.size(), 8);
+
+    fb.start_table();
+    fb.add<int64_t>(0, length);
+    fb.add_offset(1, nodes_ref);
+    fb.add_offset(2, buffers_ref);
+
+    return __message(fb, 3, fb.end_table(), body_length);
+}
+
+inline std::string cdata_arrow::footer(const std::vector<cdata_arrow_field> &fields, const std::vector<std::pair<std::string, std::string>> &metadata, const std::vector<std::tuple<int64_t, int32_t, int64_t>> &blocks)
+{
+    std::string block_bytes;
+
+    for (const std::tuple<int64_t, int32_t, int64_t> &block : blocks)
+    {
+        __put<int64_t>(block_bytes, std::get<0>(block));
+        __put<int32_t>(block_bytes, std::get<1>(block));
+        __put<int32_t>(block_bytes, 0);
+        __put<int64_t>(block_bytes, std::get<2>(block));
+    }
+
+    cdata_flatbuffer fb;
+    const size_t schema = __schema(fb, fields, metadata);
+    const size_t dictionaries = fb.vector(std::string(), 0, 8);
+    const size_t batches = fb.vector(block_bytes, blocks.size(), 8);
+
+    fb.start_table();
+    fb.add<int16_t>(0, 4);
+    fb.add_offset(1, schema);
+    fb.add_offset(2, dictionaries);
+    fb.add_offset(3, batches);
+
+    return fb.finish(fb.end_table());
+}
+
+// ==================================================
+// READ
+
+inline void cdata_arrow::read(const std::string &bytes, std::vector<cdata_arrow_field> &fields, std::vector<std::pair<std::string, std::string>> &metadata, std::vector<std::vector<cdata_arrow_column>> &batches)
+{
+    const cdata_flatbuffer_view prefix(bytes.data(), bytes.size());
+    bool has_schema = false;
+
+    // The file format starts with the magic string padded to 8 bytes, followed by a stream
+    size_t pos = bytes.compare(0, 6, "ARROW1") == 0 ? 8 : 0;
+
+    while (pos < bytes.size())
+    {
+        // The old format has no continuation marker
+        int64_t meta_len = prefix.read<int32_t>(pos);
+        pos += 4;
+
+        if (meta_len == -1)
+        {
+            meta_len = prefix.read<int32_t>(pos);
+            pos += 4;
+        }
+
+        // The end of the stream
+        if (meta_len == 0)
+            break;
+
+        if (meta_len < 0 || static_cast<uint64_t>(meta_len) > bytes.size() - pos)
+            throw std::runtime_error("The Arrow data is corrupted.");
+
+        const cdata_flatbuffer_view fb(bytes.data() + pos, meta_len);
+        const size_t message = fb.root();
+        const uint8_t header_type = fb.scalar<uint8_t>(message, 1, 0);
+        const size_t header = fb.ref(message, 2);
+        const int64_t body_length = fb.scalar<int64_t>(message, 3, 0);
+
+        pos += meta_len;
+        if (body_length < 0 || static_cast<uint64_t>(body_length) > bytes.size() - pos)
+            throw std::runtime_error("The Arrow data is corrupted.");
+
+        if (header_type == 1 && not has_schema)
+        {
+            __read_schema(fb, header, fields, metadata);
+            has_schema = true;
+        }
+        else if (header_type == 3 && has_schema)
+            batches.push_back(__read_batch(fb, header, fields, bytes.data() + pos, body_length));
+        else if (header_type == 2)
+            throw std::runtime_error("The Arrow dictionaries are not supported.");
+        else
+            throw std::runtime_error("The Arrow data is corrupted.");
+
+        pos += body_length;
+    }
+
+    if (not has_schema)
+        throw std::runtime_error("The Arrow data has no schema.");
+}
+
+// ==================================================
+// PRIVATE
+
+inline size_t cdata_arrow::__schema(cdata_flatbuffer &fb, const std::vector<cdata_arrow_field> &fields, const std::vector<std::pair<std::string, std::string>> &metadata)
+{
+    std::vector<size_t> field_refs, metadata_refs;
+
+    for (const cdata_arrow_field &field : fields)
+    {
+        const size_t name = fb.string(field.name);
+        const size_t children = fb.vector(std::vector<size_t>());
+
+        fb.start_table();
+        if (field.type == type_int)
+        {
+            fb.add<int32_t>(0, field.bit_width);
+            fb.add<bool>(1, field.is_signed);
+        }
+        else if (field.type == type_float)
+            fb.add<int16_t>(0, field.precision);
+        const size_t type = fb.end_table();
+
+        fb.start_table();
+        fb.add_offset(0, name);
+        fb.add<bool>(1, true);
+        fb.add<uint8_t>(2, field.type);
+        fb.add_offset(3, type);
+        fb.add_offset(5, children);
+        field_refs.push_back(fb.end_table());
+    }
+
+    for (const std::pair<std::string, std::string> &pair : metadata)
+    {
+        const size_t key = fb.string(pair.first);
+        const size_t value = fb.string(pair.second);
+
+        fb.start_table();
+        fb.add_offset(0, key);
+        fb.add_offset(1, value);
+        metadata_refs.push_back(fb.end_table());
+    }
+
+    const size_t fields_ref = fb.vector(field_refs);
+    const size_t metadata_ref = fb.vector(metadata_refs);
+
+    fb.start_table();
+    fb.add<int16_t>(0, __endianness());
+    fb.add_offset(1, fields_ref);
+    if (not metadata.empty())
+        fb.add_offset(2, metadata_ref);
+
+    return fb.end_table();
+}
+
+inline std::string cdata_arrow::__message(cdata_flatbuffer &fb, const uint8_t &header_type, const size_t &header, const int64_t &body_length)
+{
+    fb.start_table();
+    fb.add<int16_t>(0, 4);
+    fb.add<uint8_t>(1, header_type);
+    fb.add_offset(2, header);
+    fb.add<int64_t>(3, body_length);
+
+    return fb.finish(fb.end_table());
+}
+
+template <class U, class Function>
+void cdata_arrow::__append_values(std::string &body, std::vector<cdata_arrow_buffer> &buffers, const size_t &length, const std::vector<uint64_t> *valid, Function cell, std::true_type)
+{
+    std::vector<int32_t> offsets(length + 1, 0);
+    std::string data;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        if (valid == nullptr || ((*valid)[i / 64] >> (i % 64)) & 1)
+        {
+            const U &val = cell(i);
+            data.append(val.data(), val.size());
+        }
+
+        if (data.size() > size_t(std::numeric_limits<int32_t>::max()))
+            throw std::runtime_error("The strings of a column exceed the 2 GiB of an Arrow string column.");
+
+        offsets[i + 1] = data.size();
+    }
+
+    __append_buffer(body, buffers, reinterpret_cast<const char *>(offsets.data()), 4 * offsets.size());
+    __append_buffer(body, buffers, data.data(), data.size());
+}
+
+template <class U, class Function>
+void cdata_arrow::__append_values(std::string &body, std::vector<cdata_arrow_buffer> &buffers, const size_t &length, const std::vector<uint64_t> *, Function cell, std::false_type)
+{
+    // The rows are gathered in a contiguous column
+    std::vector<U> values(length);
+    for (size_t i = 0; i < length; i++)
+        values[i] = cell(i);
+
+    __append_buffer(body, buffers, reinterpret_cast<const char *>(values.data()), sizeof(U) * length);
+}
+
+inline void cdata_arrow::__append_buffer(std::string &body, std::vector<cdata_arrow_buffer> &buffers, const char *data, const size_t &size)
+{
+    cdata_arrow_buffer buffer;
+    buffer.offset = body.size();
+    buffer.length = size;
+    buffers.push_back(buffer);
+
+    body.append(data, size);
+    body.append((8 - body.size() % 8) % 8, '\0');
+}
+
+template <class U>
+void cdata_arrow::__put(std::string &out, const U &val)
+{
+    const uint64_t bits = static_cast<uint64_t>(val);
+    for (size_t k = 0; k < sizeof(U); k++)
+        out.push_back(static_cast<char>((bits >> (8 * k)) & 0xff));
+}
+
+inline int16_t cdata_arrow::__endianness()
+{
+    const uint16_t one = 1;
+    char first;
+    std::memcpy(&first, &one, 1);
+
+    return first == 1 ? 0 : 1;
+}
+
+inline std::string cdata_arrow::__json(const std::string &val)
+{
+    std::string out = "\"";
+
+    for (const char &c : val)
+    {
+        if (c == '"' || c == '\\')
+            out += std::string("\\") + c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char hex[7];
+            std::snprintf(hex, sizeof(hex), "\\u%04x", c);
+            out += hex;
+        }
+        else
+            out += c;
+    }
+
+    return out + "\"";
+}
+
+inline void cdata_arrow::__read_schema(const cdata_flatbuffer_view &fb, const size_t &schema, std::vector<cdata_arrow_field> &fields, std::vector<std::pair<std::string, std::string>> &metadata)
+{
+    if (fb.scalar<int16_t>(schema, 0, 0) != __endianness())
+        throw std::runtime_error("The byte order of the Arrow data is not the one of the host.");
+
+    const size_t fields_ref = fb.ref(schema, 1);
+
+    for (size_t i = 0; i < fb.length(fields_ref); i++)
+    {
+        const size_t ref = fb.at(fields_ref, i);
+        const size_t type = fb.ref(ref, 3);
+
+        cdata_arrow_field field;
+        field.name = fb.string(fb.ref(ref, 0));
+        field.type = fb.scalar<uint8_t>(ref, 2, 0);
+
+        if (fb.ref(ref, 4))
+            throw std::runtime_error("The Arrow dictionaries are not supported.");
+
+        if (field.type == type_int)
+        {
+            field.bit_width = fb.scalar<int32_t>(type, 0, 0);
+            field.is_signed = fb.scalar<bool>(type, 1, false);
+
+            if (field.bit_width != 8 && field.bit_width != 16 && field.bit_width != 32 && field.bit_width != 64)
+                throw std::runtime_error("The Arrow integers of the column '" + field.name + "' are not supported.");
+        }
+        else if (field.type == type_float)
+        {
+            field.precision = fb.scalar<int16_t>(type, 0, 0);
+
+            if (field.precision != 1 && field.precision != 2)
+                throw std::runtime_error("The Arrow floating point numbers of the column '" + field.name + "' are not supported.");
+        }
+        else if (field.type != type_utf8 && field.type != type_large_utf8 && field.type != type_bool)
+            throw std::runtime_error("The Arrow type " + std::to_string(field.type) + " of the column '" + field.name + "' is not supported.");
+
+        fields.push_back(field);
+    }
+
+    const size_t metadata_ref = fb.ref(schema, 2);
+
+    for (size_t i = 0; i < fb.length(metadata_ref); i++)
+    {
+        const size_t ref = fb.at(metadata_ref, i);
+        metadata.push_back(std::make_pair(fb.string(fb.ref(ref, 0)), fb.string(fb.ref(ref, 1))));
+    }
+}
+
+inline std::vector<cdata_arrow_column> cdata_arrow::__read_batch(const cdata_flatbuffer_view &fb, const size_t &batch, const std::vector<cdata_arrow_field> &fields, const char *body, const size_t &body_length)
+{
+    if (fb.ref(batch, 3))
+        throw std::runtime_error("The compressed Arrow buffers are not supported.");
+
+    const int64_t length = fb.scalar<int64_t>(batch, 0, 0);
+    const size_t nodes = fb.ref(batch, 1);
+    const size_t buffers = fb.ref(batch, 2);
+    size_t n_buffers = 0;
+
+    if (length < 0 || fb.length(nodes) != fields.size())
+        throw std::runtime_error("The Arrow data is corrupted.");
+
+    // Get the next buffer, its size must hold the values of the column
+    auto next = [&](const uint64_t &min_size, const char *&data, size_t &size)
+    {
+        if (n_buffers >= fb.length(buffers))
+            throw std::runtime_error("The Arrow data is corrupted.");
+
+        const size_t pos = buffers + 4 + 16 * n_buffers++;
+        const int64_t offset = fb.read<int64_t>(pos);
+        const int64_t len = fb.read<int64_t>(pos + 8);
+
+        if (offset < 0 || len < 0 || static_cast<uint64_t>(offset) > body_length || static_cast<uint64_t>(len) > body_length - offset || static_cast<uint64_t>(len) < min_size)
+            throw std::runtime_error("The Arrow data is corrupted.");
+
+        data = body + offset;
+        size = len;
+    };
+
+    std::vector<cdata_arrow_column> columns(fields.size());
+
+    for (size_t i = 0; i < fields.size(); i++)
+    {
+        cdata_arrow_column &col = columns[i];
+        col.field = fields[i];
+        col.length = fb.read<int64_t>(nodes + 4 + 16 * i);
+        col.null_count = fb.read<int64_t>(nodes + 12 + 16 * i);
+
+        if (col.length != length)
+            throw std::runtime_error("The Arrow data is corrupted.");
+
+        const uint64_t n = length;
+        const char *validity;
+        size_t size;
+
+        // An empty validity bitmap means that all the values are valid
+        next(0, validity, size);
+        if (size != 0 && col.null_count != 0)
+        {
+            if (size < (n + 7) / 8)
+                throw std::runtime_error("The Arrow data is corrupted.");
+
+            col.validity = reinterpret_cast<const uint8_t *>(validity);
+        }
+
+        if (col.field.type == type_utf8 || col.field.type == type_large_utf8)
+            next(n ? (n + 1) * (col.field.type == type_utf8 ? 4 : 8) : 0, col.offsets, size);
+
+        if (col.field.type == type_bool)
+            next((n + 7) / 8, col.data, col.data_size);
+        else if (col.field.type == type_int)
+            next(n * col.field.bit_width / 8, col.data, col.data_size);
+        else if (col.field.type == type_float)
+            next(n * (col.field.precision == 1 ? 4 : 8), col.data, col.data_size);
+        else
+            next(0, col.data, col.data_size);
+    }
+
+    return columns;
+}
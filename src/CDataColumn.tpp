@@ -0,0 +1,162 @@
+/**
+ * @file CDataColumn.tpp
+ * @brief File containing the implementation of the 'cdata_column' class.
+ *
+ * @see CDataColumn.hpp
+ * @defgroup column
+ */
+
+// ==================================================
+// CONSTRUCTOR
+
+template <class T>
+cdata_column<T>::cdata_column(const cdata_frame<T> &df, const size_t &pos) : m_df(&df), m_pos(pos)
+{
+    if (pos >= df.width())
+        throw std::out_of_range("The column " + std::to_string(pos) + " is out of range.");
+}
+
+// ==================================================
+// GETTER
+
+template <class T>
+size_t cdata_column<T>::size() const
+{
+    return m_df->height();
+}
+
+template <class T>
+size_t cdata_column<T>::pos() const
+{
+    return m_pos;
+}
+
+template <class T>
+const T &cdata_column<T>::operator[](const size_t &row) const
+{
+    return m_df->cell(row, m_pos);
+}
+
+template <class T>
+std::vector<T> cdata_column<T>::to_vector() const
+{
+    return m_df->columns_vec(m_pos);
+}
+
+template <class T>
+bool cdata_column<T>::is_scalar() const
+{
+    return false;
+}
+
+template <class T>
+void cdata_column<T>::and_valid(cdata_mask &mask) const
+{
+    const cdata_mask *valid = m_df->__get_valid(m_pos);
+
+    // No missing cell in the data frame
+    if (valid != nullptr)
+        mask &= *valid;
+}
+
+// ==================================================
+// REDUCTION
+
+template <class T>
+size_t cdata_column<T>::count() const
+{
+    const cdata_mask *valid = m_df->__get_valid(m_pos);
+    return valid == nullptr ? size() : valid->count();
+}
+
+template <class T>
+T cdata_column<T>::sum() const
+{
+    T res = T();
+
+    __for_each_valid([&](const size_t &row)
+                     { res += m_df->cell(row, m_pos); });
+
+    return res;
+}
+
+template <class T>
+double cdata_column<T>::mean() const
+{
+    double res = 0;
+    size_t n = 0;
+
+    __for_each_valid([&](const size_t &row)
+                     { res += m_df->cell(row, m_pos); n++; });
+
+    return n == 0 ? std::numeric_limits<double>::quiet_NaN() : res / n;
+}
+
+template <class T>
+T cdata_column<T>::min() const
+{
+    const T *res = nullptr;
+
+    __for_each_valid([&](const size_t &row)
+                     { const T &val = m_df->cell(row, m_pos);
+                       if (res == nullptr || val < *res)
+                           res = &val; });
+
+    if (res == nullptr)
+        throw std::runtime_error("The column has no valid element.");
+
+    return *res;
+}
+
+template <class T>
+T cdata_column<T>::max() const
+{
+    const T *res = nullptr;
+
+    __for_each_valid([&](const size_t &row)
+                     { const T &val = m_df->cell(row, m_pos);
+                       if (res == nullptr || *res < val)
+                           res = &val; });
+
+    if (res == nullptr)
+        throw std::runtime_error("The column has no valid element.");
+
+    return *res;
+}
+
+// ==================================================
+// PRIVATE
+
+template <class T>
+template <class Function>
+void cdata_column<T>::__for_each_valid(Function func) const
+{
+    const size_t n_rows = size();
+    const cdata_mask *valid = m_df->__get_valid(m_pos);
+
+    // No missing cell in the data frame
+    if (valid == nullptr)
+    {
+        for (size_t row = 0; row < n_rows; row++)
+            func(row);
+
+        return;
+    }
+
+    const std::vector<uint64_t> &words = valid->words();
+
+    for (size_t w = 0; w < words.size(); w++)
+    {
+        const size_t start = w * cdata_mask::word_bits;
+
+        // Full word: every row is valid
+        if (words[w] == ~uint64_t(0))
+            for (size_t row = start; row < start + cdata_mask::word_bits; row++)
+                func(row);
+
+        // Otherwise, only visit the bits set
+        else
+            for (uint64_t bits = words[w]; bits != 0; bits &= bits - 1)
+                func(start + cdata_mask::lowest_bit(bits));
+    }
+}
@@ -0,0 +1,185 @@
+/**
+ * @file CDataDigest.tpp
+ * @brief File containing the implementation of the 'cdata_digest' class.
+ *
+ * @see CDataDigest.hpp
+ * @defgroup digest
+ */
+
+// ==================================================
+// CONSTRUCTOR
+
+inline cdata_digest::cdata_digest(const double &compression) : m_compression(compression)
+{
+    if (not(compression >= 1))
+        throw std::invalid_argument("The compression must be at least 1.");
+}
+
+// ==================================================
+// MANIPULATION
+
+inline void cdata_digest::add(const double &x, const double &weight)
+{
+    if (std::isnan(x) || weight <= 0)
+        return;
+
+    m_buffer.push_back(cdata_centroid{x, weight});
+    m_count += weight;
+    m_min = std::min(m_min, x);
+    m_max = std::max(m_max, x);
+
+    if (m_buffer.size() >= 8 * static_cast<size_t>(m_compression))
+        compress();
+}
+
+inline void cdata_digest::merge(const cdata_digest &digest)
+{
+    if (digest.m_count == 0)
+        return;
+
+    // The centroids of the other digest are merged like buffered values
+    m_buffer.insert(m_buffer.end(), digest.m_centroids.begin(), digest.m_centroids.end());
+    m_buffer.insert(m_buffer.end(), digest.m_buffer.begin(), digest.m_buffer.end());
+    m_count += digest.m_count;
+    m_min = std::min(m_min, digest.m_min);
+    m_max = std::max(m_max, digest.m_max);
+
+    compress();
+}
+
+inline void cdata_digest::compress()
+{
+    if (m_buffer.empty())
+        return;
+
+    m_centroids = __merged();
+    m_buffer.clear();
+}
+
+// ==================================================
+// GETTER
+
+inline double cdata_digest::count() const
+{
+    return m_count;
+}
+
+inline size_t cdata_digest::size() const
+{
+    return m_buffer.empty() ? m_centroids.size() : __merged().size();
+}
+
+inline double cdata_digest::compression() const
+{
+    return m_compression;
+}
+
+inline double cdata_digest::min() const
+{
+    if (m_count == 0)
+        throw std::runtime_error("The digest is empty.");
+
+    return m_min;
+}
+
+inline double cdata_digest::max() const
+{
+    if (m_count == 0)
+        throw std::runtime_error("The digest is empty.");
+
+    return m_max;
+}
+
+inline double cdata_digest::quantile(const double &q) const
+{
+    if (not(q >= 0 && q <= 1))
+        throw std::invalid_argument("The quantile must be between 0 and 1.");
+
+    if (m_count == 0)
+        throw std::runtime_error("The digest is empty.");
+
+    // The buffered values are merged in a copy, a const digest is never modified
+    const std::vector<cdata_centroid> merged = m_buffer.empty() ? std::vector<cdata_centroid>() : __merged();
+    const std::vector<cdata_centroid> &c = m_buffer.empty() ? m_centroids : merged;
+    const double index = q * m_count;
+
+    // Before the center of the first centroid: between the minimum and the center
+    if (index <= c.front().weight / 2)
+        return m_min + (c.front().mean - m_min) * index / (c.front().weight / 2);
+
+    // Between the centers of two centroids
+    double weight = c.front().weight / 2;
+
+    for (size_t i = 1; i < c.size(); i++)
+    {
+        const double gap = (c[i - 1].weight + c[i].weight) / 2;
+
+        if (index <= weight + gap)
+        {
+            // A single value is exact, it is not spread around its center
+            if (c[i - 1].weight == 1 && index - weight < 0.5)
+                return c[i - 1].mean;
+
+            if (c[i].weight == 1 && weight + gap - index <= 0.5)
+                return c[i].mean;
+
+            return c[i - 1].mean + (c[i].mean - c[i - 1].mean) * (index - weight) / gap;
+        }
+
+        weight += gap;
+    }
+
+    // After the center of the last centroid: between the center and the maximum
+    return c.back().mean + (m_max - c.back().mean) * std::min((index - weight) / (c.back().weight / 2), 1.);
+}
+
+// ==================================================
+// PRIVATE
+
+inline std::vector<cdata_centroid> cdata_digest::__merged() const
+{
+    std::vector<cdata_centroid> values = m_buffer;
+    values.insert(values.end(), m_centroids.begin(), m_centroids.end());
+    std::sort(values.begin(), values.end(), [](const cdata_centroid &a, const cdata_centroid &b)
+              { return a.mean < b.mean; });
+
+    std::vector<cdata_centroid> centroids;
+
+    // Merge the neighbours while the centroid stays under the limit of its position
+    cdata_centroid cur = values.front();
+    double weight = 0;
+    double limit = __limit(weight);
+
+    for (size_t i = 1; i < values.size(); i++)
+    {
+        const cdata_centroid &next = values[i];
+
+        if (weight + cur.weight + next.weight <= limit)
+        {
+            cur.weight += next.weight;
+            cur.mean += (next.mean - cur.mean) * next.weight / cur.weight;
+        }
+        else
+        {
+            centroids.push_back(cur);
+            weight += cur.weight;
+            limit = __limit(weight);
+            cur = next;
+        }
+    }
+
+    centroids.push_back(cur);
+    return centroids;
+}
+
+inline double cdata_digest::__limit(const double &weight) const
+{
+    // k1(q) = compression / (2 pi) * asin(2q - 1), a centroid spans at most one unit of k
+    const double pi = 3.14159265358979323846;
+    const double k = m_compression / (2 * pi) * std::asin(2 * std::min(weight / m_count, 1.) - 1) + 1;
+
+    if (k >= m_compression / 4)
+        return m_count;
+
+    return m_count * (std::sin(k * 2 * pi / m_compression) + 1) / 2;
+}
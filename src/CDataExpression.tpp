@@ -0,0 +1,304 @@
+/**
+ * @file CDataExpression.tpp
+ * @brief File containing the implementation of the expression templates.
+ *
+ * @see CDataExpression.hpp
+ * @defgroup expression
+ */
+
+// ==================================================
+// EXPRESSION
+
+template <class E>
+const E &cdata_expression<E>::self() const
+{
+    return static_cast<const E &>(*this);
+}
+
+template <class E>
+template <class U>
+void cdata_expression<E>::eval(U *dst, const size_t &n) const
+{
+    const E &expr = self();
+
+    // One fused loop for the whole tree, the threads take contiguous chunks of the destination
+#pragma omp parallel for simd schedule(static, chunk_size) if (n >= 2 * chunk_size)
+    for (size_t i = 0; i < n; i++)
+        dst[i] = static_cast<U>(expr[i]);
+}
+
+template <class E>
+template <class V>
+std::vector<typename V::value_type> cdata_expression<E>::to_vector() const
+{
+    std::vector<typename V::value_type> vec(self().size());
+    eval(vec.data(), vec.size());
+    return vec;
+}
+
+template <class E>
+template <class R, class Compare>
+cdata_mask cdata_expression<E>::compare(const cdata_expression<R> &rhs, Compare cmp) const
+{
+    const cdata_binary_expr<E, R, Compare> expr(self(), rhs.self());
+    cdata_mask mask = cdata_mask::from_predicate(expr.size(), [&expr](const size_t &i)
+                                                 { return expr[i]; });
+
+    // A missing cell never matches
+    expr.and_valid(mask);
+
+    return mask;
+}
+
+// ==================================================
+// SCALAR
+
+template <class T>
+cdata_scalar<T>::cdata_scalar(const T &val) : m_val(val) {}
+
+template <class T>
+size_t cdata_scalar<T>::size() const
+{
+    return 0;
+}
+
+template <class T>
+bool cdata_scalar<T>::is_scalar() const
+{
+    return true;
+}
+
+template <class T>
+const T &cdata_scalar<T>::operator[](const size_t &) const
+{
+    return m_val;
+}
+
+template <class T>
+void cdata_scalar<T>::and_valid(cdata_mask &) const {}
+
+// ==================================================
+// BINARY EXPRESSION
+
+template <class L, class R, class Op>
+cdata_binary_expr<L, R, Op>::cdata_binary_expr(const L &lhs, const R &rhs) : m_lhs(lhs), m_rhs(rhs)
+{
+    // A constant takes the size of the other operand
+    if (not lhs.is_scalar() && not rhs.is_scalar() && lhs.size() != rhs.size())
+        throw std::invalid_argument("The expressions must have the same size. Actual: " +
+                                    std::to_string(rhs.size()) +
+                                    ", Expected: " +
+                                    std::to_string(lhs.size()) +
+                                    ".");
+}
+
+template <class L, class R, class Op>
+size_t cdata_binary_expr<L, R, Op>::size() const
+{
+    return m_lhs.is_scalar() ? m_rhs.size() : m_lhs.size();
+}
+
+template <class L, class R, class Op>
+bool cdata_binary_expr<L, R, Op>::is_scalar() const
+{
+    return m_lhs.is_scalar() && m_rhs.is_scalar();
+}
+
+template <class L, class R, class Op>
+typename cdata_binary_expr<L, R, Op>::value_type cdata_binary_expr<L, R, Op>::operator[](const size_t &i) const
+{
+    return Op()(m_lhs[i], m_rhs[i]);
+}
+
+template <class L, class R, class Op>
+void cdata_binary_expr<L, R, Op>::and_valid(cdata_mask &mask) const
+{
+    m_lhs.and_valid(mask);
+    m_rhs.and_valid(mask);
+}
+
+// ==================================================
+// UNARY EXPRESSION
+
+template <class E, class Op>
+cdata_unary_expr<E, Op>::cdata_unary_expr(const E &expr) : m_expr(expr) {}
+
+template <class E, class Op>
+size_t cdata_unary_expr<E, Op>::size() const
+{
+    return m_expr.size();
+}
+
+template <class E, class Op>
+bool cdata_unary_expr<E, Op>::is_scalar() const
+{
+    return m_expr.is_scalar();
+}
+
+template <class E, class Op>
+typename cdata_unary_expr<E, Op>::value_type cdata_unary_expr<E, Op>::operator[](const size_t &i) const
+{
+    return Op()(m_expr[i]);
+}
+
+template <class E, class Op>
+void cdata_unary_expr<E, Op>::and_valid(cdata_mask &mask) const
+{
+    m_expr.and_valid(mask);
+}
+
+// ==================================================
+// ARITHMETIC OPERATORS
+
+template <class L, class R>
+cdata_binary_expr<L, R, cdata_op_add> operator+(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return cdata_binary_expr<L, R, cdata_op_add>(lhs.self(), rhs.self());
+}
+
+template <class L>
+cdata_binary_expr<L, cdata_scalar<typename L::value_type>, cdata_op_add> operator+(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs + cdata_scalar<typename L::value_type>(rhs);
+}
+
+template <class R>
+cdata_binary_expr<cdata_scalar<typename R::value_type>, R, cdata_op_add> operator+(const typename R::value_type &lhs, const cdata_expression<R> &rhs)
+{
+    return cdata_scalar<typename R::value_type>(lhs) + rhs;
+}
+
+template <class L, class R>
+cdata_binary_expr<L, R, cdata_op_sub> operator-(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return cdata_binary_expr<L, R, cdata_op_sub>(lhs.self(), rhs.self());
+}
+
+template <class L>
+cdata_binary_expr<L, cdata_scalar<typename L::value_type>, cdata_op_sub> operator-(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs - cdata_scalar<typename L::value_type>(rhs);
+}
+
+template <class R>
+cdata_binary_expr<cdata_scalar<typename R::value_type>, R, cdata_op_sub> operator-(const typename R::value_type &lhs, const cdata_expression<R> &rhs)
+{
+    return cdata_scalar<typename R::value_type>(lhs) - rhs;
+}
+
+template <class L, class R>
+cdata_binary_expr<L, R, cdata_op_mul> operator*(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return cdata_binary_expr<L, R, cdata_op_mul>(lhs.self(), rhs.self());
+}
+
+template <class L>
+cdata_binary_expr<L, cdata_scalar<typename L::value_type>, cdata_op_mul> operator*(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs * cdata_scalar<typename L::value_type>(rhs);
+}
+
+template <class R>
+cdata_binary_expr<cdata_scalar<typename R::value_type>, R, cdata_op_mul> operator*(const typename R::value_type &lhs, const cdata_expression<R> &rhs)
+{
+    return cdata_scalar<typename R::value_type>(lhs) * rhs;
+}
+
+template <class L, class R>
+cdata_binary_expr<L, R, cdata_op_div> operator/(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return cdata_binary_expr<L, R, cdata_op_div>(lhs.self(), rhs.self());
+}
+
+template <class L>
+cdata_binary_expr<L, cdata_scalar<typename L::value_type>, cdata_op_div> operator/(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs / cdata_scalar<typename L::value_type>(rhs);
+}
+
+template <class R>
+cdata_binary_expr<cdata_scalar<typename R::value_type>, R, cdata_op_div> operator/(const typename R::value_type &lhs, const cdata_expression<R> &rhs)
+{
+    return cdata_scalar<typename R::value_type>(lhs) / rhs;
+}
+
+template <class E>
+cdata_unary_expr<E, cdata_op_neg> operator-(const cdata_expression<E> &expr)
+{
+    return cdata_unary_expr<E, cdata_op_neg>(expr.self());
+}
+
+// ==================================================
+// COMPARISON OPERATORS
+
+template <class L, class R>
+cdata_mask operator==(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return lhs.compare(rhs, cdata_op_equal());
+}
+
+template <class L>
+cdata_mask operator==(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs.compare(cdata_scalar<typename L::value_type>(rhs), cdata_op_equal());
+}
+
+template <class L, class R>
+cdata_mask operator!=(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return lhs.compare(rhs, cdata_op_not_equal());
+}
+
+template <class L>
+cdata_mask operator!=(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs.compare(cdata_scalar<typename L::value_type>(rhs), cdata_op_not_equal());
+}
+
+template <class L, class R>
+cdata_mask operator<(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return lhs.compare(rhs, cdata_op_less());
+}
+
+template <class L>
+cdata_mask operator<(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs.compare(cdata_scalar<typename L::value_type>(rhs), cdata_op_less());
+}
+
+template <class L, class R>
+cdata_mask operator<=(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return lhs.compare(rhs, cdata_op_less_equal());
+}
+
+template <class L>
+cdata_mask operator<=(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs.compare(cdata_scalar<typename L::value_type>(rhs), cdata_op_less_equal());
+}
+
+template <class L, class R>
+cdata_mask operator>(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return lhs.compare(rhs, cdata_op_greater());
+}
+
+template <class L>
+cdata_mask operator>(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs.compare(cdata_scalar<typename L::value_type>(rhs), cdata_op_greater());
+}
+
+template <class L, class R>
+cdata_mask operator>=(const cdata_expression<L> &lhs, const cdata_expression<R> &rhs)
+{
+    return lhs.compare(rhs, cdata_op_greater_equal());
+}
+
+template <class L>
+cdata_mask operator>=(const cdata_expression<L> &lhs, const typename L::value_type &rhs)
+{
+    return lhs.compare(cdata_scalar<typename L::value_type>(rhs), cdata_op_greater_equal());
+}
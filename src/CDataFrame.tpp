@@ -32,7 +32,14 @@ std::vector<std::string> cdata_frame<T>::__generate_uids(const size_t len, const
 template <class T>
 cdata_frame<T> cdata_frame<T>::copy() const
 {
-    return cdata_frame<T>(m_keys, cmatrix<T>::copy(), m_index);
+    CDATA_TRACE_SCOPE("copy");
+    CDATA_TRACE_COUNT(cmatrix<T>::height(), cmatrix<T>::height() * cmatrix<T>::width() * sizeof(T), 1);
+
+    cdata_frame<T> df(m_keys, cmatrix<T>::copy(), m_index);
+    df.m_valid = m_valid;
+    df.m_zones = m_zones;
+    df.m_zone_rows = m_zone_rows;
+    return df;
 }
 
 template <class T>
@@ -40,6 +47,8 @@ void cdata_frame<T>::clear()
 {
     m_keys.clear();
     m_index.clear();
+    m_valid.clear();
+    m_zones.clear();
     cmatrix<T>::clear();
 }
 
@@ -48,58 +57,72 @@ void cdata_frame<T>::clear()
 
 template <class T>
 template <class U>
-short unsigned int cdata_frame<T>::__stream_width(const std::vector<U> data, const int &initial) const
+void cdata_frame<T>::__format_cell(std::string &out, const U &val)
 {
-    // The maximum size initialised with the initial value in case of having headers
-    short unsigned int max_length = initial;
-
-    // Iterate over the rows to get the maximum size of each column
-    for (size_t i = 0; i < data.size(); i++)
-    {
-        // Get the size of the data
-        const short unsigned int &data_length = cdata_frame<T>::__count_characters(data[i]);
-
-        // Get the maximum size
-        max_length = std::max(max_length, data_length);
-    }
-
-    // Add 2 for the space between the data and the border
-    max_length += 2;
+    __format_cell(out, val, std::is_integral<U>(), std::is_floating_point<U>());
+}
 
-    return max_length;
+template <class T>
+void cdata_frame<T>::__format_cell(std::string &out, const std::string &val)
+{
+    out += val;
 }
 
 template <class T>
-std::vector<short unsigned int> cdata_frame<T>::__stream_widths_vec() const
+template <class U>
+void cdata_frame<T>::__format_cell(std::string &out, const U &val, std::true_type, std::false_type)
 {
-    // The size of the vector is the number of columns + 1 (for the index at the position 0)
-    const size_t size = cmatrix<T>::width() + 1;
-    std::vector<short unsigned int> widths(size, 0);
+    // The characters are printed as is, like std::ostream
+    if (sizeof(U) == 1)
+    {
+        out.push_back(static_cast<char>(val));
+        return;
+    }
 
-    // Add the width of the index
-    if (has_index())
-        widths[0] = __stream_width(m_index);
+    // Write the digits from the end of the buffer
+    char buffer[24];
+    char *end = buffer + sizeof(buffer);
+    char *p = end;
+
+    const bool negative = val < U(0);
+    unsigned long long u = negative ? 0ULL - static_cast<unsigned long long>(val) : static_cast<unsigned long long>(val);
 
-    // Iterate over the columns to get the maximum size of each column
-    for (size_t c = 1; c < size; c++)
+    do
     {
-        // If hasn't keys, the key size is 0
-        const size_t key_size = has_keys() ? m_keys[c - 1].size() : 0;
+        *--p = static_cast<char>('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
 
-        // Assign the maximum size of the column
-        widths[c] = __stream_width(cmatrix<T>::columns_vec(c - 1), key_size);
-    }
+    if (negative)
+        *--p = '-';
 
-    return widths;
+    out.append(p, end);
 }
 
 template <class T>
-std::string cdata_frame<T>::__print_border(const std::vector<short unsigned int> &widths, const std::string &start, const std::string &middle, const std::string &end, const std::string &line, const std::string &index) const
+template <class U>
+void cdata_frame<T>::__format_cell(std::string &out, const U &val, std::false_type, std::true_type)
+{
+    // Same format as the default of std::ostream
+    char buffer[32];
+    const int size = std::snprintf(buffer, sizeof(buffer), "%Lg", static_cast<long double>(val));
+    out.append(buffer, size);
+}
+
+template <class T>
+template <class U>
+void cdata_frame<T>::__format_cell(std::string &out, const U &val, std::false_type, std::false_type)
 {
     std::ostringstream os;
+    os << val;
+    out += os.str();
+}
 
+template <class T>
+void cdata_frame<T>::__print_border(std::string &out, const std::vector<size_t> &widths, const std::string &start, const std::string &middle, const std::string &end, const std::string &line, const std::string &index) const
+{
     // Print the start of the border (┌, ├ or └)
-    os << start;
+    out += start;
 
     // Iterate over the widths to print the middle of the border (┬, ┼ or ┴)
     for (size_t i = 0; i < widths.size(); i++)
@@ -108,131 +131,198 @@ std::string cdata_frame<T>::__print_border(const std::vector<short unsigned int>
         if (widths[i] == 0)
             continue;
 
-        // Print the middle
+        // Print the line
         for (size_t j = 0; j < widths[i]; j++)
-            os << line;
+            out += line;
 
         // Print the index border (╥, ╫ or ╨)
         if (i == 0 and not index.empty() && has_index())
-            os << index;
+            out += index;
 
         // Print the middle of the border (┬, ┼ or ┴)
         else if (i != widths.size() - 1)
-            os << middle;
+            out += middle;
     }
 
     // Print the end of the border (┐, ┤ or ┘)
-    os << end << std::endl;
-
-    return os.str();
+    out += end;
+    out += '\n';
 }
 
 template <class T>
-std::string cdata_frame<T>::__print_border_top(const std::vector<short unsigned int> &widths) const
+void cdata_frame<T>::__print_row(std::string &out, const std::vector<size_t> &widths, const std::string *cells, const std::string &index) const
 {
-    return __print_border(widths, "┌", "┬", "┐", "─", "╥");
-}
+    // Handle the print of the first column, depending on if has index, keys or not
+    // When the row is the header, the index is empty (display: '| |')
+    if (has_index())
+    {
+        out += "│ ";
+        out += index;
+        out.append(widths[0] - 2 - __count_characters(index), ' ');
+        out += " ║ ";
+    }
 
-template <class T>
-std::string cdata_frame<T>::__print_border_middle(const std::vector<short unsigned int> &widths) const
-{
-    return __print_border(widths, "├", "┼", "┤", "─", "╫");
-}
+    // If hasn't index, print the '| ' for the right border of the column (display: '| ')
+    else
+        out += "│ ";
 
-template <class T>
-std::string cdata_frame<T>::__print_border_bottom(const std::vector<short unsigned int> &widths) const
-{
-    return __print_border(widths, "└", "┴", "┘", "─", "╨");
+    // Handle the print of the rest of the columns, width[i] because the first column is the index
+    for (size_t i = 1; i < widths.size(); i++)
+    {
+        out += cells[i - 1];
+        out.append(widths[i] - 2 - __count_characters(cells[i - 1]), ' ');
+        out += " │ ";
+    }
+
+    out += '\n';
 }
 
 template <class T>
-template <class U>
-std::string cdata_frame<T>::__print_row(const std::vector<short unsigned int> &widths, const std::vector<U> &data, const std::string &index) const
+std::string cdata_frame<T>::__print(std::true_type, const unsigned int &n, const unsigned int &tail, const unsigned int &max_columns) const
 {
-    std::ostringstream os;
+    const std::string ellipsis = "…";
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
 
-    // Handle the print of the first column, depending on if has index, keys or not
-    // When the row is the header, the index is empty (display: '| |')
-    if (has_index() and index == "")
+    // The rows printed: the n first and the tail last, the others are replaced by one row of '…'
+    const size_t n_head = std::min(static_cast<size_t>(n), height);
+    const size_t n_tail = std::min(static_cast<size_t>(tail), height - n_head);
+    const bool skip_rows = n_head + n_tail < height && n_head + n_tail > 0;
+
+    std::vector<size_t> rows;
+    for (size_t r = 0; r < n_head; r++)
+        rows.push_back(r);
+    for (size_t r = height - n_tail; r < height; r++)
+        rows.push_back(r);
+
+    // The columns printed: all or the first and last halves of max_columns, the others are replaced by one column of '…'
+    std::vector<size_t> cols;
+    size_t skip_at = width + 1;
+
+    if (max_columns == 0 || width <= max_columns)
+        for (size_t c = 0; c < width; c++)
+            cols.push_back(c);
+
+    else
     {
-        std::string space = std::string(widths[0] - 2, ' ');
-        os << "│ " << space << " ║ ";
+        const size_t left = (max_columns + 1) / 2;
+
+        for (size_t c = 0; c < left; c++)
+            cols.push_back(c);
+        for (size_t c = width - max_columns / 2; c < width; c++)
+            cols.push_back(c);
+
+        skip_at = left;
     }
 
-    // If not the header, print the index (display: '| index |')
-    else if (has_index())
+    const size_t n_cols = cols.size() + (skip_at <= width ? 1 : 0);
+
+    // Format the header and the cells printed, only once
+    std::vector<std::string> header;
+    std::vector<std::string> labels;
+    std::vector<std::string> cells;
+    cells.reserve((rows.size() + 1) * n_cols);
+
+    for (size_t j = 0; j <= cols.size(); j++)
     {
-        std::string space = std::string(widths[0] - 2 - index.size(), ' ');
-        os << "│ " << index << space << " ║ ";
+        if (j == skip_at)
+            header.push_back(ellipsis);
+        if (j < cols.size())
+            header.push_back(has_keys() ? m_keys[cols[j]] : "");
     }
 
-    // If hasn't index, print the '| ' for the right border of the column (display: '| ')
-    else
-        os << "│ ";
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        // The row of '…' between the first and the last rows
+        if (skip_rows && i == n_head)
+        {
+            labels.push_back(ellipsis);
+            cells.insert(cells.end(), n_cols, ellipsis);
+        }
+
+        const size_t r = rows[i];
+        labels.push_back(has_index() ? m_index[r] : "");
 
-    // Handle the print of the rest of the columns
-    for (size_t i = 0; i < data.size(); i++)
+        for (size_t j = 0; j <= cols.size(); j++)
+        {
+            if (j == skip_at)
+                cells.push_back(ellipsis);
+            if (j == cols.size())
+                break;
+
+            // The missing cells are printed as NA
+            const cdata_mask *valid = __get_valid(cols[j]);
+            cells.push_back(std::string());
+
+            if (valid != nullptr && not valid->get(r))
+                cells.back() = "NA";
+            else
+                __format_cell(cells.back(), cmatrix<T>::cell(r, cols[j]));
+        }
+    }
+
+    if (skip_rows && n_tail == 0)
     {
-        // width[i + 1] because the first column is the index
-        std::string space = std::string(widths[i + 1] - cdata_frame<T>::__count_characters(data[i]) - 2, ' ');
+        labels.push_back(ellipsis);
+        cells.insert(cells.end(), n_cols, ellipsis);
+    }
 
-        // Print the element of the row
-        os << data[i] << space;
+    // Compute the widths from the cells printed, 2 for the space between the data and the border
+    std::vector<size_t> widths(n_cols + 1, 0);
 
-        // Print the '|' except for the last column
-        if (i < data.size())
-            os << " │ ";
+    // The empty label of the header is printed even if no row is printed
+    if (has_index())
+    {
+        widths[0] = __count_characters("") + 2;
+
+        for (const std::string &label : labels)
+            widths[0] = std::max(widths[0], __count_characters(label) + 2);
     }
 
-    os << std::endl;
+    for (size_t j = 0; j < n_cols; j++)
+    {
+        widths[j + 1] = (has_keys() ? __count_characters(header[j]) : 0) + 2;
 
-    return os.str();
-}
+        for (size_t i = 0; i < labels.size(); i++)
+            widths[j + 1] = std::max(widths[j + 1], __count_characters(cells[i * n_cols + j]) + 2);
+    }
 
-template <class T>
-std::string cdata_frame<T>::__print(std::true_type, const unsigned int &n) const
-{
-    std::ostringstream os;
+    // Reserve the buffer once, the borders are encoded on 3 bytes
+    size_t line_size = 8;
+    for (const size_t &w : widths)
+        line_size += 3 * (w + 1);
 
-    // Compute the widths for each column
-    std::vector<short unsigned int> columns_widths = __stream_widths_vec();
+    std::string out;
+    out.reserve(line_size * (2 * labels.size() + 4));
 
     // Print the top border
-    os << __print_border_top(columns_widths);
+    __print_border(out, widths, "┌", "┬", "┐", "─", "╥");
 
-    // Print header
+    // Print header, the index is empty because the header doesn't have index
     if (has_keys())
     {
-        // Index is empty because the header doesn't have index
-        os << __print_row(columns_widths, m_keys, "");
-
-        os << __print_border(columns_widths, "╞", "╪", "╡", "═", "╬");
+        __print_row(out, widths, header.data(), "");
+        __print_border(out, widths, "╞", "╪", "╡", "═", "╬");
     }
 
     // Print data
-    const size_t n_rows = std::min((size_t)n, cmatrix<T>::height());
-
-    for (size_t i = 0; i < n_rows; i++)
+    for (size_t i = 0; i < labels.size(); i++)
     {
-        // If has index, get the index of the row
-        const std::string index = has_index() ? m_index[i] : "";
-
-        // Print the row
-        os << __print_row(columns_widths, cmatrix<T>::rows_vec(i), index);
+        __print_row(out, widths, cells.data() + i * n_cols, labels[i]);
 
         // Print the middle line except for the last row
-        if (i != n_rows - 1)
-            os << __print_border_middle(columns_widths);
+        if (i != labels.size() - 1)
+            __print_border(out, widths, "├", "┼", "┤", "─", "╫");
     }
 
     // Print the bottom border
-    os << __print_border_bottom(columns_widths);
+    __print_border(out, widths, "└", "┴", "┘", "─", "╨");
 
-    return os.str();
+    return out;
 }
 
 template <class T>
-std::string cdata_frame<T>::__print(std::false_type, const unsigned int &n) const
+std::string cdata_frame<T>::__print(std::false_type, const unsigned int &n, const unsigned int &tail, const unsigned int &) const
 {
     std::ostringstream os;
 
@@ -252,17 +342,21 @@ std::string cdata_frame<T>::__print(std::false_type, const unsigned int &n) cons
 
     os << std::endl;
 
-    // Print the data
-    const size_t n_rows = std::min((size_t)n, cmatrix<T>::height());
+    // Print the data, the n first and the tail last rows
+    const size_t height = cmatrix<T>::height();
+    const size_t n_head = std::min((size_t)n, height);
+    const size_t n_tail = std::min((size_t)tail, height - n_head);
+    const size_t n_rows = n_head + n_tail;
     os << "Data  : [";
 
     for (size_t i = 0; i < n_rows; i++)
     {
+        const size_t r = i < n_head ? i : height - n_rows + i;
         os << "[ ";
 
         for (size_t j = 0; j < cmatrix<T>::width(); j++)
         {
-            os << cmatrix<T>::cell(i, j);
+            os << cmatrix<T>::cell(r, j);
 
             if (j != cmatrix<T>::width() - 1)
                 os << ", ";
@@ -280,19 +374,218 @@ std::string cdata_frame<T>::__print(std::false_type, const unsigned int &n) cons
 }
 
 template <class T>
-void cdata_frame<T>::print(const unsigned int &n) const
+void cdata_frame<T>::print(const unsigned int &n, const unsigned int &tail, const unsigned int &max_columns) const
 {
-    std::ostringstream os;
-    os << __print(std::integral_constant < bool, std::is_fundamental<T>::value or std::is_same<T, std::string>::value > {}, n);
-    std::cout << os.str();
+    std::cout << __print(std::integral_constant < bool, std::is_fundamental<T>::value or std::is_same<T, std::string>::value > {}, n, tail, max_columns);
 }
 
 template <class T>
-void cdata_frame<T>::info() const 
+void cdata_frame<T>::info(const bool &deep) const
 {
+    const cdata_memory_usage usage = memory_usage(deep);
+
     std::cout << "type of data: " << typeid(T).name() << std::endl;
     std::cout << "number of keys: " << m_keys.size() << std::endl;
     std::cout << "number of index: " << m_index.size() << std::endl;
     std::cout << "number of rows: " << cmatrix<T>::height() << std::endl;
     std::cout << "number of columns: " << cmatrix<T>::width() << std::endl;
-}
\ No newline at end of file
+
+    for (size_t c = 0; c < usage.columns.size(); c++)
+    {
+        const cdata_mask *valid = __get_valid(c);
+        const size_t n_valid = valid == nullptr ? cmatrix<T>::height() : valid->count();
+
+        std::cout << "column " << (has_keys() ? "'" + m_keys[c] + "'" : std::to_string(c))
+                  << ": " << n_valid << " non-null, " << usage.columns[c] << " bytes" << std::endl;
+    }
+
+    std::cout << "memory usage" << (deep ? " (deep)" : "") << ": " << usage.total << " bytes"
+              << " (index: " << usage.index
+              << ", keys: " << usage.keys
+              << ", bitmaps: " << usage.valid
+              << ", unused capacity: " << usage.slack << ")" << std::endl;
+}
+
+// ==================================================
+// MEMORY
+
+template <class T>
+template <class U>
+size_t cdata_frame<T>::__heap_size(const U &, size_t &)
+{
+    return 0;
+}
+
+template <class T>
+template <class C, class Traits, class Alloc>
+size_t cdata_frame<T>::__heap_size(const std::basic_string<C, Traits, Alloc> &val, size_t &slack)
+{
+    // A short string is stored in the object itself
+    const char *data = reinterpret_cast<const char *>(val.data());
+    const char *object = reinterpret_cast<const char *>(&val);
+
+    if (data >= object && data < object + sizeof(val))
+        return 0;
+
+    slack += (val.capacity() - val.size()) * sizeof(C);
+    return (val.capacity() + 1) * sizeof(C);
+}
+
+template <class T>
+size_t cdata_frame<T>::__labels_size(const std::vector<std::string> &labels, const bool &deep, size_t &slack)
+{
+    size_t bytes = labels.capacity() * sizeof(std::string);
+    slack += (labels.capacity() - labels.size()) * sizeof(std::string);
+
+    // The arguments of the template are given, their deduction crashes GCC 12 on some translation units
+    if (deep)
+        for (const std::string &label : labels)
+            bytes += __heap_size<char, std::char_traits<char>, std::allocator<char>>(label, slack);
+
+    return bytes;
+}
+
+template <class T>
+cdata_memory_usage cdata_frame<T>::memory_usage(const bool &deep) const
+{
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+
+    cdata_memory_usage usage;
+    usage.columns.assign(width, height * sizeof(T));
+
+    // Count the heap buffers of the cells, one column per thread
+    if (deep)
+    {
+        std::vector<size_t> slacks(width, 0);
+
+#pragma omp parallel for
+        for (size_t c = 0; c < width; c++)
+            for (size_t r = 0; r < height; r++)
+                usage.columns[c] += __heap_size(cmatrix<T>::cell(r, c), slacks[c]);
+
+        for (const size_t &slack : slacks)
+            usage.slack += slack;
+    }
+
+    usage.index = __labels_size(m_index, deep, usage.slack);
+    usage.keys = __labels_size(m_keys, deep, usage.slack);
+
+    usage.valid = m_valid.capacity() * sizeof(cdata_mask);
+    usage.slack += (m_valid.capacity() - m_valid.size()) * sizeof(cdata_mask);
+
+    for (const cdata_mask &valid : m_valid)
+    {
+        usage.valid += valid.m_words.capacity() * sizeof(uint64_t);
+        usage.slack += (valid.m_words.capacity() - valid.m_words.size()) * sizeof(uint64_t);
+    }
+
+    usage.total = sizeof(*this) + usage.index + usage.keys + usage.valid;
+    for (const size_t &bytes : usage.columns)
+        usage.total += bytes;
+
+    return usage;
+}
+
+// ==================================================
+// ARROW
+
+template <class T>
+void cdata_frame<T>::to_arrow(std::ostream &out) const
+{
+    __write_arrow(out, false);
+}
+
+template <class T>
+void cdata_frame<T>::write_arrow(const std::string &path) const
+{
+    std::ofstream file(path, std::ios::binary);
+
+    if (not file.is_open())
+        throw std::runtime_error("Failed to open the file.");
+
+    __write_arrow(file, true);
+}
+
+template <class T>
+void cdata_frame<T>::__write_arrow(std::ostream &out, const bool &file) const
+{
+    CDATA_TRACE_SCOPE("to_arrow");
+
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+
+    std::vector<cdata_arrow_field> fields;
+    std::vector<std::pair<std::string, std::string>> metadata;
+    std::vector<std::string> names(width);
+
+    for (size_t c = 0; c < width; c++)
+        names[c] = m_keys.empty() ? "" : m_keys[c];
+
+    // The index is the first column, restored by pandas from the metadata
+    if (has_index())
+    {
+        fields.push_back(cdata_arrow::field<std::string>(cdata_arrow::index_name()));
+        metadata.push_back(std::make_pair("pandas", cdata_arrow::pandas<T>(names)));
+    }
+
+    for (size_t c = 0; c < width; c++)
+        fields.push_back(cdata_arrow::field<T>(names[c]));
+
+    // The buffers of the single record batch
+    std::string body;
+    std::vector<cdata_arrow_buffer> buffers;
+    std::vector<std::pair<int64_t, int64_t>> nodes;
+
+    if (has_index())
+    {
+        cdata_arrow::append_column<std::string>(body, buffers, height, nullptr, [&](const size_t &r) -> const std::string &
+                                                { return m_index[r]; });
+        nodes.push_back(std::make_pair(height, 0));
+    }
+
+    for (size_t c = 0; c < width; c++)
+    {
+        const cdata_mask *valid = __get_valid(c);
+
+        cdata_arrow::append_column<T>(body, buffers, height, valid ? &valid->words() : nullptr, [&](const size_t &r) -> const T &
+                                      { return cmatrix<T>::cell(r, c); });
+        nodes.push_back(std::make_pair(height, valid ? height - valid->count() : 0));
+    }
+
+    // The file starts with the magic string, the positions of the blocks are from the start of the file
+    size_t pos = 0;
+
+    if (file)
+    {
+        out.write("ARROW1\0\0", 8);
+        pos += 8;
+    }
+
+    pos += cdata_arrow::write_message(out, cdata_arrow::schema(fields, metadata), "");
+
+    const size_t meta_len = cdata_arrow::write_message(out, cdata_arrow::record_batch(height, nodes, buffers, body.size()), body);
+    const std::vector<std::tuple<int64_t, int32_t, int64_t>> blocks(1, std::make_tuple(pos, meta_len, body.size()));
+
+    // The end of the stream
+    out.write("\xff\xff\xff\xff\0\0\0\0", 8);
+
+    if (file)
+    {
+        const std::string footer = cdata_arrow::footer(fields, metadata, blocks);
+        const int32_t footer_size = footer.size();
+        char size_bytes[4];
+
+        for (size_t k = 0; k < 4; k++)
+            size_bytes[k] = static_cast<char>((footer_size >> (8 * k)) & 0xff);
+
+        out.write(footer.data(), footer.size());
+        out.write(size_bytes, 4);
+        out.write("ARROW1", 6);
+    }
+
+    if (not out)
+        throw std::runtime_error("The data frame can't be written.");
+
+    CDATA_TRACE_COUNT(height, body.size(), fields.size());
+}
@@ -45,6 +45,18 @@ void cdata_frame<T>::__check_unique(const std::vector<std::string> &vec, const s
         throw std::invalid_argument("The " + label + " must be unique.");
 }
 
+template <class T>
+void cdata_frame<T>::__check_data(const cmatrix<T> &data) const
+{
+    // Check if the number of keys is different from the number of columns
+    if (not m_keys.empty() && data.width() != m_keys.size())
+        throw std::invalid_argument("The number of keys must be equal to the number of columns.");
+
+    // Check if the number of index is different from the number of rows
+    if (not m_index.empty() && data.height() != m_index.size())
+        throw std::invalid_argument("The number of index must be equal to the number of rows.");
+}
+
 // ==================================================
 // CHECK
 
@@ -58,4 +70,20 @@ template <class T>
 bool cdata_frame<T>::has_index() const
 {
     return not m_index.empty();
+}
+
+template <class T>
+bool cdata_frame<T>::has_na() const
+{
+    for (const cdata_mask &valid : m_valid)
+        if (not valid.all())
+            return true;
+
+    return false;
+}
+
+template <class T>
+bool cdata_frame<T>::has_zone_maps() const
+{
+    return m_zone_rows != 0;
 }
\ No newline at end of file
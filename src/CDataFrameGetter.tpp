@@ -24,6 +24,9 @@ std::vector<std::string> cdata_frame<T>::index() const
 template <class T>
 cmatrix<T> cdata_frame<T>::data() const
 {
+    CDATA_TRACE_SCOPE("data");
+    CDATA_TRACE_COUNT(cmatrix<T>::height(), cmatrix<T>::height() * cmatrix<T>::width() * sizeof(T), 1);
+
     return cmatrix<T>::copy();
 }
 
@@ -33,6 +36,9 @@ cmatrix<T> cdata_frame<T>::data() const
 template <class T>
 cmatrix<T> cdata_frame<T>::rows(const std::string &index) const
 {
+    CDATA_TRACE_SCOPE("rows");
+    CDATA_TRACE_COUNT(1, cmatrix<T>::width() * sizeof(T), 1);
+
     return cmatrix<T>::rows(__get_index_pos(index));
 }
 
@@ -45,6 +51,9 @@ cmatrix<T> cdata_frame<T>::rows(const std::initializer_list<std::string> &index)
 template <class T>
 cmatrix<T> cdata_frame<T>::rows(const std::vector<std::string> &index) const
 {
+    CDATA_TRACE_SCOPE("rows");
+    CDATA_TRACE_COUNT(index.size(), index.size() * cmatrix<T>::width() * sizeof(T), 1);
+
     // Store the ids of the index
     std::vector<size_t> rows;
 
@@ -58,6 +67,9 @@ cmatrix<T> cdata_frame<T>::rows(const std::vector<std::string> &index) const
 template <class T>
 cmatrix<T> cdata_frame<T>::columns(const std::string &key) const
 {
+    CDATA_TRACE_SCOPE("columns");
+    CDATA_TRACE_COUNT(cmatrix<T>::height(), cmatrix<T>::height() * sizeof(T), 1);
+
     return cmatrix<T>::columns(__get_key_pos(key));
 }
 
@@ -70,6 +82,9 @@ cmatrix<T> cdata_frame<T>::columns(const std::initializer_list<std::string> &key
 template <class T>
 cmatrix<T> cdata_frame<T>::columns(const std::vector<std::string> &keys) const
 {
+    CDATA_TRACE_SCOPE("columns");
+    CDATA_TRACE_COUNT(cmatrix<T>::height(), cmatrix<T>::height() * keys.size() * sizeof(T), 1);
+
     // Store the ids of the keys
     std::vector<size_t> columns;
 
@@ -89,15 +104,24 @@ cdata_frame<T> cdata_frame<T>::slice_rows(const std::string &start, const std::s
 template <class T>
 cdata_frame<T> cdata_frame<T>::slice_rows(const size_t &start, const size_t &end) const
 {
-    // Get the sub-dataframe
+    CDATA_TRACE_SCOPE("slice_rows");
+
+    // Get the sub-dataframe, the positions are checked before the rows are counted
     cmatrix<T> data = cmatrix<T>::slice_rows(start, end);
+    CDATA_TRACE_COUNT(data.height(), data.height() * data.width() * sizeof(T), 1);
 
     // Get the index of the rows of the sub-dataframe
     std::vector<std::string> index;
     if (has_index())
         index = std::vector<std::string>(m_index.begin() + start, m_index.begin() + end + 1);
 
-    return cdata_frame<T>(m_keys, data, index);
+    cdata_frame<T> df(m_keys, data, index);
+
+    // Slice the validity bitmaps
+    for (const cdata_mask &valid : m_valid)
+        df.m_valid.push_back(valid.slice(start, end));
+
+    return df;
 }
 
 template <class T>
@@ -109,15 +133,89 @@ cdata_frame<T> cdata_frame<T>::slice_columns(const std::string &start, const std
 template <class T>
 cdata_frame<T> cdata_frame<T>::slice_columns(const size_t &start, const size_t &end) const
 {
-    // Get the sub-dataframe
+    CDATA_TRACE_SCOPE("slice_columns");
+
+    // Get the sub-dataframe, the positions are checked before the cells are counted
     cmatrix<T> data = cmatrix<T>::slice_columns(start, end);
+    CDATA_TRACE_COUNT(data.height(), data.height() * data.width() * sizeof(T), 1);
 
     // Get the keys of the sub-dataframe
     std::vector<std::string> keys;
     if (has_keys())
         keys = std::vector<std::string>(m_keys.begin() + start, m_keys.begin() + end + 1);
 
-    return cdata_frame<T>(keys, data, m_index);
+    cdata_frame<T> df(keys, data, m_index);
+
+    // Get the validity bitmaps of the columns of the sub-dataframe
+    if (not m_valid.empty())
+        df.m_valid = std::vector<cdata_mask>(m_valid.begin() + start, m_valid.begin() + end + 1);
+
+    return df;
+}
+
+template <class T>
+cdata_column<T> cdata_frame<T>::col(const std::string &key) const
+{
+    return cdata_column<T>(*this, __get_key_pos(key));
+}
+
+template <class T>
+cdata_column<T> cdata_frame<T>::col(const size_t &pos) const
+{
+    return cdata_column<T>(*this, pos);
+}
+
+template <class T>
+T &cdata_frame<T>::cell(const size_t &row, const size_t &col)
+{
+    T &res = cmatrix<T>::cell(row, col);
+
+    // The value written through the reference is unknown, the block is read again by the range selections
+    if (col < m_zones.size())
+        m_zones[col].modify(row);
+
+    return res;
+}
+
+template <class T>
+const T &cdata_frame<T>::cell(const size_t &row, const size_t &col) const
+{
+    return cmatrix<T>::cell(row, col);
+}
+
+template <class T>
+const cdata_zone_map<T> &cdata_frame<T>::zone_map(const std::string &key) const
+{
+    const size_t pos = __get_key_pos(key);
+
+    if (m_zone_rows == 0)
+        throw std::runtime_error("The zone maps are not enabled.");
+
+    return m_zones[pos];
+}
+
+// ==================================================
+// MISSING VALUES
+
+template <class T>
+bool cdata_frame<T>::is_na(const size_t &row, const size_t &col) const
+{
+    if (row >= cmatrix<T>::height() || col >= cmatrix<T>::width())
+        throw std::out_of_range("The cell (" + std::to_string(row) + ", " + std::to_string(col) + ") is out of range.");
+
+    return not m_valid.empty() && not m_valid[col].get(row);
+}
+
+template <class T>
+cdata_mask cdata_frame<T>::isna(const std::string &key) const
+{
+    return ~__get_valid_mask(__get_key_pos(key));
+}
+
+template <class T>
+cdata_mask cdata_frame<T>::notna(const std::string &key) const
+{
+    return __get_valid_mask(__get_key_pos(key));
 }
 
 // ==================================================
@@ -150,3 +248,15 @@ size_t cdata_frame<T>::__get_index_pos(const std::string &index) const
     // Return the id of the index
     return it - m_index.begin();
 }
+
+template <class T>
+const cdata_mask *cdata_frame<T>::__get_valid(const size_t &pos) const
+{
+    return m_valid.empty() ? nullptr : &m_valid[pos];
+}
+
+template <class T>
+cdata_mask cdata_frame<T>::__get_valid_mask(const size_t &pos) const
+{
+    return m_valid.empty() ? cdata_mask(cmatrix<T>::height(), true) : m_valid[pos];
+}
@@ -12,6 +12,7 @@
 template <class T>
 void cdata_frame<T>::insert_row(const size_t &pos, const std::vector<T> &val, const std::string &index)
 {
+    // Not traced: the rows are inserted one by one, the batches that insert them are traced instead
     if (m_index.empty())
     {
         // User want insert an index
@@ -37,6 +38,12 @@ void cdata_frame<T>::insert_row(const size_t &pos, const std::vector<T> &val, co
     }
 
     cmatrix<T>::insert_row(pos, val);
+
+    // The new row has no missing cell
+    for (cdata_mask &valid : m_valid)
+        valid.insert(pos, true);
+
+    __zone_insert_row(pos);
 }
 
 template <class T>
@@ -67,6 +74,42 @@ void cdata_frame<T>::insert_column(const size_t &pos, const std::vector<T> &val,
     }
 
     cmatrix<T>::insert_column(pos, val);
+
+    // The new column has no missing cell
+    if (not m_valid.empty())
+        m_valid.insert(m_valid.begin() + pos, cdata_mask(cmatrix<T>::height(), true));
+
+    __build_zone_maps();
+}
+
+template <class T>
+template <class E>
+void cdata_frame<T>::insert_column(const size_t &pos, const cdata_expression<E> &expr, const std::string &key)
+{
+    // A constant expression is broadcast over the rows
+    const size_t n_rows = expr.self().is_scalar() ? cmatrix<T>::height() : expr.self().size();
+
+    // The expression may read the columns of this data frame, so it is evaluated before the columns move
+    // The rows are stored contiguously, not the columns: the values are then copied once into the rows
+    std::vector<T> val(n_rows);
+    expr.eval(val.data(), n_rows);
+
+    // The new cell is missing where a column read by the expression is
+    cdata_mask valid(n_rows, true);
+    expr.self().and_valid(valid);
+
+    insert_column(pos, val, key);
+
+    if (not valid.all())
+    {
+        __init_valid();
+
+        if (m_zone_rows != 0)
+            for (const size_t &row : (~valid).positions())
+                m_zones[pos].set_na(row);
+
+        m_valid[pos] = valid;
+    }
 }
 
 template <class T>
@@ -75,15 +118,30 @@ void cdata_frame<T>::concatenate(const cdata_frame<T> &df, const short unsigned
     if (this == &df)
         throw std::invalid_argument("Cannot concatenate a data frame with itself.");
 
+    CDATA_TRACE_SCOPE("concatenate");
+    CDATA_TRACE_COUNT(df.height(), df.height() * df.width() * sizeof(T), 0);
+
     // Axis 0: concatenate the rows
     if (axis == 0)
     {
         if (m_keys != df.m_keys)
             throw std::invalid_argument("The keys of the two data frames must be the same.");
 
+        const size_t height = cmatrix<T>::height();
+
         // Concatenate the matrix
         cmatrix<T>::concatenate(df, 0);
 
+        // Concatenate the validity bitmaps
+        if (not m_valid.empty() || not df.m_valid.empty())
+        {
+            if (m_valid.empty())
+                m_valid.assign(cmatrix<T>::width(), cdata_mask(height, true));
+
+            for (size_t c = 0; c < m_valid.size(); c++)
+                m_valid[c].append(df.__get_valid_mask(c));
+        }
+
         // Concatenate the index
         std::vector<std::string> index_merged = df.index();
         index_merged.insert(index_merged.begin(), m_index.begin(), m_index.end());
@@ -96,9 +154,21 @@ void cdata_frame<T>::concatenate(const cdata_frame<T> &df, const short unsigned
         if (m_index != df.m_index)
             throw std::invalid_argument("The indexes of the two data frames must be the same.");
 
+        const size_t width = cmatrix<T>::width();
+
         // Concatenate the matrix
         cmatrix<T>::concatenate(df, 1);
 
+        // Concatenate the validity bitmaps
+        if (not m_valid.empty() || not df.m_valid.empty())
+        {
+            if (m_valid.empty())
+                m_valid.assign(width, cdata_mask(cmatrix<T>::height(), true));
+
+            for (size_t c = 0; c < df.width(); c++)
+                m_valid.push_back(df.__get_valid_mask(c));
+        }
+
         // Concatenate the keys
         std::vector<std::string> keys_merged = df.keys();
         keys_merged.insert(keys_merged.begin(), m_keys.begin(), m_keys.end());
@@ -107,6 +177,8 @@ void cdata_frame<T>::concatenate(const cdata_frame<T> &df, const short unsigned
 
     else
         throw std::invalid_argument("Invalid axis. Axis must be 0 or 1.");
+
+    __build_zone_maps();
 }
 
 // ==================================================
@@ -136,6 +208,20 @@ void cdata_frame<T>::push_col_back(const std::vector<T> &val, const std::string
     insert_column(cmatrix<T>::width(), val, key);
 }
 
+template <class T>
+template <class E>
+void cdata_frame<T>::push_col_front(const cdata_expression<E> &expr, const std::string &key)
+{
+    insert_column(0, expr, key);
+}
+
+template <class T>
+template <class E>
+void cdata_frame<T>::push_col_back(const cdata_expression<E> &expr, const std::string &key)
+{
+    insert_column(cmatrix<T>::width(), expr, key);
+}
+
 // ==================================================
 // REMOVE
 
@@ -169,8 +255,25 @@ void cdata_frame<T>::remove_row(const std::string &index)
 template <class T>
 void cdata_frame<T>::remove_row(const size_t &pos)
 {
+    if (pos >= cmatrix<T>::height())
+        throw std::out_of_range("The row " + std::to_string(pos) + " is out of range.");
+
+    // The blocks of the zone maps shrink, their bounds still hold their values
+    if (m_zones.size() == cmatrix<T>::width())
+        for (size_t c = 0; c < m_zones.size(); c++)
+            m_zones[c].erase(pos, m_valid.empty() || m_valid[c].get(pos));
+
     cmatrix<T>::remove_row(pos);
     __remove_index(pos);
+
+    for (cdata_mask &valid : m_valid)
+        valid.erase(pos);
+
+    if (cmatrix<T>::is_empty())
+    {
+        m_valid.clear();
+        m_zones.clear();
+    }
 }
 
 template <class T>
@@ -185,4 +288,1178 @@ void cdata_frame<T>::remove_column(const size_t &pos)
 {
     cmatrix<T>::remove_column(pos);
     __remove_key(pos);
+
+    if (not m_valid.empty())
+        m_valid.erase(m_valid.begin() + pos);
+
+    if (pos < m_zones.size())
+        m_zones.erase(m_zones.begin() + pos);
+
+    if (cmatrix<T>::is_empty())
+    {
+        m_valid.clear();
+        m_zones.clear();
+    }
+}
+
+template <class T>
+void cdata_frame<T>::__init_valid()
+{
+    if (m_valid.empty())
+        m_valid.assign(cmatrix<T>::width(), cdata_mask(cmatrix<T>::height(), true));
+}
+
+template <class T>
+void cdata_frame<T>::remove_rows(const std::vector<size_t> &pos)
+{
+    cdata_mask keep(cmatrix<T>::height(), true);
+
+    for (const size_t &p : pos)
+    {
+        if (p >= keep.size())
+            throw std::out_of_range("The row " + std::to_string(p) + " is out of range.");
+
+        keep.set(p, false);
+    }
+
+    __compact_rows(keep);
+}
+
+template <class T>
+void cdata_frame<T>::remove_rows(const std::vector<std::string> &index)
+{
+    __compact_rows(~__find_labels(m_index, index, "index"));
+}
+
+template <class T>
+void cdata_frame<T>::remove_columns(const std::vector<size_t> &pos)
+{
+    cdata_mask keep(cmatrix<T>::width(), true);
+
+    for (const size_t &p : pos)
+    {
+        if (p >= keep.size())
+            throw std::out_of_range("The column " + std::to_string(p) + " is out of range.");
+
+        keep.set(p, false);
+    }
+
+    __compact_columns(keep);
+}
+
+template <class T>
+void cdata_frame<T>::remove_columns(const std::vector<std::string> &keys)
+{
+    __compact_columns(~__find_labels(m_keys, keys, "key"));
+}
+
+template <class T>
+cdata_mask cdata_frame<T>::__find_labels(const std::vector<std::string> &labels, const std::vector<std::string> &names, const std::string &label)
+{
+    // One pass over the labels instead of one search per name
+    std::unordered_map<std::string, bool> found;
+    for (const std::string &name : names)
+        found[name] = false;
+
+    cdata_mask mask(labels.size());
+    for (size_t i = 0; i < labels.size(); i++)
+    {
+        std::unordered_map<std::string, bool>::iterator it = found.find(labels[i]);
+
+        if (it != found.end())
+        {
+            mask.set(i);
+            it->second = true;
+        }
+    }
+
+    for (const std::string &name : names)
+        if (not found[name])
+            throw std::invalid_argument("The " + label + " '" + name + "' doesn't exist.");
+
+    return mask;
+}
+
+template <class T>
+void cdata_frame<T>::__compact_rows(const cdata_mask &keep)
+{
+    if (keep.all())
+        return;
+
+    // The rows are copied in one pass, see filter
+    cdata_frame<T> df = filter(keep);
+
+    if (df.is_empty())
+    {
+        cmatrix<T>::clear();
+        m_index.clear();
+        m_valid.clear();
+        m_zones.clear();
+        return;
+    }
+
+    // The matrix has no move assignment, the rows kept are copied once more
+    cmatrix<T>::operator=(df);
+    m_index = std::move(df.m_index);
+    m_valid = std::move(df.m_valid);
+    __build_zone_maps();
+}
+
+template <class T>
+void cdata_frame<T>::__compact_columns(const cdata_mask &keep)
+{
+    if (keep.all())
+        return;
+
+    const std::vector<size_t> cols = keep.positions();
+
+    if (cols.empty())
+    {
+        cmatrix<T>::clear();
+        m_keys.clear();
+        m_index.clear();
+        m_valid.clear();
+        m_zones.clear();
+        return;
+    }
+
+    const size_t height = cmatrix<T>::height();
+    cmatrix<T> data(height, cols.size());
+
+    // Each row is compacted independently, the removed cells are dropped
+#pragma omp parallel for
+    for (size_t r = 0; r < height; r++)
+        for (size_t c = 0; c < cols.size(); c++)
+            data.cell(r, c) = std::move(cmatrix<T>::cell(r, cols[c]));
+
+    // The matrix has no move assignment, the columns kept are copied once more
+    cmatrix<T>::operator=(data);
+
+    for (size_t c = 0; c < cols.size(); c++)
+    {
+        if (cols[c] == c)
+            continue;
+
+        if (not m_keys.empty())
+            m_keys[c] = std::move(m_keys[cols[c]]);
+
+        if (not m_valid.empty())
+            m_valid[c] = std::move(m_valid[cols[c]]);
+    }
+
+    if (not m_keys.empty())
+        m_keys.resize(cols.size());
+
+    if (not m_valid.empty())
+        m_valid.resize(cols.size());
+
+    __build_zone_maps();
+}
+
+// ==================================================
+// FILTER
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::filter(const cdata_mask &mask) const
+{
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+
+    if (mask.size() != height)
+        throw std::invalid_argument("The size of the mask must be equal to the number of rows. Actual: " +
+                                    std::to_string(mask.size()) +
+                                    ", Expected: " +
+                                    std::to_string(height) +
+                                    ".");
+
+    // Prefix sum of the number of rows selected by each word: the output position of its first row
+    const std::vector<uint64_t> &words = mask.words();
+    std::vector<size_t> offsets(words.size() + 1, 0);
+
+    for (size_t w = 0; w < words.size(); w++)
+        offsets[w + 1] = offsets[w] + cdata_mask::popcount(words[w]);
+
+    const size_t n_rows = offsets.back();
+
+    // If no row is selected, the data frame is empty
+    cdata_frame<T> df;
+    if (n_rows == 0)
+        return df;
+
+    // Allocate the data and the index once
+    df.set_data(cmatrix<T>(n_rows, width));
+    df.m_keys = m_keys;
+
+    if (has_index())
+        df.m_index.resize(n_rows);
+
+    // Each word writes a disjoint range of the output, so the words are copied in parallel
+#pragma omp parallel for
+    for (size_t w = 0; w < words.size(); w++)
+    {
+        size_t out = offsets[w];
+
+        for (uint64_t bits = words[w]; bits != 0; bits &= bits - 1, out++)
+        {
+            const size_t row = w * cdata_mask::word_bits + cdata_mask::lowest_bit(bits);
+
+            for (size_t c = 0; c < width; c++)
+                df.cell(out, c) = cmatrix<T>::cell(row, c);
+
+            if (has_index())
+                df.m_index[out] = m_index[row];
+        }
+    }
+
+    // Compact the validity bitmaps, one column per thread since several rows share a word
+    if (not m_valid.empty())
+    {
+        df.m_valid.assign(width, cdata_mask(n_rows));
+
+#pragma omp parallel for
+        for (size_t c = 0; c < width; c++)
+        {
+            const std::vector<uint64_t> &valid = m_valid[c].m_words;
+            std::vector<uint64_t> &out_valid = df.m_valid[c].m_words;
+            size_t out = 0;
+
+            for (size_t w = 0; w < words.size(); w++)
+                for (uint64_t bits = words[w]; bits != 0; bits &= bits - 1, out++)
+                {
+                    const size_t row = w * cdata_mask::word_bits + cdata_mask::lowest_bit(bits);
+                    const uint64_t bit = (valid[w] >> (row % cdata_mask::word_bits)) & 1;
+                    out_valid[out / cdata_mask::word_bits] |= bit << (out % cdata_mask::word_bits);
+                }
+        }
+    }
+
+    return df;
+}
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::dropna() const
+{
+    // Keep the rows where every cell is valid
+    cdata_mask keep(cmatrix<T>::height(), true);
+
+    for (const cdata_mask &valid : m_valid)
+        keep &= valid;
+
+    return filter(keep);
+}
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::fillna(const T &val) const
+{
+    cdata_frame<T> df = copy();
+
+#pragma omp parallel for
+    for (size_t c = 0; c < m_valid.size(); c++)
+        for (const size_t &row : (~m_valid[c]).positions())
+            df.cmatrix<T>::cell(row, c) = val;
+
+    df.m_valid.clear();
+
+    // The zone maps copied count the cells filled as missing
+    df.__build_zone_maps();
+
+    return df;
+}
+
+// ==================================================
+// ZONE MAP
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::select_between(const std::string &key, const T &lo, const T &hi) const
+{
+    CDATA_TRACE_SCOPE("select_between");
+
+    const size_t col = __get_key_pos(key);
+    const size_t height = cmatrix<T>::height();
+    const cdata_mask *valid = __get_valid(col);
+
+    cdata_mask keep(height);
+    size_t n_read = 0;
+
+    // Mark the rows of a range of rows whose cell is in the range
+    auto scan = [&](const size_t &start, const size_t &end)
+    {
+        for (size_t r = start; r < end; r++)
+        {
+            const T &val = cmatrix<T>::cell(r, col);
+
+            if ((valid == nullptr || valid->get(r)) && not(val < lo) && not(hi < val))
+                keep.set(r);
+        }
+
+        n_read += end - start;
+    };
+
+    if (m_zone_rows == 0)
+        scan(0, height);
+
+    else
+    {
+        const cdata_zone_map<T> &zone = m_zones[col];
+
+        for (size_t b = 0; b < zone.n_blocks(); b++)
+        {
+            // A block inside the range is selected without reading its cells
+            if (zone.contains_all(b, lo, hi))
+                for (size_t r = zone.start(b); r < zone.end(b); r++)
+                    keep.set(r);
+
+            else if (zone.may_contain(b, lo, hi))
+                scan(zone.start(b), zone.end(b));
+        }
+    }
+
+    CDATA_TRACE_COUNT(n_read, n_read * sizeof(T), 0);
+
+    return filter(keep);
+}
+
+template <class T>
+void cdata_frame<T>::build_zone_maps(const size_t &block_rows, const unsigned int &n_threads)
+{
+    if (block_rows == 0)
+        throw std::invalid_argument("The blocks must have at least one row.");
+
+    m_zone_rows = block_rows;
+    __build_zone_maps(n_threads);
+}
+
+template <class T>
+void cdata_frame<T>::drop_zone_maps()
+{
+    m_zone_rows = 0;
+    m_zones.clear();
+}
+
+template <class T>
+void cdata_frame<T>::__build_zone_maps(const unsigned int &n_threads)
+{
+    if (m_zone_rows == 0)
+        return;
+
+    CDATA_TRACE_SCOPE("build_zone_maps");
+
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+
+    m_zones.assign(width, cdata_zone_map<T>(m_zone_rows));
+
+    // Each column is read by one thread
+#pragma omp parallel for num_threads(__n_threads(n_threads))
+    for (size_t c = 0; c < width; c++)
+    {
+        const cdata_mask *valid = __get_valid(c);
+
+        m_zones[c].build(height, [&](const size_t &r) -> const T &
+                         { return cmatrix<T>::cell(r, c); },
+                         [&](const size_t &r)
+                         { return valid == nullptr || valid->get(r); });
+    }
+
+    CDATA_TRACE_COUNT(height, height * width * sizeof(T), width);
+}
+
+template <class T>
+void cdata_frame<T>::__zone_insert_row(const size_t &pos)
+{
+    if (m_zone_rows == 0)
+        return;
+
+    // The zone maps of a data frame cleared are computed from its first row
+    if (m_zones.size() != cmatrix<T>::width())
+    {
+        __build_zone_maps();
+        return;
+    }
+
+    for (size_t c = 0; c < m_zones.size(); c++)
+    {
+        const cdata_mask *valid = __get_valid(c);
+
+        m_zones[c].insert(pos, [&](const size_t &r) -> const T &
+                          { return cmatrix<T>::cell(r, c); },
+                          [&](const size_t &r)
+                          { return valid == nullptr || valid->get(r); });
+    }
+}
+
+// ==================================================
+// APPLY
+
+template <class T>
+int cdata_frame<T>::__n_threads(const unsigned int &n_threads)
+{
+#ifdef _OPENMP
+    return n_threads == 0 ? omp_get_max_threads() : n_threads;
+#else
+    return 1;
+#endif
+}
+
+template <class T>
+template <class Function>
+void cdata_frame<T>::__parallel_for(const size_t &n, const unsigned int &n_threads, Function body)
+{
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+
+#pragma omp parallel for schedule(static) num_threads(__n_threads(n_threads))
+    for (size_t i = 0; i < n; i++)
+    {
+        // The loop can't be left, the positions after an exception are skipped
+        if (failed.load(std::memory_order_relaxed))
+            continue;
+
+        try
+        {
+            body(i);
+        }
+        catch (...)
+        {
+#pragma omp critical(cdata_parallel_for)
+            if (not failed.exchange(true))
+                error = std::current_exception();
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+template <class T>
+template <class Function>
+cdata_frame<T> cdata_frame<T>::map(Function fn, const unsigned int &n_threads) const
+{
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+
+    if (cmatrix<T>::is_empty())
+        return copy();
+
+    cdata_frame<T> df;
+    df.set_data(cmatrix<T>(height, width));
+    df.m_keys = m_keys;
+    df.m_index = m_index;
+    df.m_valid = m_valid;
+
+    // Each thread writes its own rows, so the result doesn't depend on the number of threads
+    __parallel_for(height, n_threads, [&](const size_t &r)
+                   { for (size_t c = 0; c < width; c++)
+                         df.cmatrix<T>::cell(r, c) = fn(cmatrix<T>::cell(r, c)); });
+
+    return df;
+}
+
+template <class T>
+template <class Function>
+cdata_frame<T> cdata_frame<T>::transform(Function fn, const short unsigned int &axis, const unsigned int &n_threads) const
+{
+    if (axis != 0 && axis != 1)
+        throw std::invalid_argument("Invalid axis. Axis must be 0 or 1.");
+
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+    const size_t n = axis == 0 ? width : height;
+    const size_t len = axis == 0 ? height : width;
+
+    if (cmatrix<T>::is_empty())
+        return copy();
+
+    // The results are kept until all of them are checked, the exceptions can't leave a parallel region
+    std::vector<std::vector<T>> res(n);
+
+    __parallel_for(n, n_threads, [&](const size_t &i)
+                   { res[i] = fn(axis == 0 ? cmatrix<T>::columns_vec(i) : cmatrix<T>::rows_vec(i)); });
+
+    for (size_t i = 0; i < n; i++)
+        if (res[i].size() != len)
+            throw std::invalid_argument("The function must keep the size of the " +
+                                        std::string(axis == 0 ? "column" : "row") +
+                                        " " +
+                                        std::to_string(i) +
+                                        ". Actual: " +
+                                        std::to_string(res[i].size()) +
+                                        ", Expected: " +
+                                        std::to_string(len) +
+                                        ".");
+
+    cdata_frame<T> df;
+    df.set_data(cmatrix<T>(height, width));
+    df.m_keys = m_keys;
+    df.m_index = m_index;
+    df.m_valid = m_valid;
+
+#pragma omp parallel for schedule(static) num_threads(__n_threads(n_threads))
+    for (size_t r = 0; r < height; r++)
+        for (size_t c = 0; c < width; c++)
+            df.cell(r, c) = std::move(axis == 0 ? res[c][r] : res[r][c]);
+
+    return df;
+}
+
+template <class T>
+template <class Function, class R>
+std::vector<R> cdata_frame<T>::apply(Function fn, const short unsigned int &axis, const unsigned int &n_threads) const
+{
+    if (axis != 0 && axis != 1)
+        throw std::invalid_argument("Invalid axis. Axis must be 0 or 1.");
+
+    const size_t n = axis == 0 ? cmatrix<T>::width() : cmatrix<T>::height();
+
+    // Each result is written at the position of its column or row, in an array since std::vector<bool> shares its words
+    std::unique_ptr<R[]> res(new R[n]);
+
+    __parallel_for(n, n_threads, [&](const size_t &i)
+                   { res[i] = fn(axis == 0 ? cmatrix<T>::columns_vec(i) : cmatrix<T>::rows_vec(i)); });
+
+    return std::vector<R>(std::make_move_iterator(res.get()), std::make_move_iterator(res.get() + n));
+}
+
+// ==================================================
+// DUPLICATES
+
+template <class T>
+std::vector<T> cdata_frame<T>::unique(const std::string &key, const unsigned int &n_threads) const
+{
+    const size_t pos = __get_key_pos(key);
+    const std::vector<size_t> first = __first_duplicates({pos}, n_threads);
+    const cdata_mask *valid = __get_valid(pos);
+
+    std::vector<T> res;
+
+    for (size_t r = 0; r < first.size(); r++)
+        if (first[r] == r && (valid == nullptr || valid->get(r)))
+            res.push_back(cmatrix<T>::cell(r, pos));
+
+    return res;
+}
+
+template <class T>
+std::vector<std::pair<T, size_t>> cdata_frame<T>::value_counts(const std::string &key, const unsigned int &n_threads) const
+{
+    const size_t pos = __get_key_pos(key);
+    const std::vector<size_t> first = __first_duplicates({pos}, n_threads);
+    const cdata_mask *valid = __get_valid(pos);
+
+    // Each row is counted in its first row
+    std::vector<size_t> counts(first.size(), 0);
+    for (const size_t &r : first)
+        counts[r]++;
+
+    std::vector<std::pair<T, size_t>> res;
+
+    for (size_t r = 0; r < first.size(); r++)
+        if (first[r] == r && (valid == nullptr || valid->get(r)))
+            res.push_back(std::make_pair(cmatrix<T>::cell(r, pos), counts[r]));
+
+    std::stable_sort(res.begin(), res.end(), [](const std::pair<T, size_t> &a, const std::pair<T, size_t> &b)
+                     { return a.second > b.second; });
+
+    return res;
+}
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::drop_duplicates(const std::vector<std::string> &keys, const unsigned int &n_threads) const
+{
+    std::vector<size_t> cols;
+
+    if (keys.empty())
+        for (size_t c = 0; c < cmatrix<T>::width(); c++)
+            cols.push_back(c);
+
+    for (const std::string &key : keys)
+        cols.push_back(__get_key_pos(key));
+
+    const std::vector<size_t> first = __first_duplicates(cols, n_threads);
+
+    return filter(cdata_mask::from_predicate(first.size(), [&](const size_t &r)
+                                             { return first[r] == r; }));
+}
+
+template <class T>
+template <class U>
+uint64_t cdata_frame<T>::__hash_cell(const U &val)
+{
+    return std::hash<U>()(val);
+}
+
+template <class T>
+uint64_t cdata_frame<T>::__hash_cell(const cdata_string &val)
+{
+    uint64_t h = 0xcbf29ce484222325;
+
+    for (const char &c : val)
+        h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3;
+
+    return h;
+}
+
+template <class T>
+std::vector<size_t> cdata_frame<T>::__first_duplicates(const std::vector<size_t> &cols, const unsigned int &n_threads) const
+{
+    const size_t height = cmatrix<T>::height();
+
+    std::vector<const cdata_mask *> valid(cols.size());
+    for (size_t i = 0; i < cols.size(); i++)
+        valid[i] = __get_valid(cols[i]);
+
+    // Hash each row over the columns, a missing cell has its own hash
+    std::vector<uint64_t> hashes(height);
+
+#pragma omp parallel for schedule(static) num_threads(__n_threads(n_threads))
+    for (size_t r = 0; r < height; r++)
+    {
+        uint64_t h = 0;
+
+        for (size_t i = 0; i < cols.size(); i++)
+        {
+            const bool is_valid = valid[i] == nullptr || valid[i]->get(r);
+            h = (h ^ (is_valid ? __hash_cell(cmatrix<T>::cell(r, cols[i])) : 0x9e3779b9)) * 0x9e3779b97f4a7c15;
+        }
+
+        // Mix the bits (splitmix64): the partitions use the high bits and the tables the low bits
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111eb;
+        hashes[r] = h ^ (h >> 31);
+    }
+
+    auto equal = [&](const size_t &a, const size_t &b)
+    {
+        for (size_t i = 0; i < cols.size(); i++)
+        {
+            const bool valid_a = valid[i] == nullptr || valid[i]->get(a);
+            const bool valid_b = valid[i] == nullptr || valid[i]->get(b);
+
+            if (valid_a != valid_b || (valid_a && not(cmatrix<T>::cell(a, cols[i]) == cmatrix<T>::cell(b, cols[i]))))
+                return false;
+        }
+
+        return true;
+    };
+
+    // Split the rows in partitions by the high bits of their hash, keeping their order (counting sort)
+    const size_t part_bits = height < (1 << 16) ? 0 : 6;
+    const size_t n_parts = size_t(1) << part_bits;
+
+    auto part = [&](const size_t &r)
+    { return part_bits == 0 ? 0 : hashes[r] >> (64 - part_bits); };
+
+    std::vector<size_t> offsets(n_parts + 1, 0);
+    for (size_t r = 0; r < height; r++)
+        offsets[part(r) + 1]++;
+
+    for (size_t p = 0; p < n_parts; p++)
+        offsets[p + 1] += offsets[p];
+
+    std::vector<size_t> rows(height);
+    std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+    for (size_t r = 0; r < height; r++)
+        rows[next[part(r)]++] = r;
+
+    // Deduplicate each partition in its own table, the rows equal to a row are in the same partition
+    std::vector<size_t> first(height);
+
+#pragma omp parallel for schedule(dynamic) num_threads(__n_threads(n_threads))
+    for (size_t p = 0; p < n_parts; p++)
+    {
+        const size_t n = offsets[p + 1] - offsets[p];
+
+        // Open addressing with linear probing, the table is at most half full
+        size_t capacity = 1;
+        while (capacity < 2 * n)
+            capacity <<= 1;
+
+        const size_t mask = capacity - 1;
+        std::vector<size_t> slots(n == 0 ? 0 : capacity, height);
+
+        for (size_t i = offsets[p]; i < offsets[p + 1]; i++)
+        {
+            const size_t r = rows[i];
+            size_t s = hashes[r] & mask;
+
+            while (slots[s] != height && not(hashes[slots[s]] == hashes[r] && equal(slots[s], r)))
+                s = (s + 1) & mask;
+
+            if (slots[s] == height)
+                slots[s] = r;
+
+            first[r] = slots[s];
+        }
+    }
+
+    return first;
+}
+
+// ==================================================
+// RESHAPE
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::pivot(const std::string &index, const std::string &columns, const std::string &values) const
+{
+    const size_t val_pos = __get_key_pos(values);
+
+    // The size of the result is known before it is allocated
+    std::vector<std::string> index_labels;
+    std::vector<std::string> keys_labels;
+    const std::vector<size_t> rows = __label_ids(__get_key_pos(index), index_labels);
+    const std::vector<size_t> cols = __label_ids(__get_key_pos(columns), keys_labels);
+
+    cdata_frame<T> df;
+    if (index_labels.empty() || keys_labels.empty())
+        return df;
+
+    df.set_data(cmatrix<T>(index_labels.size(), keys_labels.size()));
+    df.m_keys = keys_labels;
+    df.m_index = index_labels;
+
+    // Every pair is missing until a valid value is scattered in it
+    std::vector<cdata_mask> seen(keys_labels.size(), cdata_mask(index_labels.size()));
+    std::vector<cdata_mask> filled(keys_labels.size(), cdata_mask(index_labels.size()));
+    const cdata_mask *valid = __get_valid(val_pos);
+
+    for (size_t r = 0; r < rows.size(); r++)
+    {
+        if (rows[r] == std::string::npos || cols[r] == std::string::npos)
+            continue;
+
+        if (seen[cols[r]].get(rows[r]))
+            throw std::invalid_argument("The pair ('" + index_labels[rows[r]] + "', '" + keys_labels[cols[r]] + "') has several rows, use 'pivot_table'.");
+
+        seen[cols[r]].set(rows[r]);
+
+        if (valid == nullptr || valid->get(r))
+        {
+            df.cell(rows[r], cols[r]) = cmatrix<T>::cell(r, val_pos);
+            filled[cols[r]].set(rows[r]);
+        }
+    }
+
+    for (const cdata_mask &mask : filled)
+        if (not mask.all())
+        {
+            df.m_valid = filled;
+            break;
+        }
+
+    return df;
+}
+
+template <class T>
+cdata_frame<double> cdata_frame<T>::pivot_table(const std::string &index, const std::string &columns, const std::string &values, const std::string &aggfunc) const
+{
+    static_assert(std::is_arithmetic<T>::value, "The aggregations need a numeric data frame.");
+
+    const std::vector<std::string> funcs = {"count", "sum", "mean", "min", "max"};
+    const size_t func = std::find(funcs.begin(), funcs.end(), aggfunc) - funcs.begin();
+
+    if (func == funcs.size())
+        throw std::invalid_argument("The function '" + aggfunc + "' doesn't exist.");
+
+    const size_t val_pos = __get_key_pos(values);
+
+    std::vector<std::string> index_labels;
+    std::vector<std::string> keys_labels;
+    const std::vector<size_t> rows = __label_ids(__get_key_pos(index), index_labels);
+    const std::vector<size_t> cols = __label_ids(__get_key_pos(columns), keys_labels);
+
+    cdata_frame<double> df;
+    if (index_labels.empty() || keys_labels.empty())
+        return df;
+
+    // The accumulators of each pair, stored by rows like the result
+    const size_t n_rows = index_labels.size();
+    const size_t n_cols = keys_labels.size();
+    const double init = func == 3 ? std::numeric_limits<double>::infinity() : func == 4 ? -std::numeric_limits<double>::infinity() : 0;
+
+    std::vector<double> acc(n_rows * n_cols, init);
+    std::vector<size_t> counts(n_rows * n_cols, 0);
+    const cdata_mask *valid = __get_valid(val_pos);
+
+    for (size_t r = 0; r < rows.size(); r++)
+    {
+        if (rows[r] == std::string::npos || cols[r] == std::string::npos || (valid != nullptr && not valid->get(r)))
+            continue;
+
+        const size_t i = rows[r] * n_cols + cols[r];
+        const double x = static_cast<double>(cmatrix<T>::cell(r, val_pos));
+
+        counts[i]++;
+
+        if (func == 1 || func == 2)
+            acc[i] += x;
+        else if (func == 3)
+            acc[i] = std::min(acc[i], x);
+        else if (func == 4)
+            acc[i] = std::max(acc[i], x);
+    }
+
+    df.set_data(cmatrix<double>(n_rows, n_cols));
+    df.m_keys = keys_labels;
+    df.m_index = index_labels;
+
+    for (size_t r = 0; r < n_rows; r++)
+        for (size_t c = 0; c < n_cols; c++)
+        {
+            const size_t i = r * n_cols + c;
+
+            // A pair without valid value is missing, except for the count
+            if (func != 0 && counts[i] == 0)
+            {
+                df.__init_valid();
+                df.m_valid[c].set(r, false);
+            }
+            else
+                df.cell(r, c) = func == 0 ? counts[i] : func == 2 ? acc[i] / counts[i] : acc[i];
+        }
+
+    return df;
+}
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::melt(const std::vector<std::string> &id_keys, const std::vector<std::string> &value_keys, const std::string &var_name, const std::string &value_name) const
+{
+    std::vector<size_t> ids;
+    for (const std::string &key : id_keys)
+        ids.push_back(__get_key_pos(key));
+
+    // By default, every column that is not an identifier is melted
+    std::vector<std::string> vars = value_keys;
+    if (vars.empty())
+        for (const std::string &key : m_keys)
+            if (std::find(id_keys.begin(), id_keys.end(), key) == id_keys.end())
+                vars.push_back(key);
+
+    std::vector<size_t> vals;
+    for (const std::string &key : vars)
+        vals.push_back(__get_key_pos(key));
+
+    const size_t height = cmatrix<T>::height();
+    const size_t n_ids = ids.size();
+
+    cdata_frame<T> df;
+    if (height == 0 || vals.empty())
+        return df;
+
+    // Allocate the result once: the identifiers, the variable and the value
+    df.set_data(cmatrix<T>(height * vals.size(), n_ids + 2));
+    df.m_keys = id_keys;
+    df.m_keys.push_back(var_name);
+    df.m_keys.push_back(value_name);
+
+    // Each variable writes its own block of rows
+#pragma omp parallel for
+    for (size_t v = 0; v < vals.size(); v++)
+    {
+        const T variable = __melt_variable(vars[v], v, std::is_constructible<T, std::string>());
+        const size_t start = v * height;
+
+        for (size_t r = 0; r < height; r++)
+        {
+            for (size_t i = 0; i < n_ids; i++)
+                df.cell(start + r, i) = cmatrix<T>::cell(r, ids[i]);
+
+            df.cell(start + r, n_ids) = variable;
+            df.cell(start + r, n_ids + 1) = cmatrix<T>::cell(r, vals[v]);
+        }
+    }
+
+    // The validity bitmaps are repeated for each variable
+    if (not m_valid.empty())
+    {
+        df.m_valid.assign(n_ids + 2, cdata_mask());
+
+        for (size_t v = 0; v < vals.size(); v++)
+        {
+            for (size_t i = 0; i < n_ids; i++)
+                df.m_valid[i].append(m_valid[ids[i]]);
+
+            df.m_valid[n_ids].append(cdata_mask(height, true));
+            df.m_valid[n_ids + 1].append(m_valid[vals[v]]);
+        }
+    }
+
+    return df;
+}
+
+template <class T>
+std::vector<size_t> cdata_frame<T>::__label_ids(const size_t &pos, std::vector<std::string> &labels) const
+{
+    const size_t height = cmatrix<T>::height();
+    const cdata_mask *valid = __get_valid(pos);
+
+    // The rows are grouped by the values of their cells, only the first row of a value is formatted
+    const std::vector<size_t> first = __first_duplicates({pos}, 0);
+
+    std::unordered_map<std::string, size_t> ids;
+    std::vector<size_t> res(height, std::string::npos);
+    std::string label;
+
+    for (size_t r = 0; r < height; r++)
+    {
+        if (valid != nullptr && not valid->get(r))
+            continue;
+
+        if (first[r] != r)
+        {
+            res[r] = res[first[r]];
+            continue;
+        }
+
+        // The values not equal to themselves (NaN) share their label
+        label.clear();
+        __convert(cmatrix<T>::cell(r, pos), label);
+
+        const std::pair<std::unordered_map<std::string, size_t>::iterator, bool> it = ids.insert(std::make_pair(label, labels.size()));
+        if (it.second)
+            labels.push_back(label);
+
+        res[r] = it.first->second;
+    }
+
+    return res;
+}
+
+template <class T>
+T cdata_frame<T>::__melt_variable(const std::string &key, const size_t &, std::true_type)
+{
+    return T(key);
+}
+
+template <class T>
+T cdata_frame<T>::__melt_variable(const std::string &, const size_t &pos, std::false_type)
+{
+    return static_cast<T>(pos);
+}
+
+// ==================================================
+// TRANSPOSE
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::transpose(const unsigned int &n_threads) const
+{
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+    const size_t tile = 32;
+
+    cdata_frame<T> df;
+    if (height == 0 || width == 0)
+        return df;
+
+    df.set_data(cmatrix<T>(width, height));
+    df.m_keys = m_index;
+    df.m_index = m_keys;
+    df.m_valid = __transpose_valid();
+
+    // A tile is read by rows and written by columns, both fit in the cache
+#pragma omp parallel for collapse(2) schedule(static) num_threads(__n_threads(n_threads))
+    for (size_t r0 = 0; r0 < height; r0 += tile)
+        for (size_t c0 = 0; c0 < width; c0 += tile)
+        {
+            const size_t r1 = std::min(r0 + tile, height);
+            const size_t c1 = std::min(c0 + tile, width);
+
+            for (size_t r = r0; r < r1; r++)
+                for (size_t c = c0; c < c1; c++)
+                    df.cell(c, r) = cmatrix<T>::cell(r, c);
+        }
+
+    return df;
+}
+
+template <class T>
+void cdata_frame<T>::transpose_inplace(const unsigned int &n_threads)
+{
+    const size_t n = cmatrix<T>::height();
+    const size_t tile = 32;
+
+    if (cmatrix<T>::width() != n)
+        throw std::invalid_argument("The data frame must be square to be transposed in place. Actual: " +
+                                    std::to_string(n) +
+                                    "x" +
+                                    std::to_string(cmatrix<T>::width()) +
+                                    ".");
+
+    // Each tile of the upper triangle is swapped with its mirror, the diagonal tiles with themselves
+#pragma omp parallel for schedule(dynamic) num_threads(__n_threads(n_threads))
+    for (size_t r0 = 0; r0 < n; r0 += tile)
+        for (size_t c0 = r0; c0 < n; c0 += tile)
+        {
+            const size_t r1 = std::min(r0 + tile, n);
+            const size_t c1 = std::min(c0 + tile, n);
+
+            for (size_t r = r0; r < r1; r++)
+                for (size_t c = std::max(c0, r + 1); c < c1; c++)
+                    std::swap(cmatrix<T>::cell(r, c), cmatrix<T>::cell(c, r));
+        }
+
+    m_valid = __transpose_valid();
+    std::swap(m_keys, m_index);
+    __build_zone_maps(n_threads);
+}
+
+template <class T>
+std::vector<cdata_mask> cdata_frame<T>::__transpose_valid() const
+{
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+
+    std::vector<cdata_mask> res;
+    if (m_valid.empty())
+        return res;
+
+    res.assign(height, cdata_mask(width));
+
+    // Each thread writes the bitmaps of its rows
+#pragma omp parallel for
+    for (size_t r = 0; r < height; r++)
+        for (size_t c = 0; c < width; c++)
+            if (m_valid[c].get(r))
+                res[r].set(c);
+
+    return res;
+}
+
+// ==================================================
+// CONVERSION
+
+template <class T>
+template <class U>
+cdata_frame<U> cdata_frame<T>::astype(const cdata_cast_error &errors, const U &fill, const unsigned int &n_threads) const &
+{
+    cdata_frame<U> df;
+    __astype(df, errors, fill, n_threads);
+
+    if (not df.is_empty())
+    {
+        df.m_keys = m_keys;
+        df.m_index = m_index;
+    }
+
+    return df;
+}
+
+template <class T>
+template <class U>
+cdata_frame<U> cdata_frame<T>::astype(const cdata_cast_error &errors, const U &fill, const unsigned int &n_threads) &&
+{
+    cdata_frame<U> df;
+    __astype(df, errors, fill, n_threads);
+
+    if (not df.is_empty())
+    {
+        df.m_keys = std::move(m_keys);
+        df.m_index = std::move(m_index);
+    }
+
+    return df;
+}
+
+template <class T>
+template <class U>
+void cdata_frame<T>::__astype(cdata_frame<U> &df, const cdata_cast_error &errors, const U &fill, const unsigned int &n_threads) const
+{
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+
+    if (height == 0 || width == 0)
+        return;
+
+    // The blocks are multiples of 64 rows, so two blocks never share a word of a bitmap
+    const size_t block_rows = 1 << 14;
+    const size_t n_blocks = (height + block_rows - 1) / block_rows;
+
+    df.set_data(cmatrix<U>(height, width));
+    df.m_valid = m_valid;
+
+    if (errors == cdata_cast_error::coerce)
+        df.__init_valid();
+
+    // The first row that can't be converted in each block, the exceptions can't leave a parallel region
+    std::vector<size_t> failed(width * n_blocks, height);
+
+#pragma omp parallel for schedule(dynamic) num_threads(__n_threads(n_threads))
+    for (size_t task = 0; task < width * n_blocks; task++)
+    {
+        const size_t c = task / n_blocks;
+        const size_t start = task % n_blocks * block_rows;
+        const size_t end = std::min(start + block_rows, height);
+        const cdata_mask *valid = __get_valid(c);
+
+        for (size_t r = start; r < end; r++)
+        {
+            if (valid != nullptr && not valid->get(r))
+                continue;
+
+            if (__convert(cmatrix<T>::cell(r, c), df.cell(r, c)))
+                continue;
+
+            if (failed[task] == height)
+                failed[task] = r;
+
+            if (errors == cdata_cast_error::coerce)
+                df.m_valid[c].set(r, false);
+
+            else if (errors == cdata_cast_error::fill)
+                df.cell(r, c) = fill;
+        }
+    }
+
+    const std::vector<size_t>::const_iterator it = std::find_if(failed.begin(), failed.end(), [&](const size_t &r)
+                                                                { return r != height; });
+
+    if (it != failed.end() && errors == cdata_cast_error::raise)
+        throw std::invalid_argument("The cell (" + std::to_string(*it) + ", " + std::to_string((it - failed.begin()) / n_blocks) + ") can't be converted.");
+
+    // Nothing was coerced, the bitmaps are not needed
+    if (it == failed.end() && m_valid.empty())
+        df.m_valid.clear();
+}
+
+template <class T>
+template <class U>
+bool cdata_frame<T>::__convert(const T &val, U &out)
+{
+    return __convert(val, out, cdata_is_string<T>(), cdata_is_string<U>());
+}
+
+template <class T>
+template <class U>
+bool cdata_frame<T>::__convert(const T &val, U &out, std::true_type, std::true_type)
+{
+    out.assign(val.data(), val.size());
+    return true;
+}
+
+template <class T>
+template <class U>
+bool cdata_frame<T>::__convert(const T &val, U &out, std::true_type, std::false_type)
+{
+    return cdata_parse::parse(val.data(), val.data() + val.size(), out);
+}
+
+template <class T>
+template <class U>
+bool cdata_frame<T>::__convert(const T &val, U &out, std::false_type, std::true_type)
+{
+    std::string str;
+    cdata_parse::format(str, val);
+    out.assign(str.data(), str.size());
+    return true;
+}
+
+template <class T>
+template <class U>
+bool cdata_frame<T>::__convert(const T &val, U &out, std::false_type, std::false_type)
+{
+    // A cast out of the range of the type is undefined
+    if (not __is_in_range<U>(val))
+        return false;
+
+    out = static_cast<U>(val);
+    return true;
 }
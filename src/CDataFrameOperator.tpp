@@ -12,7 +12,18 @@
 template <class T>
 bool cdata_frame<T>::operator==(const cdata_frame<T> &df) const
 {
-    return cmatrix<T>::operator==(df) && m_keys == df.m_keys && m_index == df.m_index;
+    if (not(cmatrix<T>::operator==(df) && m_keys == df.m_keys && m_index == df.m_index))
+        return false;
+
+    // Compare the missing cells
+    if (m_valid.empty() && df.m_valid.empty())
+        return true;
+
+    for (size_t c = 0; c < cmatrix<T>::width(); c++)
+        if (__get_valid_mask(c) != df.__get_valid_mask(c))
+            return false;
+
+    return true;
 }
 
 template <class T>
@@ -46,13 +46,30 @@ void cdata_frame<T>::set_index(const std::vector<std::string> &index)
 template <class T>
 void cdata_frame<T>::set_data(const cmatrix<T> &data)
 {
-    // Check if the number of keys is different from the number of columns
-    if (not m_keys.empty() && data.width() != m_keys.size())
-        throw std::invalid_argument("The number of keys must be equal to the number of columns.");
+    __check_data(data);
+    cmatrix<T>::operator=(data);
 
-    // Check if the number of index is different from the number of rows
-    if (not m_index.empty() && data.height() != m_index.size())
-        throw std::invalid_argument("The number of index must be equal to the number of rows.");
+    // The new data has no missing cell
+    m_valid.clear();
+    __build_zone_maps();
+}
 
-    cmatrix<T>::operator=(data);
+template <class T>
+void cdata_frame<T>::set_na(const size_t &row, const size_t &col)
+{
+    if (row >= cmatrix<T>::height() || col >= cmatrix<T>::width())
+        throw std::out_of_range("The cell (" + std::to_string(row) + ", " + std::to_string(col) + ") is out of range.");
+
+    __init_valid();
+
+    if (m_zone_rows != 0 && m_valid[col].get(row))
+        m_zones[col].set_na(row);
+
+    m_valid[col].set(row, false);
+}
+
+template <class T>
+void cdata_frame<T>::set_na(const size_t &row, const std::string &key)
+{
+    set_na(row, __get_key_pos(key));
 }
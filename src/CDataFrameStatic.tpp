@@ -14,6 +14,123 @@ cdata_frame<T> cdata_frame<T>::merge(const cdata_frame<T> &df1, const cdata_fram
     return df;
 }
 
+template <class T>
+cdata_frame<T> cdata_frame<T>::concat(const std::vector<cdata_frame<T>> &dfs, const short unsigned int &axis)
+{
+    if (axis != 0 && axis != 1)
+        throw std::invalid_argument("Invalid axis. Axis must be 0 or 1.");
+
+    // The empty data frames are skipped
+    std::vector<const cdata_frame<T> *> parts;
+    for (const cdata_frame<T> &df : dfs)
+        if (not df.is_empty())
+            parts.push_back(&df);
+
+    cdata_frame<T> df;
+    if (parts.empty())
+        return df;
+
+    const cdata_frame<T> &first = *parts[0];
+
+    // Compute the offset of each data frame in the result
+    std::vector<size_t> offsets(parts.size() + 1, 0);
+    bool has_labels = false;
+    bool has_na = false;
+
+    for (size_t p = 0; p < parts.size(); p++)
+    {
+        const cdata_frame<T> &part = *parts[p];
+        const std::vector<std::string> &labels = axis == 0 ? part.m_index : part.m_keys;
+
+        if (axis == 0 && part.m_keys != first.m_keys)
+            throw std::invalid_argument("The keys of the data frames must be the same.");
+
+        if (axis == 0 && part.width() != first.width())
+            throw std::invalid_argument("The data frames must have the same number of columns.");
+
+        if (axis == 1 && part.m_index != first.m_index)
+            throw std::invalid_argument("The indexes of the data frames must be the same.");
+
+        if (axis == 1 && part.height() != first.height())
+            throw std::invalid_argument("The data frames must have the same number of rows.");
+
+        if (p != 0 && labels.empty() == has_labels)
+            throw std::invalid_argument(std::string(axis == 0 ? "The indexes" : "The keys") + " of the data frames must be all set or all empty.");
+
+        has_labels = not labels.empty();
+        has_na = has_na || not part.m_valid.empty();
+        offsets[p + 1] = offsets[p] + (axis == 0 ? part.height() : part.width());
+    }
+
+    // Concatenate the labels and check their uniqueness in one pass
+    std::vector<std::string> labels;
+    if (has_labels)
+    {
+        labels.reserve(offsets.back());
+        std::unordered_set<std::string> seen;
+        seen.reserve(offsets.back());
+
+        for (const cdata_frame<T> *part : parts)
+            for (const std::string &label : axis == 0 ? part->m_index : part->m_keys)
+            {
+                if (not seen.insert(label).second)
+                    throw std::invalid_argument(std::string(axis == 0 ? "The index" : "The keys") + " must be unique.");
+
+                labels.push_back(label);
+            }
+    }
+
+    // Allocate the data once
+    const size_t height = axis == 0 ? offsets.back() : first.height();
+    const size_t width = axis == 0 ? first.width() : offsets.back();
+    df.set_data(cmatrix<T>(height, width));
+
+    if (axis == 0)
+    {
+        df.m_keys = first.m_keys;
+        df.m_index = labels;
+
+        // One parallel region, the threads share the rows of each data frame without waiting
+#pragma omp parallel
+        for (size_t p = 0; p < parts.size(); p++)
+        {
+#pragma omp for nowait
+            for (size_t r = 0; r < parts[p]->height(); r++)
+                for (size_t c = 0; c < width; c++)
+                    df.cell(offsets[p] + r, c) = parts[p]->cell(r, c);
+        }
+
+        if (has_na)
+        {
+            df.m_valid.resize(width);
+
+#pragma omp parallel for
+            for (size_t c = 0; c < width; c++)
+                for (const cdata_frame<T> *part : parts)
+                    df.m_valid[c].append(part->__get_valid_mask(c));
+        }
+    }
+
+    else
+    {
+        df.m_keys = labels;
+        df.m_index = first.m_index;
+
+#pragma omp parallel for
+        for (size_t r = 0; r < height; r++)
+            for (size_t p = 0; p < parts.size(); p++)
+                for (size_t c = 0; c < parts[p]->width(); c++)
+                    df.cell(r, offsets[p] + c) = parts[p]->cell(r, c);
+
+        if (has_na)
+            for (const cdata_frame<T> *part : parts)
+                for (size_t c = 0; c < part->width(); c++)
+                    df.m_valid.push_back(part->__get_valid_mask(c));
+    }
+
+    return df;
+}
+
 // ==================================================
 // FILE
 
@@ -50,17 +167,18 @@ std::fstream cdata_frame<T>::__open_file(const std::string &path)
 // PARSE
 
 template <class T>
-std::vector<std::string> cdata_frame<T>::__parse_csv_line(const std::string &line, const char &sep, const bool &index, std::string *index_name)
+std::vector<std::string> cdata_frame<T>::__parse_csv_line(const std::string &line, const char &sep, const bool &index, std::string *index_name, std::vector<bool> *empty)
 {
-    // Convert the line to string stream
-    std::istringstream line_stream(line);
-
     // Create a vector of string used to store the line tokenized
     std::vector<std::string> line_tokenized;
 
-    // Parse the line and store the tokens in the vector
-    for (std::string word; getline(line_stream, word, sep);)
-        line_tokenized.push_back(word);
+    // Parse the line and store the tokens in the vector, an empty line has no token
+    // The field after the last separator is kept, even if empty
+    for (size_t start = 0, end = 0; not line.empty() && end != std::string::npos; start = end + 1)
+    {
+        end = line.find(sep, start);
+        line_tokenized.push_back(line.substr(start, end == std::string::npos ? end : end - start));
+    }
 
     // Check if the index is enabled
     if (index)
@@ -76,32 +194,82 @@ std::vector<std::string> cdata_frame<T>::__parse_csv_line(const std::string &lin
         line_tokenized.erase(line_tokenized.begin());
     }
 
+    // Flag the empty fields
+    if (empty != nullptr)
+    {
+        empty->resize(line_tokenized.size());
+
+        for (size_t i = 0; i < line_tokenized.size(); i++)
+            (*empty)[i] = line_tokenized[i].empty();
+    }
+
     return line_tokenized;
 }
 
 template <class T>
-cdata_frame<std::string> cdata_frame<T>::read_csv(const std::string &path, const bool &header, const bool &index, const char &sep)
+std::string cdata_frame<T>::__make_cell(std::string &token, const std::allocator<char> &)
+{
+    return std::move(token);
+}
+
+template <class T>
+cdata_string cdata_frame<T>::__make_cell(const std::string &token, const cdata_arena_allocator<char> &alloc)
+{
+    return cdata_string(token.data(), token.size(), alloc);
+}
+
+template <class T>
+template <class S>
+cdata_frame<S> cdata_frame<T>::__read_csv(const std::string &path, const bool &header, const bool &index, const char &sep, const typename S::allocator_type &alloc)
 {
+    CDATA_TRACE_SCOPE("read_csv");
+
     // Check if the file has expected extension (csv)
     if (not __has_expected_extension(path, "csv"))
         throw std::invalid_argument("The file '" + path + "' must be a csv file.");
 
     // Open the file
     std::fstream file = cdata_frame<T>::__open_file(path);
+    std::string line;
+
+    // Parse the file line by line
+    cdata_frame<S> df = __build_csv<S>([&](std::vector<std::string> &line_tokenized, std::string &current_index, std::vector<bool> &empty)
+                                       {
+        if (not getline(file, line))
+            return false;
+
+        // Parse and tokenize the line
+        line_tokenized = cdata_frame<T>::__parse_csv_line(line, sep, index, &current_index, &empty);
+        return true; },
+                                       header, index, alloc);
 
-    cdata_frame<std::string> df;
+    // Close the file
+    file.close();
+
+    CDATA_TRACE_COUNT(df.height(), df.height() * df.width() * sizeof(S), df.height());
+
+    return df;
+}
+
+template <class T>
+template <class S, class Function>
+cdata_frame<S> cdata_frame<T>::__build_csv(Function next, const bool &header, const bool &index, const typename S::allocator_type &alloc)
+{
+    cdata_frame<S> df;
     std::vector<std::string> vec_keys;
     std::vector<std::string> vec_index;
 
-    // Parse the file line by line
-    for (std::string line; getline(file, line);)
-    {
-        // Create a string used to store the current index
-        std::string current_index = "";
+    // The validity bitmaps of the columns, only kept if a field is empty
+    std::vector<cdata_mask> vec_valid;
+    std::vector<bool> empty;
+    bool has_na = false;
 
-        // Parse and tokenize the line
-        const std::vector<std::string> &line_tokenized = cdata_frame<T>::__parse_csv_line(line, sep, index, &current_index);
+    // Push the lines in order
+    std::vector<std::string> line_tokenized;
+    std::string current_index;
 
+    while (next(line_tokenized, current_index, empty))
+    {
         // Check if the header is enabled
         if (vec_keys.empty() and header)
             vec_keys = line_tokenized;
@@ -109,7 +277,22 @@ cdata_frame<std::string> cdata_frame<T>::read_csv(const std::string &path, const
         else
         {
             // Push the line in the data frame
-            df.push_row_back(line_tokenized);
+            std::vector<S> row;
+            row.reserve(line_tokenized.size());
+
+            for (std::string &token : line_tokenized)
+                row.push_back(__make_cell(token, alloc));
+
+            df.push_row_back(row);
+
+            // Mark the empty fields as missing
+            vec_valid.resize(line_tokenized.size());
+
+            for (size_t c = 0; c < line_tokenized.size(); c++)
+            {
+                vec_valid[c].push_back(not empty[c]);
+                has_na = has_na || empty[c];
+            }
 
             // Push the index in the vector if the index is enabled
             if (index)
@@ -117,9 +300,6 @@ cdata_frame<std::string> cdata_frame<T>::read_csv(const std::string &path, const
         }
     }
 
-    // Close the file
-    file.close();
-
     // If the data frame is empty, index and keys can't be set
     if (not df.is_empty())
     {
@@ -128,40 +308,404 @@ cdata_frame<std::string> cdata_frame<T>::read_csv(const std::string &path, const
 
         // Set the index
         df.set_index(vec_index);
+
+        if (has_na)
+            df.m_valid = vec_valid;
+    }
+
+    return df;
+}
+
+template <class T>
+cdata_frame<std::string> cdata_frame<T>::read_csv(const std::string &path, const bool &header, const bool &index, const char &sep)
+{
+    return __read_csv<std::string>(path, header, index, sep, std::allocator<char>());
+}
+
+template <class T>
+cdata_frame<cdata_string> cdata_frame<T>::read_csv_arena(const std::string &path, const bool &header, const bool &index, const char &sep, const size_t &slab_size)
+{
+    const std::shared_ptr<cdata_arena> arena = std::make_shared<cdata_arena>(slab_size);
+    return __read_csv<cdata_string>(path, header, index, sep, cdata_arena_allocator<char>(arena));
+}
+
+template <class T>
+std::future<cdata_frame<std::string>> cdata_frame<T>::read_csv_async(const std::string &path, const bool &header, const bool &index, const char &sep, const unsigned int &n_threads)
+{
+    return std::async(std::launch::async, &cdata_frame<T>::__read_csv_async, path, header, index, sep, n_threads);
+}
+
+template <class T>
+cdata_frame<std::string> cdata_frame<T>::__read_csv_async(const std::string &path, const bool &header, const bool &index, const char &sep, const unsigned int &n_threads)
+{
+    CDATA_TRACE_SCOPE("read_csv_async");
+
+#ifndef CDATA_HAS_READER
+    // Without the background reader, the task reads the file with 'read_csv'
+    return read_csv(path, header, index, sep);
+#else
+    // Check if the file has expected extension (csv)
+    if (not __has_expected_extension(path, "csv"))
+        throw std::invalid_argument("The file '" + path + "' must be a csv file.");
+
+    // Check if the file exists
+    if (not __is_file_exist(path))
+        throw std::invalid_argument("The file '" + path + "' doesn't exist.");
+
+    // The complete lines of a buffer, tokenized by a task
+    struct cdata_csv_chunk
+    {
+        std::string text;
+        std::vector<std::vector<std::string>> lines;
+        std::vector<std::string> index;
+        std::vector<std::vector<bool>> empty;
+        std::exception_ptr error;
+    };
+
+    // A deque keeps the chunks in place while the tasks fill them
+    std::deque<cdata_csv_chunk> chunks;
+    std::exception_ptr error;
+    cdata_reader reader(path);
+
+#pragma omp parallel num_threads(__n_threads(n_threads))
+#pragma omp single
+    {
+        try
+        {
+            std::string text;
+
+            for (bool more = true; more;)
+            {
+                more = reader.read(text);
+
+                // Cut after the last complete line, the rest waits for the next buffer
+                // The end of the file is a line even without a newline
+                const size_t end = more ? text.rfind('\n') + 1 : text.size();
+
+                if (end == 0)
+                    continue;
+
+                chunks.emplace_back();
+                cdata_csv_chunk *chunk = &chunks.back();
+                chunk->text.assign(text, 0, end);
+                text.erase(0, end);
+
+#pragma omp task firstprivate(chunk)
+                {
+                    try
+                    {
+                        for (size_t start = 0; start < chunk->text.size();)
+                        {
+                            size_t stop = chunk->text.find('\n', start);
+                            if (stop == std::string::npos)
+                                stop = chunk->text.size();
+
+                            chunk->index.emplace_back();
+                            chunk->empty.emplace_back();
+                            chunk->lines.push_back(__parse_csv_line(chunk->text.substr(start, stop - start), sep, index, &chunk->index.back(), &chunk->empty.back()));
+                            start = stop + 1;
+                        }
+                    }
+                    catch (...)
+                    {
+                        chunk->error = std::current_exception();
+                    }
+
+                    std::string().swap(chunk->text);
+                }
+            }
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
     }
 
+    if (error)
+        std::rethrow_exception(error);
+
+    for (const cdata_csv_chunk &chunk : chunks)
+        if (chunk.error)
+            std::rethrow_exception(chunk.error);
+
+    // Push the lines in the order of the file
+    size_t k = 0, i = 0;
+
+    cdata_frame<std::string> df = __build_csv<std::string>([&](std::vector<std::string> &line_tokenized, std::string &current_index, std::vector<bool> &empty)
+                                                           {
+        while (k < chunks.size() && i == chunks[k].lines.size())
+        {
+            std::vector<std::vector<std::string>>().swap(chunks[k].lines);
+            k++;
+            i = 0;
+        }
+
+        if (k == chunks.size())
+            return false;
+
+        line_tokenized = std::move(chunks[k].lines[i]);
+        current_index = std::move(chunks[k].index[i]);
+        empty = std::move(chunks[k].empty[i]);
+        i++;
+
+        return true; },
+                                                           header, index, std::allocator<char>());
+
+    CDATA_TRACE_COUNT(df.height(), df.height() * df.width() * sizeof(std::string), df.height());
+
     return df;
+#endif
 }
 
 // ==================================================
-// GENERAL PRIVATE METHODS
+// ARROW
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::from_arrow(std::istream &in)
+{
+    const std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    return __from_arrow(bytes);
+}
+
+template <class T>
+cdata_frame<T> cdata_frame<T>::read_arrow(const std::string &path)
+{
+    // Check if the file exists
+    if (not __is_file_exist(path))
+        throw std::invalid_argument("The file '" + path + "' doesn't exist.");
+
+    std::ifstream file(path, std::ios::binary);
+
+    if (not file.is_open())
+        throw std::runtime_error("Failed to open the file.");
+
+    return from_arrow(file);
+}
 
 template <class T>
-template <class U>
-short unsigned int cdata_frame<T>::__count_characters(const U &input)
+cdata_frame<T> cdata_frame<T>::__from_arrow(const std::string &bytes)
 {
-    // Convert the input to string stream
-    std::stringstream ss;
-    ss << input;
-    std::string input_str = ss.str();
+    CDATA_TRACE_SCOPE("from_arrow");
 
-    int count = 0;
-    size_t current_index = 0;
+    std::vector<cdata_arrow_field> fields;
+    std::vector<std::pair<std::string, std::string>> metadata;
+    std::vector<std::vector<cdata_arrow_column>> batches;
 
-    while (current_index < input_str.length())
+    cdata_arrow::read(bytes, fields, metadata, batches);
+
+    // The column of the index, if any, and the keys of the other columns
+    size_t index_col = fields.size();
+    std::vector<std::string> keys;
+    bool has_keys = false;
+
+    for (size_t i = 0; i < fields.size(); i++)
     {
-        char current_char = input_str[current_index];
+        if (index_col == fields.size() and fields[i].name == cdata_arrow::index_name())
+            index_col = i;
+        else
+        {
+            keys.push_back(fields[i].name);
+            has_keys = has_keys or not fields[i].name.empty();
+        }
+    }
 
-        // Check if the current character is not a continuation of a Unicode character
-        // 0xC0: 11000000 (mask to check if the current character is a continuation of a Unicode character)
-        // 0x80: 10000000 (continuation of a Unicode character)
-        // Ex: € -> 11100010 10000010 10101100
-        // 11100010 & 11000000 = 11000000 != 10000000 -> count++
-        if ((current_char & 0xC0) != 0x80)
-            count++;
+    size_t height = 0;
+    for (const std::vector<cdata_arrow_column> &batch : batches)
+        height += batch.empty() ? 0 : batch[0].length;
+
+    // If the data frame is empty, index and keys can't be set
+    if (height == 0)
+        return cdata_frame<T>();
+
+    const size_t width = keys.size();
+    cmatrix<T> data(height, width);
+    std::vector<std::string> index(index_col < fields.size() ? height : 0);
+    std::vector<cdata_mask> valid(width, cdata_mask(height, true));
+    bool has_na = false;
+    size_t row = 0;
+
+    // Copy the values of the batches in the cells
+    for (const std::vector<cdata_arrow_column> &batch : batches)
+    {
+        for (size_t i = 0; i < batch.size(); i++)
+        {
+            if (i == index_col)
+            {
+                __read_arrow_column<std::string>(batch[i], [&](const size_t &r, std::string &val)
+                                                 { index[row + r] = std::move(val); },
+                                                 [](const size_t &) {});
+                continue;
+            }
+
+            const size_t c = i > index_col ? i - 1 : i;
+
+            __read_arrow_column<T>(batch[i], [&](const size_t &r, T &val)
+                                   { data.cell(row + r, c) = std::move(val); },
+                                   [&](const size_t &r)
+                                   {
+                                       valid[c].set(row + r, false);
+                                       has_na = true; });
+        }
+
+        row += batch.empty() ? 0 : batch[0].length;
+    }
 
-        current_index++;
+    cdata_frame<T> df(data);
+
+    if (has_keys)
+        df.set_keys(keys);
+
+    df.set_index(index);
+
+    if (has_na)
+        df.m_valid = valid;
+
+    CDATA_TRACE_COUNT(height, bytes.size(), width);
+
+    return df;
+}
+
+template <class T>
+template <class U, class Function, class Missing>
+void cdata_frame<T>::__read_arrow_column(const cdata_arrow_column &col, Function set, Missing missing)
+{
+    // Read the values with their own type, so that the conversion is the one of 'astype'
+    const cdata_arrow_field &field = col.field;
+
+    if (field.type == cdata_arrow::type_utf8 || field.type == cdata_arrow::type_large_utf8)
+        __read_arrow_values<std::string, U>(col, set, missing);
+    else if (field.type == cdata_arrow::type_bool)
+        __read_arrow_values<uint8_t, U>(col, set, missing);
+    else if (field.type == cdata_arrow::type_float)
+    {
+        if (field.precision == 1)
+            __read_arrow_values<float, U>(col, set, missing);
+        else
+            __read_arrow_values<double, U>(col, set, missing);
     }
+    else if (field.bit_width == 8)
+    {
+        if (field.is_signed)
+            __read_arrow_values<int8_t, U>(col, set, missing);
+        else
+            __read_arrow_values<uint8_t, U>(col, set, missing);
+    }
+    else if (field.bit_width == 16)
+    {
+        if (field.is_signed)
+            __read_arrow_values<int16_t, U>(col, set, missing);
+        else
+            __read_arrow_values<uint16_t, U>(col, set, missing);
+    }
+    else if (field.bit_width == 32)
+    {
+        if (field.is_signed)
+            __read_arrow_values<int32_t, U>(col, set, missing);
+        else
+            __read_arrow_values<uint32_t, U>(col, set, missing);
+    }
+    else
+    {
+        if (field.is_signed)
+            __read_arrow_values<int64_t, U>(col, set, missing);
+        else
+            __read_arrow_values<uint64_t, U>(col, set, missing);
+    }
+}
+
+template <class T>
+template <class S, class U, class Function, class Missing>
+void cdata_frame<T>::__read_arrow_values(const cdata_arrow_column &col, Function set, Missing missing)
+{
+    S val = S();
+    U out = U();
+
+    for (size_t r = 0; r < size_t(col.length); r++)
+    {
+        if (not col.is_valid(r))
+        {
+            missing(r);
+            continue;
+        }
+
+        col.value(r, val);
+
+        // A value out of the range of the type is not converted
+        if (not cdata_frame<S>::__convert(val, out))
+            throw std::invalid_argument("The value " + std::to_string(r) + " of the column '" + col.field.name + "' can't be converted.");
+
+        set(r, out);
+    }
+}
+
+template <class T>
+template <class U, class S>
+bool cdata_frame<T>::__is_in_range(const S &val)
+{
+    return __is_in_range<U>(val, std::integral_constant<bool, std::is_arithmetic<S>::value && std::is_integral<U>::value>(), std::is_integral<S>());
+}
+
+template <class T>
+template <class U, class S, class Integral>
+bool cdata_frame<T>::__is_in_range(const S &val, std::false_type, Integral)
+{
+    return __is_in_float_range<U>(val, std::integral_constant<bool, std::is_floating_point<S>::value && std::is_floating_point<U>::value>());
+}
+
+template <class T>
+template <class U, class S>
+bool cdata_frame<T>::__is_in_range(const S &val, std::true_type, std::true_type)
+{
+    // The negative numbers are compared as signed, the others as unsigned
+    if (val < S())
+        return std::numeric_limits<U>::is_signed && intmax_t(val) >= intmax_t(std::numeric_limits<U>::min());
+
+    return uintmax_t(val) <= uintmax_t(std::numeric_limits<U>::max());
+}
+
+template <class T>
+template <class U, class S>
+bool cdata_frame<T>::__is_in_range(const S &val, std::true_type, std::false_type)
+{
+    // The range of an integer type is [-2^digits, 2^digits) or [0, 2^digits), exact as a floating point, NaN is outside
+    const S hi = std::ldexp(S(1), std::numeric_limits<U>::digits);
+    const S lo = std::numeric_limits<U>::is_signed ? -hi : S();
+
+    return val >= lo && val < hi;
+}
+
+template <class T>
+template <class U, class S>
+bool cdata_frame<T>::__is_in_float_range(const S &, std::false_type)
+{
+    return true;
+}
+
+template <class T>
+template <class U, class S>
+bool cdata_frame<T>::__is_in_float_range(const S &val, std::true_type)
+{
+    // A finite number larger than the type is undefined, the infinites and NaN are kept
+    return not(std::abs(val) > std::numeric_limits<U>::max()) || std::isinf(val);
+}
+
+// ==================================================
+// GENERAL PRIVATE METHODS
+
+template <class T>
+size_t cdata_frame<T>::__count_characters(const std::string &input)
+{
+    size_t count = 0;
+
+    // Count the bytes that are not a continuation of a Unicode character
+    // 0xC0: 11000000 (mask to check if the current character is a continuation of a Unicode character)
+    // 0x80: 10000000 (continuation of a Unicode character)
+    // Ex: € -> 11100010 10000010 10101100
+    // 11100010 & 11000000 = 11000000 != 10000000 -> count++
+    for (const char &c : input)
+        if ((c & 0xC0) != 0x80)
+            count++;
 
     return count;
 }
@@ -0,0 +1,254 @@
+/**
+ * @file CDataFrameStatistic.tpp
+ * @brief File containing the implementation of statistic methods of the 'DataFrame' class.
+ *
+ * @see CDataFrame.hpp
+ * @defgroup statistic
+ */
+
+// ==================================================
+// ACCUMULATORS
+
+/**
+ * @brief Count, mean, sum of squared deviations, minimum and maximum of a part of a column.
+ *
+ * The states of two parts are merged exactly (Chan et al.), so the parts can be reduced in parallel.
+ */
+struct cdata_moments
+{
+    size_t m_n = 0;
+    double m_mean = 0;
+    double m_m2 = 0;
+    double m_min = std::numeric_limits<double>::infinity();
+    double m_max = -std::numeric_limits<double>::infinity();
+
+    void add(const double &x)
+    {
+        m_n++;
+        const double delta = x - m_mean;
+        m_mean += delta / m_n;
+        m_m2 += delta * (x - m_mean);
+        m_min = std::min(m_min, x);
+        m_max = std::max(m_max, x);
+    }
+    void merge(const cdata_moments &state)
+    {
+        if (state.m_n == 0)
+            return;
+
+        const size_t n = m_n + state.m_n;
+        const double delta = state.m_mean - m_mean;
+
+        m_mean += delta * state.m_n / n;
+        m_m2 += state.m_m2 + delta * delta * m_n / n * state.m_n;
+        m_min = std::min(m_min, state.m_min);
+        m_max = std::max(m_max, state.m_max);
+        m_n = n;
+    }
+};
+
+// ==================================================
+// WINDOW
+
+template <class T>
+cdata_rolling<T> cdata_frame<T>::rolling(const size_t &window, const size_t &min_periods) const
+{
+    if (window == 0)
+        throw std::invalid_argument("The window must have at least one row.");
+
+    return cdata_rolling<T>(*this, window, min_periods == 0 ? window : min_periods);
+}
+
+template <class T>
+cdata_rolling<T> cdata_frame<T>::expanding(const size_t &min_periods) const
+{
+    return cdata_rolling<T>(*this, 0, min_periods);
+}
+
+// ==================================================
+// SUMMARY
+
+template <class T>
+cdata_frame<double> cdata_frame<T>::describe(const unsigned int &n_threads) const
+{
+    static_assert(std::is_arithmetic<T>::value, "The statistics need a numeric data frame.");
+
+    const size_t height = cmatrix<T>::height();
+    const size_t width = cmatrix<T>::width();
+    const size_t block_rows = 1 << 14;
+    const size_t n_blocks = std::max<size_t>((height + block_rows - 1) / block_rows, 1);
+
+    if (width == 0)
+        return cdata_frame<double>();
+
+    // The valid values of each column, gathered by blocks, and the state of each block
+    std::vector<double> values(height * width);
+    std::vector<cdata_moments> states(width * n_blocks);
+
+    // Pass over the data: each task reads a block of rows of a column
+#pragma omp parallel for schedule(dynamic) num_threads(__n_threads(n_threads))
+    for (size_t task = 0; task < width * n_blocks; task++)
+    {
+        const size_t c = task / n_blocks;
+        const size_t start = task % n_blocks * block_rows;
+        const size_t end = std::min(start + block_rows, height);
+        const cdata_mask *valid = __get_valid(c);
+
+        // The valid values are packed at the start of the block
+        double *out = values.data() + c * height + start;
+        cdata_moments &state = states[task];
+
+        for (size_t r = start; r < end; r++)
+        {
+            if (valid != nullptr && not valid->get(r))
+                continue;
+
+            const double x = static_cast<double>(cmatrix<T>::cell(r, c));
+            out[state.m_n] = x;
+            state.add(x);
+        }
+    }
+
+    const std::vector<std::string> stats = {"count", "mean", "std", "min", "25%", "50%", "75%", "max"};
+
+    cdata_frame<double> df(m_keys, cmatrix<double>(stats.size(), width), stats);
+    df.__init_valid();
+
+    // Merge the blocks of each column, then select the quartiles
+#pragma omp parallel for schedule(dynamic) num_threads(__n_threads(n_threads))
+    for (size_t c = 0; c < width; c++)
+    {
+        double *column = values.data() + c * height;
+        cdata_moments state = states[c * n_blocks];
+
+        for (size_t b = 1; b < n_blocks; b++)
+        {
+            const cdata_moments &block = states[c * n_blocks + b];
+
+            // Move the valid values of the block after the ones of the previous blocks
+            std::copy(column + b * block_rows, column + b * block_rows + block.m_n, column + state.m_n);
+            state.merge(block);
+        }
+
+        const size_t n = state.m_n;
+        df.cell(0, c) = n;
+
+        if (n == 0)
+        {
+            for (size_t r = 1; r < stats.size(); r++)
+                df.m_valid[c].set(r, false);
+
+            continue;
+        }
+
+        df.cell(1, c) = state.m_mean;
+        df.cell(3, c) = state.m_min;
+        df.cell(4, c) = __quantile(column, column + n, 0.25);
+        df.cell(5, c) = __quantile(column, column + n, 0.5);
+        df.cell(6, c) = __quantile(column, column + n, 0.75);
+        df.cell(7, c) = state.m_max;
+
+        if (n > 1)
+            df.cell(2, c) = std::sqrt(std::max(state.m_m2, 0.) / (n - 1));
+        else
+            df.m_valid[c].set(2, false);
+    }
+
+    return df;
+}
+
+// ==================================================
+// QUANTILE
+
+template <class T>
+double cdata_frame<T>::quantile(const double &q, const std::string &key) const
+{
+    return quantile(std::vector<double>{q}, key).front();
+}
+
+template <class T>
+std::vector<double> cdata_frame<T>::quantile(const std::vector<double> &q, const std::string &key) const
+{
+    static_assert(std::is_arithmetic<T>::value, "The statistics need a numeric data frame.");
+
+    for (const double &val : q)
+        if (not(val >= 0 && val <= 1))
+            throw std::invalid_argument("The quantile must be between 0 and 1.");
+
+    const size_t pos = __get_key_pos(key);
+    const size_t height = cmatrix<T>::height();
+    const cdata_mask *valid = __get_valid(pos);
+
+    // Scratch buffer of the valid elements, reordered by the selections
+    std::vector<double> values;
+    values.reserve(valid == nullptr ? height : valid->count());
+
+    for (size_t r = 0; r < height; r++)
+        if (valid == nullptr || valid->get(r))
+            values.push_back(static_cast<double>(cmatrix<T>::cell(r, pos)));
+
+    if (values.empty())
+        throw std::runtime_error("The column has no valid element.");
+
+    std::vector<double> res;
+    res.reserve(q.size());
+
+    for (const double &val : q)
+        res.push_back(__quantile(values.data(), values.data() + values.size(), val));
+
+    return res;
+}
+
+template <class T>
+cdata_digest cdata_frame<T>::digest(const std::string &key, const double &compression, const unsigned int &n_threads) const
+{
+    static_assert(std::is_arithmetic<T>::value, "The statistics need a numeric data frame.");
+
+    const size_t pos = __get_key_pos(key);
+    const size_t height = cmatrix<T>::height();
+    const cdata_mask *valid = __get_valid(pos);
+
+    const int threads = __n_threads(n_threads);
+    std::vector<cdata_digest> locals(threads, cdata_digest(compression));
+
+#pragma omp parallel num_threads(threads)
+    {
+#ifdef _OPENMP
+        cdata_digest &local = locals[omp_get_thread_num()];
+#else
+        cdata_digest &local = locals[0];
+#endif
+
+#pragma omp for schedule(static)
+        for (size_t r = 0; r < height; r++)
+            if (valid == nullptr || valid->get(r))
+                local.add(static_cast<double>(cmatrix<T>::cell(r, pos)));
+    }
+
+    // The digests are merged in the order of the threads, so the result doesn't depend on their timing
+    cdata_digest res(compression);
+
+    for (const cdata_digest &local : locals)
+        res.merge(local);
+
+    return res;
+}
+
+// ==================================================
+// PRIVATE
+
+template <class T>
+double cdata_frame<T>::__quantile(double *first, double *last, const double &q)
+{
+    const double pos = q * (last - first - 1);
+    const size_t lo = static_cast<size_t>(pos);
+
+    std::nth_element(first, first + lo, last);
+
+    if (pos == lo)
+        return first[lo];
+
+    // The next rank is the smallest value after the one selected
+    const double hi = *std::min_element(first + lo + 1, last);
+    return first[lo] + (hi - first[lo]) * (pos - lo);
+}
@@ -0,0 +1,339 @@
+/**
+ * @file CDataMappedFrame.tpp
+ * @brief File containing the implementation of the 'cdata_mapped_frame' class.
+ *
+ * @see CDataMappedFrame.hpp
+ * @defgroup mapped
+ */
+
+// ==================================================
+// CONSTRUCTOR
+
+template <class T>
+cdata_mapped_frame<T>::cdata_mapped_frame(const std::vector<std::string> &keys, const size_t &chunk_rows, const size_t &max_resident, const std::string &dir)
+    : m_keys(keys), m_width(keys.size()), m_chunk_rows(chunk_rows), m_max_resident(max_resident)
+{
+    if (keys.empty())
+        throw std::invalid_argument("The data frame must have at least one key.");
+
+    if (chunk_rows == 0)
+        throw std::invalid_argument("The chunks must have at least one row.");
+
+    // A chunk is mapped at its offset in the file, which must be a multiple of the page size
+    const size_t page = sysconf(_SC_PAGESIZE);
+    size_t a = page, b = sizeof(T);
+    while (b != 0)
+    {
+        const size_t t = a % b;
+        a = b;
+        b = t;
+    }
+
+    const size_t step = page / a;
+    m_chunk_rows = (chunk_rows + step - 1) / step * step;
+
+    // Create the scratch file and remove its name, the file is deleted when it is closed
+    const char *tmp = std::getenv("TMPDIR");
+    std::string path = (dir.empty() ? (tmp == nullptr ? "/tmp" : tmp) : dir) + "/cdataframe-XXXXXX";
+
+    m_fd = mkstemp(&path[0]);
+    if (m_fd == -1)
+        throw std::runtime_error("The scratch file '" + path + "' can't be created: " + std::strerror(errno) + ".");
+
+    unlink(path.c_str());
+}
+
+template <class T>
+cdata_mapped_frame<T>::cdata_mapped_frame(const cdata_frame<T> &df, const size_t &chunk_rows, const size_t &max_resident, const std::string &dir)
+    : cdata_mapped_frame(df.keys(), chunk_rows, max_resident, dir)
+{
+    for (size_t r = 0; r < df.height(); r++)
+        push_row_back(df.rows_vec(r));
+}
+
+template <class T>
+cdata_mapped_frame<T>::~cdata_mapped_frame()
+{
+    for (const std::pair<const size_t, cdata_chunk> &chunk : m_resident)
+        munmap(chunk.second.data, __chunk_bytes());
+
+    close(m_fd);
+}
+
+// ==================================================
+// GETTER
+
+template <class T>
+size_t cdata_mapped_frame<T>::height() const
+{
+    return m_height;
+}
+
+template <class T>
+size_t cdata_mapped_frame<T>::width() const
+{
+    return m_width;
+}
+
+template <class T>
+bool cdata_mapped_frame<T>::is_empty() const
+{
+    return m_height == 0;
+}
+
+template <class T>
+std::vector<std::string> cdata_mapped_frame<T>::keys() const
+{
+    return m_keys;
+}
+
+template <class T>
+size_t cdata_mapped_frame<T>::chunk_rows() const
+{
+    return m_chunk_rows;
+}
+
+template <class T>
+size_t cdata_mapped_frame<T>::resident() const
+{
+    return m_resident.size() * __chunk_bytes();
+}
+
+template <class T>
+size_t cdata_mapped_frame<T>::n_maps() const
+{
+    return m_n_maps;
+}
+
+template <class T>
+T cdata_mapped_frame<T>::get(const size_t &row, const size_t &col) const
+{
+    if (row >= m_height || col >= m_width)
+        throw std::out_of_range("The cell (" + std::to_string(row) + ", " + std::to_string(col) + ") is out of range.");
+
+    return __chunk(col, row / m_chunk_rows)[row % m_chunk_rows];
+}
+
+template <class T>
+std::vector<T> cdata_mapped_frame<T>::columns_vec(const std::string &key) const
+{
+    std::vector<T> res;
+    res.reserve(m_height);
+
+    __scan(__get_key_pos(key), [&](const T *data, const size_t &n)
+           { res.insert(res.end(), data, data + n); });
+
+    return res;
+}
+
+template <class T>
+cdata_frame<T> cdata_mapped_frame<T>::slice_rows(const size_t &start, const size_t &end) const
+{
+    if (start > end || end >= m_height)
+        throw std::out_of_range("The rows [" + std::to_string(start) + ", " + std::to_string(end) + "] are out of range.");
+
+    cmatrix<T> data(end - start + 1, m_width);
+
+    // Read each column chunk by chunk, only the chunks of the rows are mapped
+    for (size_t c = 0; c < m_width; c++)
+        for (size_t r = start; r <= end;)
+        {
+            const T *chunk = __chunk(c, r / m_chunk_rows);
+            const size_t last = std::min(end + 1, (r / m_chunk_rows + 1) * m_chunk_rows);
+
+            for (; r < last; r++)
+                data.cell(r - start, c) = chunk[r % m_chunk_rows];
+        }
+
+    return cdata_frame<T>(m_keys, data);
+}
+
+template <class T>
+cdata_frame<T> cdata_mapped_frame<T>::to_frame() const
+{
+    if (is_empty())
+        return cdata_frame<T>();
+
+    return slice_rows(0, m_height - 1);
+}
+
+// ==================================================
+// SETTER
+
+template <class T>
+void cdata_mapped_frame<T>::set(const size_t &row, const size_t &col, const T &val)
+{
+    if (row >= m_height || col >= m_width)
+        throw std::out_of_range("The cell (" + std::to_string(row) + ", " + std::to_string(col) + ") is out of range.");
+
+    __chunk(col, row / m_chunk_rows)[row % m_chunk_rows] = val;
+}
+
+template <class T>
+void cdata_mapped_frame<T>::push_row_back(const std::vector<T> &val)
+{
+    if (val.size() != m_width)
+        throw std::invalid_argument("The size of the row must be equal to the number of columns. Actual: " +
+                                    std::to_string(val.size()) +
+                                    ", Expected: " +
+                                    std::to_string(m_width) +
+                                    ".");
+
+    // Grow the file by a chunk of each column, the new pages are zeros without being written
+    if (m_height == m_n_chunks * m_chunk_rows)
+    {
+        if (ftruncate(m_fd, (m_n_chunks + 1) * m_width * __chunk_bytes()) == -1)
+            throw std::runtime_error(std::string("The scratch file can't grow: ") + std::strerror(errno) + ".");
+
+        m_n_chunks++;
+    }
+
+    m_height++;
+
+    for (size_t c = 0; c < m_width; c++)
+        set(m_height - 1, c, val[c]);
+}
+
+// ==================================================
+// REDUCTION
+
+template <class T>
+T cdata_mapped_frame<T>::sum(const std::string &key) const
+{
+    T res = T();
+
+    __scan(__get_key_pos(key), [&](const T *data, const size_t &n)
+           { for (size_t i = 0; i < n; i++)
+                 res += data[i]; });
+
+    return res;
+}
+
+template <class T>
+double cdata_mapped_frame<T>::mean(const std::string &key) const
+{
+    double res = 0;
+
+    __scan(__get_key_pos(key), [&](const T *data, const size_t &n)
+           { for (size_t i = 0; i < n; i++)
+                 res += data[i]; });
+
+    return m_height == 0 ? std::numeric_limits<double>::quiet_NaN() : res / m_height;
+}
+
+template <class T>
+T cdata_mapped_frame<T>::min(const std::string &key) const
+{
+    const size_t pos = __get_key_pos(key);
+
+    if (is_empty())
+        throw std::runtime_error("The column has no valid element.");
+
+    T res = get(0, pos);
+
+    __scan(pos, [&](const T *data, const size_t &n)
+           { for (size_t i = 0; i < n; i++)
+                 if (data[i] < res)
+                     res = data[i]; });
+
+    return res;
+}
+
+template <class T>
+T cdata_mapped_frame<T>::max(const std::string &key) const
+{
+    const size_t pos = __get_key_pos(key);
+
+    if (is_empty())
+        throw std::runtime_error("The column has no valid element.");
+
+    T res = get(0, pos);
+
+    __scan(pos, [&](const T *data, const size_t &n)
+           { for (size_t i = 0; i < n; i++)
+                 if (res < data[i])
+                     res = data[i]; });
+
+    return res;
+}
+
+// ==================================================
+// PRIVATE
+
+template <class T>
+size_t cdata_mapped_frame<T>::__chunk_bytes() const
+{
+    return m_chunk_rows * sizeof(T);
+}
+
+template <class T>
+T *cdata_mapped_frame<T>::__chunk(const size_t &col, const size_t &chunk) const
+{
+    // The chunks of a row of chunks are next to each other in the file
+    const size_t id = chunk * m_width + col;
+    typename std::unordered_map<size_t, cdata_chunk>::iterator it = m_resident.find(id);
+
+    // Resident: move it to the front of the list
+    if (it != m_resident.end())
+    {
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lru);
+        return it->second.data;
+    }
+
+    void *data = mmap(nullptr, __chunk_bytes(), PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, id * __chunk_bytes());
+    if (data == MAP_FAILED)
+        throw std::runtime_error(std::string("The chunk can't be mapped: ") + std::strerror(errno) + ".");
+
+    m_n_maps++;
+    m_lru.push_front(id);
+    m_resident[id] = cdata_chunk{static_cast<T *>(data), m_lru.begin()};
+
+    __evict(1);
+
+    return static_cast<T *>(data);
+}
+
+template <class T>
+void cdata_mapped_frame<T>::__evict(const size_t &keep) const
+{
+    while (m_resident.size() > keep && resident() > m_max_resident)
+    {
+        const size_t id = m_lru.back();
+        m_lru.pop_back();
+
+        munmap(m_resident[id].data, __chunk_bytes());
+        m_resident.erase(id);
+    }
+}
+
+template <class T>
+size_t cdata_mapped_frame<T>::__get_key_pos(const std::string &key) const
+{
+    for (size_t c = 0; c < m_width; c++)
+        if (m_keys[c] == key)
+            return c;
+
+    throw std::invalid_argument("The key '" + key + "' doesn't exist.");
+}
+
+template <class T>
+template <class Function>
+void cdata_mapped_frame<T>::__scan(const size_t &col, Function func) const
+{
+    const size_t n_chunks = (m_height + m_chunk_rows - 1) / m_chunk_rows;
+
+    for (size_t k = 0; k < n_chunks; k++)
+    {
+        T *data = __chunk(col, k);
+        madvise(data, __chunk_bytes(), MADV_SEQUENTIAL);
+
+        // Read the next chunk ahead while this one is processed, if the budget keeps both
+        if (k + 1 < n_chunks && 2 * __chunk_bytes() <= m_max_resident)
+        {
+            madvise(__chunk(col, k + 1), __chunk_bytes(), MADV_WILLNEED);
+            data = __chunk(col, k);
+        }
+
+        func(static_cast<const T *>(data), std::min(m_chunk_rows, m_height - k * m_chunk_rows));
+    }
+}
@@ -0,0 +1,372 @@
+/**
+ * @file CDataMask.tpp
+ * @brief File containing the implementation of the 'cdata_mask' class.
+ *
+ * @see CDataMask.hpp
+ * @defgroup mask
+ */
+
+// ==================================================
+// STATIC
+
+inline size_t cdata_mask::n_words(const size_t &size)
+{
+    return (size + word_bits - 1) / word_bits;
+}
+
+inline size_t cdata_mask::popcount(const uint64_t &word)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#else
+    // Count the bits in parallel: pairs, nibbles, then sum the bytes
+    uint64_t w = word - ((word >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (w * 0x0101010101010101ULL) >> 56;
+#endif
+}
+
+inline size_t cdata_mask::lowest_bit(const uint64_t &word)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(word);
+#else
+    return popcount((word & (~word + 1)) - 1);
+#endif
+}
+
+template <class Predicate>
+cdata_mask cdata_mask::from_predicate(const size_t &size, Predicate pred)
+{
+    cdata_mask mask(size);
+
+#pragma omp parallel for
+    for (size_t w = 0; w < mask.m_words.size(); w++)
+    {
+        const size_t start = w * word_bits;
+        const size_t end = std::min(start + word_bits, size);
+        uint64_t word = 0;
+
+        // Set the bits branch-free
+        for (size_t i = start; i < end; i++)
+            word |= uint64_t(bool(pred(i))) << (i - start);
+
+        mask.m_words[w] = word;
+    }
+
+    return mask;
+}
+
+// ==================================================
+// CONSTRUCTOR
+
+inline cdata_mask::cdata_mask() {}
+
+inline cdata_mask::cdata_mask(const size_t &size, const bool &val)
+    : m_words(n_words(size), val ? ~uint64_t(0) : uint64_t(0)), m_size(size)
+{
+    __clear_tail();
+}
+
+inline cdata_mask::cdata_mask(const std::initializer_list<bool> &vals)
+    : cdata_mask(std::vector<bool>(vals)) {}
+
+inline cdata_mask::cdata_mask(const std::vector<bool> &vals)
+    : m_words(n_words(vals.size()), 0), m_size(vals.size())
+{
+    for (size_t i = 0; i < vals.size(); i++)
+        if (vals[i])
+            m_words[i / word_bits] |= uint64_t(1) << (i % word_bits);
+}
+
+// ==================================================
+// GETTER
+
+inline size_t cdata_mask::size() const
+{
+    return m_size;
+}
+
+inline bool cdata_mask::empty() const
+{
+    return m_size == 0;
+}
+
+inline bool cdata_mask::get(const size_t &pos) const
+{
+    if (pos >= m_size)
+        throw std::out_of_range("The position " + std::to_string(pos) + " is out of range.");
+
+    return (m_words[pos / word_bits] >> (pos % word_bits)) & 1;
+}
+
+inline const std::vector<uint64_t> &cdata_mask::words() const
+{
+    return m_words;
+}
+
+inline size_t cdata_mask::count() const
+{
+    size_t n = 0;
+
+    for (const uint64_t &word : m_words)
+        n += popcount(word);
+
+    return n;
+}
+
+inline bool cdata_mask::all() const
+{
+    return count() == m_size;
+}
+
+inline bool cdata_mask::any() const
+{
+    for (const uint64_t &word : m_words)
+        if (word != 0)
+            return true;
+
+    return false;
+}
+
+inline std::vector<size_t> cdata_mask::positions() const
+{
+    std::vector<size_t> pos;
+    pos.reserve(count());
+
+    // Iterate only over the bits set of each word
+    for (size_t w = 0; w < m_words.size(); w++)
+        for (uint64_t bits = m_words[w]; bits != 0; bits &= bits - 1)
+            pos.push_back(w * word_bits + lowest_bit(bits));
+
+    return pos;
+}
+
+// ==================================================
+// SETTER
+
+inline void cdata_mask::set(const size_t &pos, const bool &val)
+{
+    if (pos >= m_size)
+        throw std::out_of_range("The position " + std::to_string(pos) + " is out of range.");
+
+    const uint64_t bit = uint64_t(1) << (pos % word_bits);
+
+    if (val)
+        m_words[pos / word_bits] |= bit;
+    else
+        m_words[pos / word_bits] &= ~bit;
+}
+
+// ==================================================
+// MANIPULATION
+
+inline void cdata_mask::push_back(const bool &val)
+{
+    if (m_size % word_bits == 0)
+        m_words.push_back(0);
+
+    if (val)
+        m_words.back() |= uint64_t(1) << (m_size % word_bits);
+
+    m_size++;
+}
+
+inline void cdata_mask::insert(const size_t &pos, const bool &val)
+{
+    if (pos > m_size)
+        throw std::out_of_range("The position " + std::to_string(pos) + " is out of range.");
+
+    if (m_size % word_bits == 0)
+        m_words.push_back(0);
+
+    m_size++;
+
+    // Shift the words after the position, carrying the highest bit of the previous word
+    const size_t w0 = pos / word_bits;
+    for (size_t w = m_words.size() - 1; w > w0; w--)
+        m_words[w] = (m_words[w] << 1) | (m_words[w - 1] >> (word_bits - 1));
+
+    // Shift the bits of the word from the position and insert the new bit
+    const uint64_t low = (uint64_t(1) << (pos % word_bits)) - 1;
+    const uint64_t word = m_words[w0];
+    m_words[w0] = (word & low) | ((word & ~low) << 1) | (uint64_t(val) << (pos % word_bits));
+}
+
+inline void cdata_mask::erase(const size_t &pos)
+{
+    if (pos >= m_size)
+        throw std::out_of_range("The position " + std::to_string(pos) + " is out of range.");
+
+    // Remove the bit from its word and shift the next bits of the word
+    const size_t w0 = pos / word_bits;
+    const uint64_t low = (uint64_t(1) << (pos % word_bits)) - 1;
+    const uint64_t word = m_words[w0];
+    m_words[w0] = (word & low) | ((word >> 1) & ~low);
+
+    // Shift the next words, carrying their lowest bit in the highest bit of the previous word
+    for (size_t w = w0 + 1; w < m_words.size(); w++)
+    {
+        m_words[w - 1] |= m_words[w] << (word_bits - 1);
+        m_words[w] >>= 1;
+    }
+
+    m_size--;
+    m_words.resize(n_words(m_size));
+}
+
+inline void cdata_mask::append(const cdata_mask &mask)
+{
+    const size_t shift = m_size % word_bits;
+
+    // Aligned: the words are copied as is
+    if (shift == 0)
+        m_words.insert(m_words.end(), mask.m_words.begin(), mask.m_words.end());
+
+    // Unaligned: each word is split between the last word and a new one
+    else
+        for (const uint64_t &word : mask.m_words)
+        {
+            m_words.back() |= word << shift;
+            m_words.push_back(word >> (word_bits - shift));
+        }
+
+    m_size += mask.m_size;
+    m_words.resize(n_words(m_size));
+    __clear_tail();
+}
+
+inline cdata_mask cdata_mask::slice(const size_t &start, const size_t &end) const
+{
+    if (start > end)
+        throw std::invalid_argument("The start position must be less than or equal to the end position.");
+
+    if (end >= m_size)
+        throw std::out_of_range("The position " + std::to_string(end) + " is out of range.");
+
+    cdata_mask mask(end - start + 1);
+
+    for (size_t w = 0; w < mask.m_words.size(); w++)
+        mask.m_words[w] = __word_at(start + w * word_bits);
+
+    mask.__clear_tail();
+    return mask;
+}
+
+// ==================================================
+// OPERATOR
+
+inline bool cdata_mask::operator[](const size_t &pos) const
+{
+    return get(pos);
+}
+
+inline cdata_mask cdata_mask::operator&(const cdata_mask &mask) const
+{
+    cdata_mask res = *this;
+    res &= mask;
+    return res;
+}
+
+inline cdata_mask cdata_mask::operator|(const cdata_mask &mask) const
+{
+    cdata_mask res = *this;
+    res |= mask;
+    return res;
+}
+
+inline cdata_mask cdata_mask::operator^(const cdata_mask &mask) const
+{
+    cdata_mask res = *this;
+    res ^= mask;
+    return res;
+}
+
+inline cdata_mask cdata_mask::operator~() const
+{
+    cdata_mask res = *this;
+
+    for (uint64_t &word : res.m_words)
+        word = ~word;
+
+    res.__clear_tail();
+    return res;
+}
+
+inline cdata_mask &cdata_mask::operator&=(const cdata_mask &mask)
+{
+    __check_same_size(mask);
+
+    for (size_t w = 0; w < m_words.size(); w++)
+        m_words[w] &= mask.m_words[w];
+
+    return *this;
+}
+
+inline cdata_mask &cdata_mask::operator|=(const cdata_mask &mask)
+{
+    __check_same_size(mask);
+
+    for (size_t w = 0; w < m_words.size(); w++)
+        m_words[w] |= mask.m_words[w];
+
+    return *this;
+}
+
+inline cdata_mask &cdata_mask::operator^=(const cdata_mask &mask)
+{
+    __check_same_size(mask);
+
+    for (size_t w = 0; w < m_words.size(); w++)
+        m_words[w] ^= mask.m_words[w];
+
+    return *this;
+}
+
+inline bool cdata_mask::operator==(const cdata_mask &mask) const
+{
+    return m_size == mask.m_size && m_words == mask.m_words;
+}
+
+inline bool cdata_mask::operator!=(const cdata_mask &mask) const
+{
+    return not(*this == mask);
+}
+
+// ==================================================
+// PRIVATE
+
+inline void cdata_mask::__clear_tail()
+{
+    // Keep only the bits of the last word that are part of the mask
+    if (m_size % word_bits != 0)
+        m_words.back() &= (uint64_t(1) << (m_size % word_bits)) - 1;
+}
+
+inline uint64_t cdata_mask::__word_at(const size_t &pos) const
+{
+    const size_t w = pos / word_bits;
+    const size_t shift = pos % word_bits;
+
+    if (w >= m_words.size())
+        return 0;
+
+    uint64_t word = m_words[w] >> shift;
+
+    // Complete with the lowest bits of the next word
+    if (shift != 0 && w + 1 < m_words.size())
+        word |= m_words[w + 1] << (word_bits - shift);
+
+    return word;
+}
+
+inline void cdata_mask::__check_same_size(const cdata_mask &mask) const
+{
+    if (m_size != mask.m_size)
+        throw std::invalid_argument("The masks must have the same size. Actual: " +
+                                    std::to_string(mask.m_size) +
+                                    ", Expected: " +
+                                    std::to_string(m_size) +
+                                    ".");
+}
@@ -0,0 +1,256 @@
+/**
+ * @file CDataParse.tpp
+ * @brief File containing the implementation of the 'cdata_parse' struct.
+ *
+ * @see CDataParse.hpp
+ * @defgroup parse
+ */
+
+// ==================================================
+// PARSE
+
+template <class U>
+bool cdata_parse::parse(const char *first, const char *last, U &out)
+{
+    // Skip the spaces around the number, the lines of a csv file may end with '\r'
+    while (first != last && (*first == ' ' || *first == '\t' || *first == '\r' || *first == '\n'))
+        first++;
+
+    while (last != first && (last[-1] == ' ' || last[-1] == '\t' || last[-1] == '\r' || last[-1] == '\n'))
+        last--;
+
+    return __parse(first, last, out, std::is_integral<U>());
+}
+
+template <class U>
+bool cdata_parse::__parse(const char *first, const char *last, U &out, std::true_type)
+{
+    bool negative = false;
+
+    if (first != last && (*first == '+' || *first == '-'))
+        negative = *first++ == '-';
+
+    if (first == last)
+        return false;
+
+    // The largest magnitude allowed by the sign
+    const unsigned long long max = not negative ? static_cast<unsigned long long>(std::numeric_limits<U>::max())
+                                   : std::is_signed<U>::value ? static_cast<unsigned long long>(std::numeric_limits<U>::max()) + 1
+                                                              : 0;
+    unsigned long long val = 0;
+
+    for (; first != last; first++)
+    {
+        if (*first < '0' || *first > '9')
+            return false;
+
+        const unsigned int digit = *first - '0';
+
+        if (digit > max || val > (max - digit) / 10)
+            return false;
+
+        val = val * 10 + digit;
+    }
+
+    out = negative && val != 0 ? static_cast<U>(-static_cast<long long>(val - 1) - 1) : static_cast<U>(val);
+    return true;
+}
+
+template <class U>
+bool cdata_parse::__parse(const char *first, const char *last, U &out, std::false_type)
+{
+    const char *begin = first;
+    bool negative = false;
+
+    if (first != last && (*first == '+' || *first == '-'))
+        negative = *first++ == '-';
+
+    // Special values
+    if (__match(first, last, "infinity") || __match(first, last, "inf"))
+    {
+        if (first != last)
+            return false;
+
+        out = static_cast<U>(negative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity());
+        return true;
+    }
+
+    if (__match(first, last, "nan"))
+    {
+        if (first != last)
+            return false;
+
+        out = std::numeric_limits<U>::quiet_NaN();
+        return true;
+    }
+
+    // The 19 first significant digits fit in the mantissa, the others make the fast path inexact
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    int n_digits = 0;
+    bool has_digits = false;
+    bool truncated = false;
+
+    for (; first != last && *first >= '0' && *first <= '9'; first++)
+    {
+        has_digits = true;
+
+        if (mantissa == 0 && *first == '0')
+            continue;
+
+        if (n_digits < 19)
+        {
+            mantissa = mantissa * 10 + (*first - '0');
+            n_digits++;
+        }
+        else
+        {
+            exponent++;
+            truncated = true;
+        }
+    }
+
+    if (first != last && *first == '.')
+        for (first++; first != last && *first >= '0' && *first <= '9'; first++)
+        {
+            has_digits = true;
+
+            if (mantissa == 0 && *first == '0')
+                exponent--;
+
+            else if (n_digits < 19)
+            {
+                mantissa = mantissa * 10 + (*first - '0');
+                n_digits++;
+                exponent--;
+            }
+
+            else
+                truncated = true;
+        }
+
+    if (not has_digits)
+        return false;
+
+    if (first != last && (*first == 'e' || *first == 'E'))
+    {
+        bool negative_exp = false;
+        int exp = 0;
+
+        if (++first != last && (*first == '+' || *first == '-'))
+            negative_exp = *first++ == '-';
+
+        if (first == last)
+            return false;
+
+        for (; first != last; first++)
+        {
+            if (*first < '0' || *first > '9')
+                return false;
+
+            if (exp < 100000)
+                exp = exp * 10 + (*first - '0');
+        }
+
+        exponent += negative_exp ? -exp : exp;
+    }
+
+    if (first != last)
+        return false;
+
+    // Fast path: the mantissa and the power of 10 are exact in the type, so their product is correctly rounded
+    // The powers of 10 are exact up to 1e10 in a float and 1e22 in a double
+    static const U powers[] = {U(1e0), U(1e1), U(1e2), U(1e3), U(1e4), U(1e5), U(1e6), U(1e7), U(1e8), U(1e9), U(1e10), U(1e11),
+                               U(1e12), U(1e13), U(1e14), U(1e15), U(1e16), U(1e17), U(1e18), U(1e19), U(1e20), U(1e21), U(1e22)};
+
+    const int digits = std::numeric_limits<U>::digits;
+    const int max_exponent = digits < 53 ? 10 : 22;
+    const uint64_t max_mantissa = digits < 64 ? uint64_t(1) << digits : ~uint64_t(0);
+
+    if (not truncated && mantissa <= max_mantissa && exponent >= -max_exponent && exponent <= max_exponent)
+    {
+        const U val = exponent < 0 ? U(mantissa) / powers[-exponent] : U(mantissa) * powers[exponent];
+        out = negative ? -val : val;
+        return true;
+    }
+
+    // Slow path, independent of the global locale, read in the type so it is rounded once
+    std::istringstream is(std::string(begin, last));
+    is.imbue(std::locale::classic());
+
+    U val;
+    is >> val;
+
+    if (is.fail())
+        return false;
+
+    out = val;
+    return true;
+}
+
+inline bool cdata_parse::__match(const char *&first, const char *last, const char *word)
+{
+    const char *it = first;
+
+    for (; *word != '\0'; it++, word++)
+        if (it == last || (*it | 0x20) != *word)
+            return false;
+
+    first = it;
+    return true;
+}
+
+// ==================================================
+// FORMAT
+
+template <class U>
+void cdata_parse::format(std::string &out, const U &val)
+{
+    __format(out, val, std::is_integral<U>());
+}
+
+template <class U>
+void cdata_parse::__format(std::string &out, const U &val, std::true_type)
+{
+    // Write the digits from the end of the buffer
+    char buffer[24];
+    char *end = buffer + sizeof(buffer);
+    char *p = end;
+
+    const bool negative = val < U(0);
+    unsigned long long u = negative ? 0ULL - static_cast<unsigned long long>(val) : static_cast<unsigned long long>(val);
+
+    do
+    {
+        *--p = static_cast<char>('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+
+    if (negative)
+        *--p = '-';
+
+    out.append(p, end);
+}
+
+template <class U>
+void cdata_parse::__format(std::string &out, const U &val, std::false_type)
+{
+    const double x = static_cast<double>(val);
+    const char point = *std::localeconv()->decimal_point;
+
+    // The shortest of the two precisions that reads back to the same number
+    char buffer[32];
+    int size = 0;
+
+    for (const char *fmt : {"%.15g", "%.17g"})
+    {
+        size = std::snprintf(buffer, sizeof(buffer), fmt, x);
+        std::replace(buffer, buffer + size, point, '.');
+
+        double back;
+        if (not __parse(buffer, buffer + size, back, std::false_type()) || back == x || x != x)
+            break;
+    }
+
+    out.append(buffer, size);
+}
@@ -0,0 +1,163 @@
+/**
+ * @file CDataReader.tpp
+ * @brief File containing the implementation of the 'cdata_reader' class.
+ *
+ * @see CDataReader.hpp
+ * @defgroup reader
+ */
+
+// ==================================================
+// CONSTRUCTOR
+
+inline cdata_reader::cdata_reader(const std::string &path, const size_t &buffer_size, const size_t &n_buffers)
+{
+    if (n_buffers < 2 || buffer_size == 0)
+        throw std::invalid_argument("The reader must have at least 2 buffers of at least one byte.");
+
+    m_fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_fd == -1)
+        throw std::runtime_error("The file '" + path + "' can't be opened: " + std::strerror(errno) + ".");
+
+    // The file is read once from the start to the end
+    posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    const size_t page = sysconf(_SC_PAGESIZE);
+    m_buffer_size = (buffer_size + page - 1) / page * page;
+
+    for (size_t i = 0; i < n_buffers; i++)
+    {
+        void *buffer = nullptr;
+
+        if (posix_memalign(&buffer, page, m_buffer_size) != 0)
+        {
+            for (char *b : m_buffers)
+                std::free(b);
+
+            close(m_fd);
+            throw std::bad_alloc();
+        }
+
+        m_buffers.push_back(static_cast<char *>(buffer));
+    }
+
+    m_free = m_buffers;
+    m_thread = std::thread(&cdata_reader::__run, this);
+}
+
+inline cdata_reader::~cdata_reader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_cond.notify_all();
+    m_thread.join();
+
+    for (char *buffer : m_buffers)
+        std::free(buffer);
+
+    close(m_fd);
+}
+
+// ==================================================
+// READ
+
+inline bool cdata_reader::read(std::string &out)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cond.wait(lock, [this]()
+                { return not m_filled.empty() || m_eof; });
+
+    if (m_filled.empty())
+    {
+        if (m_error)
+            std::rethrow_exception(m_error);
+
+        return false;
+    }
+
+    const cdata_block block = m_filled.front();
+    m_filled.pop_front();
+
+    // Copy without the lock, the thread fills the other buffers meanwhile
+    lock.unlock();
+    out.append(block.data, block.size);
+    lock.lock();
+
+    m_free.push_back(block.data);
+    m_cond.notify_all();
+
+    return true;
+}
+
+inline size_t cdata_reader::buffer_size() const
+{
+    return m_buffer_size;
+}
+
+// ==================================================
+// PRIVATE
+
+inline void cdata_reader::__run()
+{
+    off_t offset = 0;
+
+    for (;;)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this]()
+                    { return not m_free.empty() || m_stop; });
+
+        if (m_stop)
+            return;
+
+        char *buffer = m_free.back();
+        m_free.pop_back();
+        lock.unlock();
+
+        // Fill the buffer, a read may return less than asked before the end of the file
+        size_t size = 0;
+        bool eof = false;
+
+        while (size < m_buffer_size)
+        {
+            const ssize_t n = pread(m_fd, buffer + size, m_buffer_size - size, offset + size);
+
+            if (n == -1 && errno == EINTR)
+                continue;
+
+            if (n == -1)
+            {
+                lock.lock();
+                m_error = std::make_exception_ptr(std::runtime_error(std::string("The file can't be read: ") + std::strerror(errno) + "."));
+                m_eof = true;
+                m_cond.notify_all();
+                return;
+            }
+
+            if (n == 0)
+            {
+                eof = true;
+                break;
+            }
+
+            size += n;
+        }
+
+        offset += size;
+
+        lock.lock();
+
+        if (size != 0)
+            m_filled.push_back(cdata_block{buffer, size});
+        else
+            m_free.push_back(buffer);
+
+        m_eof = eof;
+        m_cond.notify_all();
+
+        if (eof)
+            return;
+    }
+}
@@ -0,0 +1,345 @@
+/**
+ * @file CDataRingFrame.tpp
+ * @brief File containing the implementation of the 'cdata_ring_frame' class.
+ *
+ * @see CDataRingFrame.hpp
+ * @defgroup ring
+ */
+
+// ==================================================
+// CONSTRUCTOR
+
+template <class T>
+cdata_ring_frame<T>::cdata_ring_frame(const std::vector<std::string> &keys) : m_keys(keys), m_width(keys.size()) {}
+
+template <class T>
+cdata_ring_frame<T>::cdata_ring_frame(const cdata_frame<T> &df) : m_keys(df.keys()), m_width(df.width())
+{
+    const std::vector<std::string> index = df.index();
+    reserve(df.height());
+
+    for (size_t r = 0; r < df.height(); r++)
+        push_row_back(df.rows_vec(r));
+
+    // The index of the data frame is unique, an empty label included
+    for (size_t r = 0; r < index.size(); r++)
+    {
+        m_index[__slot(r)] = index[r];
+        m_labels.insert(index[r]);
+    }
+}
+
+// ==================================================
+// GETTER
+
+template <class T>
+size_t cdata_ring_frame<T>::height() const
+{
+    return m_height;
+}
+
+template <class T>
+size_t cdata_ring_frame<T>::width() const
+{
+    return m_width;
+}
+
+template <class T>
+size_t cdata_ring_frame<T>::capacity() const
+{
+    return m_rows.size();
+}
+
+template <class T>
+bool cdata_ring_frame<T>::is_empty() const
+{
+    return m_height == 0;
+}
+
+template <class T>
+std::vector<std::string> cdata_ring_frame<T>::keys() const
+{
+    return m_keys;
+}
+
+template <class T>
+const std::string &cdata_ring_frame<T>::index(const size_t &pos) const
+{
+    __check_pos(pos);
+    return m_index[__slot(pos)];
+}
+
+template <class T>
+const std::vector<T> &cdata_ring_frame<T>::row(const size_t &pos) const
+{
+    __check_pos(pos);
+    return m_rows[__slot(pos)];
+}
+
+template <class T>
+T &cdata_ring_frame<T>::cell(const size_t &row, const size_t &col)
+{
+    __check_pos(row);
+
+    if (col >= m_width)
+        throw std::out_of_range("The column " + std::to_string(col) + " is out of range.");
+
+    return m_rows[__slot(row)][col];
+}
+
+template <class T>
+const T &cdata_ring_frame<T>::cell(const size_t &row, const size_t &col) const
+{
+    __check_pos(row);
+
+    if (col >= m_width)
+        throw std::out_of_range("The column " + std::to_string(col) + " is out of range.");
+
+    return m_rows[__slot(row)][col];
+}
+
+// ==================================================
+// MANIPULATION
+
+template <class T>
+void cdata_ring_frame<T>::push_row_back(const std::vector<T> &val, const std::string &index)
+{
+    __check_row(val);
+    __insert_label(index);
+    reserve(m_height + 1);
+
+    // The slot of a removed row keeps its memory, the assignment reuses it
+    const size_t slot = __slot(m_height);
+    m_rows[slot] = val;
+    m_index[slot] = index;
+    m_height++;
+}
+
+template <class T>
+void cdata_ring_frame<T>::push_row_front(const std::vector<T> &val, const std::string &index)
+{
+    __check_row(val);
+    __insert_label(index);
+    reserve(m_height + 1);
+
+    m_head = (m_head + m_rows.size() - 1) & (m_rows.size() - 1);
+    m_rows[m_head] = val;
+    m_index[m_head] = index;
+    m_height++;
+}
+
+template <class T>
+void cdata_ring_frame<T>::pop_row_front()
+{
+    if (is_empty())
+        throw std::out_of_range("The data frame is empty.");
+
+    __erase_label(m_head);
+    m_head = (m_head + 1) & (m_rows.size() - 1);
+    m_height--;
+}
+
+template <class T>
+void cdata_ring_frame<T>::pop_row_back()
+{
+    if (is_empty())
+        throw std::out_of_range("The data frame is empty.");
+
+    __erase_label(__slot(m_height - 1));
+    m_height--;
+}
+
+template <class T>
+void cdata_ring_frame<T>::insert_row(const size_t &pos, const std::vector<T> &val, const std::string &index)
+{
+    if (pos > m_height)
+        throw std::out_of_range("The row " + std::to_string(pos) + " is out of range.");
+
+    __check_row(val);
+    __insert_label(index);
+    reserve(m_height + 1);
+
+    // Move the rows before the position one slot backward
+    if (pos < m_height / 2)
+    {
+        m_head = (m_head + m_rows.size() - 1) & (m_rows.size() - 1);
+
+        for (size_t i = 0; i < pos; i++)
+        {
+            std::swap(m_rows[__slot(i)], m_rows[__slot(i + 1)]);
+            std::swap(m_index[__slot(i)], m_index[__slot(i + 1)]);
+        }
+    }
+
+    // Otherwise, move the rows after the position one slot forward
+    else
+        for (size_t i = m_height; i > pos; i--)
+        {
+            std::swap(m_rows[__slot(i)], m_rows[__slot(i - 1)]);
+            std::swap(m_index[__slot(i)], m_index[__slot(i - 1)]);
+        }
+
+    m_rows[__slot(pos)] = val;
+    m_index[__slot(pos)] = index;
+    m_height++;
+}
+
+template <class T>
+void cdata_ring_frame<T>::remove_row(const size_t &pos)
+{
+    __check_pos(pos);
+    __erase_label(__slot(pos));
+
+    // Move the rows before the position one slot forward
+    if (pos < m_height / 2)
+    {
+        for (size_t i = pos; i > 0; i--)
+        {
+            std::swap(m_rows[__slot(i)], m_rows[__slot(i - 1)]);
+            std::swap(m_index[__slot(i)], m_index[__slot(i - 1)]);
+        }
+
+        m_head = (m_head + 1) & (m_rows.size() - 1);
+    }
+
+    // Otherwise, move the rows after the position one slot backward
+    else
+        for (size_t i = pos; i + 1 < m_height; i++)
+        {
+            std::swap(m_rows[__slot(i)], m_rows[__slot(i + 1)]);
+            std::swap(m_index[__slot(i)], m_index[__slot(i + 1)]);
+        }
+
+    m_height--;
+}
+
+template <class T>
+void cdata_ring_frame<T>::reserve(const size_t &n)
+{
+    if (n <= m_rows.size())
+        return;
+
+    size_t capacity = m_rows.size() == 0 ? 8 : m_rows.size();
+    while (capacity < n)
+        capacity *= 2;
+
+    // Move the rows at the start of the new ring
+    std::vector<std::vector<T>> rows(capacity);
+    std::vector<std::string> index(capacity);
+
+    for (size_t i = 0; i < m_height; i++)
+    {
+        rows[i] = std::move(m_rows[__slot(i)]);
+        index[i] = std::move(m_index[__slot(i)]);
+    }
+
+    m_rows.swap(rows);
+    m_index.swap(index);
+    m_head = 0;
+}
+
+template <class T>
+void cdata_ring_frame<T>::clear()
+{
+    m_head = 0;
+    m_height = 0;
+    m_labels.clear();
+
+    if (m_keys.empty())
+        m_width = 0;
+}
+
+// ==================================================
+// CONVERSION
+
+template <class T>
+cdata_frame<T> cdata_ring_frame<T>::to_frame() const
+{
+    if (is_empty())
+        return cdata_frame<T>();
+
+    CDATA_TRACE_SCOPE("to_frame");
+    CDATA_TRACE_COUNT(height(), height() * width() * sizeof(T), 1);
+
+    std::vector<std::vector<T>> data(m_height);
+    std::vector<std::string> index(m_height);
+    bool has_index = false;
+
+    for (size_t i = 0; i < m_height; i++)
+    {
+        data[i] = m_rows[__slot(i)];
+        index[i] = m_index[__slot(i)];
+        has_index = has_index || not index[i].empty();
+    }
+
+    if (m_keys.empty())
+        return has_index ? cdata_frame<T>(cmatrix<T>(data), index) : cdata_frame<T>(cmatrix<T>(data));
+
+    return has_index ? cdata_frame<T>(m_keys, cmatrix<T>(data), index) : cdata_frame<T>(m_keys, cmatrix<T>(data));
+}
+
+// ==================================================
+// PRIVATE
+
+template <class T>
+size_t cdata_ring_frame<T>::__slot(const size_t &pos) const
+{
+    // The capacity is a power of two
+    return (m_head + pos) & (m_rows.size() - 1);
+}
+
+template <class T>
+void cdata_ring_frame<T>::__check_pos(const size_t &pos) const
+{
+    if (pos >= m_height)
+        throw std::out_of_range("The row " + std::to_string(pos) + " is out of range.");
+}
+
+template <class T>
+void cdata_ring_frame<T>::__check_row(const std::vector<T> &val)
+{
+    // The first row gives the width of a data frame without keys
+    if (m_height == 0 && m_keys.empty())
+        m_width = val.size();
+
+    else if (val.size() != m_width)
+        throw std::invalid_argument("The number of columns is different from the width of the data frame. Actual: " +
+                                    std::to_string(val.size()) +
+                                    ", Expected: " +
+                                    std::to_string(m_width) +
+                                    ".");
+}
+
+template <class T>
+void cdata_ring_frame<T>::__insert_label(const std::string &index)
+{
+    // The labels of a data frame with an index are unique, even the empty one
+    if (not m_labels.empty())
+    {
+        if (not m_labels.insert(index).second)
+            throw std::runtime_error("The index '" + index + "' already exists.");
+    }
+
+    else if (not index.empty())
+    {
+        for (size_t i = 0; i < m_height; i++)
+        {
+            std::string &label = m_index[__slot(i)];
+            label = std::to_string(i);
+
+            if (label == index)
+                label = index + label;
+
+            m_labels.insert(label);
+        }
+
+        m_labels.insert(index);
+    }
+}
+
+template <class T>
+void cdata_ring_frame<T>::__erase_label(const size_t &slot)
+{
+    if (not m_labels.empty())
+        m_labels.erase(m_index[slot]);
+}
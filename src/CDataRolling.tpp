@@ -0,0 +1,294 @@
+/**
+ * @file CDataRolling.tpp
+ * @brief File containing the implementation of the 'cdata_rolling' class.
+ *
+ * @see CDataRolling.hpp
+ * @defgroup rolling
+ */
+
+// ==================================================
+// ACCUMULATORS
+// Each accumulator is updated when a valid element enters (add) or leaves (remove) the window.
+// 'min_count' is the number of valid elements needed to compute the statistic.
+
+/** @brief Number of valid elements of the window. */
+struct cdata_window_count
+{
+    static const size_t min_count = 0;
+    size_t m_n = 0;
+
+    void add(const size_t &, const double &) { m_n++; }
+    void remove(const size_t &, const double &) { m_n--; }
+    double value() const { return m_n; }
+};
+
+/** @brief Sum of the window, with Neumaier compensation to keep the error independent of the number of updates. */
+struct cdata_window_sum
+{
+    static const size_t min_count = 1;
+    double m_sum = 0;
+    double m_comp = 0;
+    size_t m_n = 0;
+
+    void add(const size_t &, const double &x)
+    {
+        __add(x);
+        m_n++;
+    }
+    void remove(const size_t &, const double &x)
+    {
+        __add(-x);
+        m_n--;
+    }
+    double value() const { return m_sum + m_comp; }
+    void __add(const double &x)
+    {
+        const double t = m_sum + x;
+
+        // Keep the low-order bits lost by the addition
+        if (std::abs(m_sum) >= std::abs(x))
+            m_comp += (m_sum - t) + x;
+        else
+            m_comp += (x - t) + m_sum;
+
+        m_sum = t;
+    }
+};
+
+/** @brief Mean of the window, from the compensated sum. */
+struct cdata_window_mean : cdata_window_sum
+{
+    double value() const { return cdata_window_sum::value() / m_n; }
+};
+
+/** @brief Sample variance of the window, with the Welford update and its inverse. */
+struct cdata_window_var
+{
+    static const size_t min_count = 2;
+    double m_mean = 0;
+    double m_m2 = 0;
+    size_t m_n = 0;
+
+    void add(const size_t &, const double &x)
+    {
+        m_n++;
+        const double delta = x - m_mean;
+        m_mean += delta / m_n;
+        m_m2 += delta * (x - m_mean);
+    }
+    void remove(const size_t &, const double &x)
+    {
+        if (--m_n == 0)
+        {
+            m_mean = m_m2 = 0;
+            return;
+        }
+
+        const double delta = x - m_mean;
+        m_mean -= delta / m_n;
+        m_m2 -= delta * (x - m_mean);
+    }
+    double value() const { return std::max(m_m2, 0.) / (m_n - 1); }
+};
+
+/** @brief Sample standard deviation of the window. */
+struct cdata_window_std : cdata_window_var
+{
+    double value() const { return std::sqrt(cdata_window_var::value()); }
+};
+
+/**
+ * @brief Extremum of the window, with a monotonic deque.
+ *
+ * The deque keeps the candidates in window order, each one better than the next ones, so the front is the extremum.
+ * Each element is pushed and popped at most once.
+ */
+template <class Compare>
+struct cdata_window_extremum
+{
+    static const size_t min_count = 1;
+    std::deque<std::pair<size_t, double>> m_deque;
+
+    void add(const size_t &i, const double &x)
+    {
+        // The candidates not better than the new element can't be the extremum anymore
+        while (not m_deque.empty() && not Compare()(m_deque.back().second, x))
+            m_deque.pop_back();
+
+        m_deque.push_back(std::make_pair(i, x));
+    }
+    void remove(const size_t &i, const double &)
+    {
+        if (not m_deque.empty() && m_deque.front().first == i)
+            m_deque.pop_front();
+    }
+    double value() const { return m_deque.front().second; }
+};
+
+// ==================================================
+// CONSTRUCTOR
+
+template <class T>
+cdata_rolling<T>::cdata_rolling(const cdata_frame<T> &df, const size_t &window, const size_t &min_periods)
+    : m_df(&df), m_window(window), m_min_periods(min_periods)
+{
+    if (window != 0 && min_periods > window)
+        throw std::invalid_argument("The minimum number of periods must be less than or equal to the window. Actual: " +
+                                    std::to_string(min_periods) +
+                                    ", Expected: " +
+                                    std::to_string(window) +
+                                    ".");
+}
+
+// ==================================================
+// GETTER
+
+template <class T>
+size_t cdata_rolling<T>::window() const
+{
+    return m_window;
+}
+
+template <class T>
+size_t cdata_rolling<T>::min_periods() const
+{
+    return m_min_periods;
+}
+
+// ==================================================
+// STATISTIC
+
+template <class T>
+cdata_frame<double> cdata_rolling<T>::count() const
+{
+    return __apply<cdata_window_count>();
+}
+
+template <class T>
+cdata_frame<double> cdata_rolling<T>::sum() const
+{
+    return __apply<cdata_window_sum>();
+}
+
+template <class T>
+cdata_frame<double> cdata_rolling<T>::mean() const
+{
+    return __apply<cdata_window_mean>();
+}
+
+template <class T>
+cdata_frame<double> cdata_rolling<T>::var() const
+{
+    return __apply<cdata_window_var>();
+}
+
+template <class T>
+cdata_frame<double> cdata_rolling<T>::std() const
+{
+    return __apply<cdata_window_std>();
+}
+
+template <class T>
+cdata_frame<double> cdata_rolling<T>::min() const
+{
+    return __apply<cdata_window_extremum<std::less<double>>>();
+}
+
+template <class T>
+cdata_frame<double> cdata_rolling<T>::max() const
+{
+    return __apply<cdata_window_extremum<std::greater<double>>>();
+}
+
+template <class T>
+cdata_frame<double> cdata_rolling<T>::agg(const std::string &func) const
+{
+    if (func == "count")
+        return count();
+
+    else if (func == "sum")
+        return sum();
+
+    else if (func == "mean")
+        return mean();
+
+    else if (func == "var")
+        return var();
+
+    else if (func == "std")
+        return std();
+
+    else if (func == "min")
+        return min();
+
+    else if (func == "max")
+        return max();
+
+    throw std::invalid_argument("The function '" + func + "' doesn't exist.");
+}
+
+// ==================================================
+// PRIVATE
+
+template <class T>
+template <class Accumulator>
+cdata_frame<double> cdata_rolling<T>::__apply() const
+{
+    const size_t height = m_df->height();
+    const size_t width = m_df->width();
+
+    cdata_frame<double> df;
+    if (height == 0)
+        return df;
+
+    // Allocate the result once, with the labels of the data frame
+    df.set_data(cmatrix<double>(height, width));
+    df.m_keys = m_df->m_keys;
+    df.m_index = m_df->m_index;
+    df.__init_valid();
+
+#pragma omp parallel for
+    for (size_t c = 0; c < width; c++)
+    {
+        // Gather the column once, the data is stored by rows
+        std::vector<double> values(height);
+        for (size_t r = 0; r < height; r++)
+            values[r] = static_cast<double>(m_df->cell(r, c));
+
+        const cdata_mask valid = m_df->__get_valid_mask(c);
+        const std::vector<uint64_t> &words = valid.words();
+        cdata_mask &out_valid = df.m_valid[c];
+
+        Accumulator acc;
+        size_t n_valid = 0;
+
+        for (size_t r = 0; r < height; r++)
+        {
+            // The row enters the window
+            if ((words[r / cdata_mask::word_bits] >> (r % cdata_mask::word_bits)) & 1)
+            {
+                acc.add(r, values[r]);
+                n_valid++;
+            }
+
+            // The oldest row leaves the window
+            if (m_window != 0 && r >= m_window)
+            {
+                const size_t old = r - m_window;
+
+                if ((words[old / cdata_mask::word_bits] >> (old % cdata_mask::word_bits)) & 1)
+                {
+                    acc.remove(old, values[old]);
+                    n_valid--;
+                }
+            }
+
+            if (n_valid >= m_min_periods && n_valid >= Accumulator::min_count)
+                df.cell(r, c) = acc.value();
+            else
+                out_valid.set(r, false);
+        }
+    }
+
+    return df;
+}
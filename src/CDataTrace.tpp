@@ -0,0 +1,167 @@
+/**
+ * @file CDataTrace.tpp
+ * @brief File containing the implementation of the 'cdata_trace' and 'cdata_trace_scope' classes.
+ *
+ * @see CDataTrace.hpp
+ * @defgroup trace
+ */
+
+// ==================================================
+// REGISTRY
+
+inline cdata_trace::cdata_trace() : m_origin(std::chrono::steady_clock::now()), m_max_events(default_max_events)
+{
+}
+
+inline cdata_trace &cdata_trace::instance()
+{
+    static cdata_trace trace;
+    return trace;
+}
+
+inline uint64_t cdata_trace::now() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_origin).count();
+}
+
+inline void cdata_trace::record(cdata_trace_event event)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Number the threads in order of appearance
+    const std::thread::id id = std::this_thread::get_id();
+    std::map<std::thread::id, size_t>::const_iterator it = m_threads.find(id);
+
+    if (it == m_threads.end())
+        it = m_threads.insert(std::make_pair(id, m_threads.size())).first;
+
+    event.thread = it->second;
+
+    cdata_trace_stats &stats = m_stats[event.name];
+    stats.calls++;
+    stats.duration += event.duration;
+    stats.rows += event.rows;
+    stats.bytes += event.bytes;
+    stats.allocations += event.allocations;
+
+    if (m_events.size() < m_max_events)
+        m_events.push_back(event);
+    else
+        m_dropped++;
+}
+
+inline void cdata_trace::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_stats.clear();
+    m_events.clear();
+    m_dropped = 0;
+}
+
+inline void cdata_trace::set_max_events(const size_t &max_events)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_max_events = max_events;
+}
+
+inline cdata_trace_stats cdata_trace::stats(const std::string &name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::map<std::string, cdata_trace_stats>::const_iterator it = m_stats.find(name);
+    return it == m_stats.end() ? cdata_trace_stats() : it->second;
+}
+
+inline std::map<std::string, cdata_trace_stats> cdata_trace::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+inline std::vector<cdata_trace_event> cdata_trace::events() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_events;
+}
+
+inline size_t cdata_trace::dropped() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_dropped;
+}
+
+inline void cdata_trace::write_chrome_trace(std::ostream &out) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Complete events ("ph": "X"), the times are in microseconds
+    out << "{\"traceEvents\":[";
+
+    for (size_t i = 0; i < m_events.size(); i++)
+    {
+        const cdata_trace_event &event = m_events[i];
+
+        out << (i == 0 ? "\n" : ",\n")
+            << "{\"name\":\"" << __escape_json(event.name) << "\""
+            << ",\"cat\":\"cdataframe\",\"ph\":\"X\""
+            << ",\"ts\":" << event.start / 1000 << "." << event.start % 1000 / 100
+            << ",\"dur\":" << event.duration / 1000 << "." << event.duration % 1000 / 100
+            << ",\"pid\":0,\"tid\":" << event.thread
+            << ",\"args\":{\"rows\":" << event.rows
+            << ",\"bytes\":" << event.bytes
+            << ",\"allocations\":" << event.allocations << "}}";
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":" << m_dropped << "}}\n";
+}
+
+inline void cdata_trace::write_chrome_trace(const std::string &path) const
+{
+    std::ofstream file(path);
+
+    if (not file.is_open())
+        throw std::invalid_argument("The file '" + path + "' can't be opened.");
+
+    write_chrome_trace(file);
+}
+
+inline std::string cdata_trace::__escape_json(const std::string &str)
+{
+    std::string res;
+    res.reserve(str.size());
+
+    for (const char &c : str)
+    {
+        if (c == '"' || c == '\\')
+            res += '\\';
+
+        res += c;
+    }
+
+    return res;
+}
+
+// ==================================================
+// SCOPE
+
+inline cdata_trace_scope::cdata_trace_scope(const char *name)
+{
+    m_event.name = name;
+    m_event.start = cdata_trace::instance().now();
+}
+
+inline cdata_trace_scope::~cdata_trace_scope()
+{
+    cdata_trace &trace = cdata_trace::instance();
+
+    m_event.duration = trace.now() - m_event.start;
+    trace.record(m_event);
+}
+
+inline void cdata_trace_scope::add(const size_t &rows, const size_t &bytes, const size_t &allocations)
+{
+    m_event.rows += rows;
+    m_event.bytes += bytes;
+    m_event.allocations += allocations;
+}
@@ -0,0 +1,477 @@
+/**
+ * @file CDataVersioned.tpp
+ * @brief File containing the implementation of the 'cdata_versioned' and 'cdata_snapshot' classes.
+ *
+ * @see CDataVersioned.hpp
+ * @defgroup versioned
+ */
+
+// ==================================================
+// SNAPSHOT
+
+template <class T>
+cdata_snapshot<T>::cdata_snapshot(const std::shared_ptr<const cdata_version<T>> &version) : m_version(version)
+{
+}
+
+template <class T>
+size_t cdata_snapshot<T>::version() const
+{
+    return m_version->version;
+}
+
+template <class T>
+size_t cdata_snapshot<T>::height() const
+{
+    return m_version->offsets.back();
+}
+
+template <class T>
+size_t cdata_snapshot<T>::width() const
+{
+    return m_version->width;
+}
+
+template <class T>
+bool cdata_snapshot<T>::is_empty() const
+{
+    return height() == 0;
+}
+
+template <class T>
+std::vector<std::string> cdata_snapshot<T>::keys() const
+{
+    return m_version->keys;
+}
+
+template <class T>
+const std::string &cdata_snapshot<T>::index(const size_t &pos) const
+{
+    const size_t chunk = __find(pos);
+    return (*m_version->index[chunk])[pos - m_version->offsets[chunk]];
+}
+
+template <class T>
+const T &cdata_snapshot<T>::get(const size_t &row, const size_t &col) const
+{
+    if (col >= width())
+        throw std::out_of_range("The column " + std::to_string(col) + " is out of range.");
+
+    const size_t chunk = __find(row);
+    return (*m_version->columns[col][chunk])[row - m_version->offsets[chunk]];
+}
+
+template <class T>
+std::vector<T> cdata_snapshot<T>::rows_vec(const size_t &pos) const
+{
+    const size_t chunk = __find(pos);
+    std::vector<T> res(width());
+
+    for (size_t c = 0; c < width(); c++)
+        res[c] = (*m_version->columns[c][chunk])[pos - m_version->offsets[chunk]];
+
+    return res;
+}
+
+template <class T>
+std::vector<T> cdata_snapshot<T>::columns_vec(const std::string &key) const
+{
+    const std::vector<std::string> &keys = m_version->keys;
+    const size_t col = std::find(keys.begin(), keys.end(), key) - keys.begin();
+
+    if (col == keys.size())
+        throw std::invalid_argument("The key '" + key + "' doesn't exist.");
+
+    std::vector<T> res;
+    res.reserve(height());
+
+    for (const std::shared_ptr<const std::vector<T>> &chunk : m_version->columns[col])
+        res.insert(res.end(), chunk->begin(), chunk->end());
+
+    return res;
+}
+
+template <class T>
+size_t cdata_snapshot<T>::n_shared(const cdata_snapshot<T> &other) const
+{
+    std::unordered_set<const std::vector<T> *> chunks;
+
+    for (const std::vector<std::shared_ptr<const std::vector<T>>> &column : other.m_version->columns)
+        for (const std::shared_ptr<const std::vector<T>> &chunk : column)
+            chunks.insert(chunk.get());
+
+    size_t res = 0;
+
+    for (const std::vector<std::shared_ptr<const std::vector<T>>> &column : m_version->columns)
+        for (const std::shared_ptr<const std::vector<T>> &chunk : column)
+            res += chunks.count(chunk.get());
+
+    return res;
+}
+
+template <class T>
+cdata_frame<T> cdata_snapshot<T>::to_frame() const
+{
+    if (is_empty())
+        return cdata_frame<T>();
+
+    CDATA_TRACE_SCOPE("to_frame");
+    CDATA_TRACE_COUNT(height(), height() * width() * sizeof(T), 1);
+
+    std::vector<std::vector<T>> data(height(), std::vector<T>(width()));
+    std::vector<std::string> index;
+    bool has_index = false;
+
+    for (size_t k = 0; k + 1 < m_version->offsets.size(); k++)
+    {
+        const size_t offset = m_version->offsets[k];
+
+        for (size_t c = 0; c < width(); c++)
+        {
+            const std::vector<T> &chunk = *m_version->columns[c][k];
+
+            for (size_t i = 0; i < chunk.size(); i++)
+                data[offset + i][c] = chunk[i];
+        }
+
+        const std::vector<std::string> &labels = *m_version->index[k];
+        index.insert(index.end(), labels.begin(), labels.end());
+
+        for (const std::string &label : labels)
+            has_index = has_index || not label.empty();
+    }
+
+    if (m_version->keys.empty())
+        return has_index ? cdata_frame<T>(cmatrix<T>(data), index) : cdata_frame<T>(cmatrix<T>(data));
+
+    return has_index ? cdata_frame<T>(m_version->keys, cmatrix<T>(data), index) : cdata_frame<T>(m_version->keys, cmatrix<T>(data));
+}
+
+template <class T>
+size_t cdata_snapshot<T>::__find(const size_t &pos) const
+{
+    if (pos >= height())
+        throw std::out_of_range("The row " + std::to_string(pos) + " is out of range.");
+
+    const std::vector<size_t> &offsets = m_version->offsets;
+    return std::upper_bound(offsets.begin(), offsets.end(), pos) - offsets.begin() - 1;
+}
+
+// ==================================================
+// CONSTRUCTOR
+
+template <class T>
+cdata_versioned<T>::cdata_versioned(const cdata_frame<T> &df, const size_t &chunk_rows) : m_chunk_rows(chunk_rows)
+{
+    if (chunk_rows == 0)
+        throw std::invalid_argument("The chunks must have at least one row.");
+
+    __load(df, 0);
+}
+
+// ==================================================
+// GETTER
+
+template <class T>
+cdata_snapshot<T> cdata_versioned<T>::snapshot() const
+{
+    return cdata_snapshot<T>(std::atomic_load(&m_current));
+}
+
+template <class T>
+size_t cdata_versioned<T>::version() const
+{
+    return std::atomic_load(&m_current)->version;
+}
+
+// ==================================================
+// SETTER
+
+template <class T>
+void cdata_versioned<T>::set(const size_t &row, const size_t &col, const T &val)
+{
+    std::lock_guard<std::mutex> lock(m_write);
+    std::shared_ptr<cdata_version<T>> next = __next();
+
+    if (row >= next->offsets.back() || col >= next->width)
+        throw std::out_of_range("The cell (" + std::to_string(row) + ", " + std::to_string(col) + ") is out of range.");
+
+    const size_t chunk = __find(*next, row);
+    std::shared_ptr<std::vector<T>> copy = std::make_shared<std::vector<T>>(*next->columns[col][chunk]);
+    (*copy)[row - next->offsets[chunk]] = val;
+    next->columns[col][chunk] = copy;
+
+    __commit(next);
+}
+
+template <class T>
+void cdata_versioned<T>::set_row(const size_t &pos, const std::vector<T> &val)
+{
+    std::lock_guard<std::mutex> lock(m_write);
+    std::shared_ptr<cdata_version<T>> next = __next();
+
+    if (pos >= next->offsets.back())
+        throw std::out_of_range("The row " + std::to_string(pos) + " is out of range.");
+
+    if (val.size() != next->width)
+        throw std::invalid_argument("The size of the row must be equal to the number of columns. Actual: " +
+                                    std::to_string(val.size()) +
+                                    ", Expected: " +
+                                    std::to_string(next->width) +
+                                    ".");
+
+    const size_t chunk = __find(*next, pos);
+
+    for (size_t c = 0; c < next->width; c++)
+    {
+        std::shared_ptr<std::vector<T>> copy = std::make_shared<std::vector<T>>(*next->columns[c][chunk]);
+        (*copy)[pos - next->offsets[chunk]] = val[c];
+        next->columns[c][chunk] = copy;
+    }
+
+    __commit(next);
+}
+
+template <class T>
+void cdata_versioned<T>::set_data(const cdata_frame<T> &df)
+{
+    std::lock_guard<std::mutex> lock(m_write);
+    __load(df, std::atomic_load(&m_current)->version + 1);
+}
+
+// ==================================================
+// MANIPULATION
+
+template <class T>
+void cdata_versioned<T>::insert_row(const size_t &pos, const std::vector<T> &val, const std::string &index)
+{
+    std::lock_guard<std::mutex> lock(m_write);
+    __insert_row(pos, val, index);
+}
+
+template <class T>
+void cdata_versioned<T>::push_row_back(const std::vector<T> &val, const std::string &index)
+{
+    std::lock_guard<std::mutex> lock(m_write);
+    __insert_row(m_current->offsets.back(), val, index);
+}
+
+template <class T>
+void cdata_versioned<T>::remove_row(const size_t &pos)
+{
+    std::lock_guard<std::mutex> lock(m_write);
+    std::shared_ptr<cdata_version<T>> next = __next();
+
+    if (pos >= next->offsets.back())
+        throw std::out_of_range("The row " + std::to_string(pos) + " is out of range.");
+
+    const size_t chunk = __find(*next, pos);
+    const size_t offset = pos - next->offsets[chunk];
+    const std::string index = (*next->index[chunk])[offset];
+
+    for (size_t k = chunk + 1; k < next->offsets.size(); k++)
+        next->offsets[k]--;
+
+    // An empty chunk is removed from all the columns
+    if (next->index[chunk]->size() == 1)
+    {
+        for (std::vector<std::shared_ptr<const std::vector<T>>> &column : next->columns)
+            column.erase(column.begin() + chunk);
+
+        next->index.erase(next->index.begin() + chunk);
+        next->offsets.erase(next->offsets.begin() + chunk);
+    }
+    else
+    {
+        for (size_t c = 0; c < next->width; c++)
+        {
+            std::shared_ptr<std::vector<T>> copy = std::make_shared<std::vector<T>>(*next->columns[c][chunk]);
+            copy->erase(copy->begin() + offset);
+            next->columns[c][chunk] = copy;
+        }
+
+        std::shared_ptr<std::vector<std::string>> labels = std::make_shared<std::vector<std::string>>(*next->index[chunk]);
+        labels->erase(labels->begin() + offset);
+        next->index[chunk] = labels;
+    }
+
+    __commit(next);
+    m_labels.erase(index);
+}
+
+// ==================================================
+// PRIVATE
+
+template <class T>
+void cdata_versioned<T>::__load(const cdata_frame<T> &df, const size_t &version)
+{
+    std::shared_ptr<cdata_version<T>> next = std::make_shared<cdata_version<T>>();
+    next->version = version;
+    next->width = df.width();
+    next->keys = df.keys();
+    next->columns.assign(df.width(), std::vector<std::shared_ptr<const std::vector<T>>>());
+
+    const bool has_index = df.has_index();
+    const std::vector<std::string> index = has_index ? df.index() : std::vector<std::string>();
+    m_labels.clear();
+
+    for (size_t start = 0; start < df.height(); start += m_chunk_rows)
+    {
+        const size_t end = std::min(start + m_chunk_rows, df.height());
+
+        for (size_t c = 0; c < df.width(); c++)
+        {
+            std::shared_ptr<std::vector<T>> chunk = std::make_shared<std::vector<T>>(end - start);
+
+            for (size_t r = start; r < end; r++)
+                (*chunk)[r - start] = df.cell(r, c);
+
+            next->columns[c].push_back(chunk);
+        }
+
+        std::shared_ptr<std::vector<std::string>> labels = std::make_shared<std::vector<std::string>>(end - start);
+
+        if (has_index)
+            for (size_t r = start; r < end; r++)
+            {
+                (*labels)[r - start] = index[r];
+                m_labels.insert((*labels)[r - start]);
+            }
+
+        next->index.push_back(labels);
+        next->offsets.push_back(end);
+    }
+
+    __commit(next);
+}
+
+template <class T>
+void cdata_versioned<T>::__insert_row(const size_t &pos, const std::vector<T> &val, const std::string &index)
+{
+    std::shared_ptr<cdata_version<T>> next = __next();
+    const size_t height = next->offsets.back();
+
+    if (pos > height)
+        throw std::out_of_range("The row " + std::to_string(pos) + " is out of range.");
+
+    // The first row of an empty data frame without keys gives the width
+    if (height == 0 && next->keys.empty())
+    {
+        next->width = val.size();
+        next->columns.assign(val.size(), std::vector<std::shared_ptr<const std::vector<T>>>());
+    }
+
+    if (val.size() != next->width)
+        throw std::invalid_argument("The size of the row must be equal to the number of columns. Actual: " +
+                                    std::to_string(val.size()) +
+                                    ", Expected: " +
+                                    std::to_string(next->width) +
+                                    ".");
+
+    // The labels of a data frame with an index are unique, even the empty one
+    const bool has_index = not m_labels.empty();
+
+    if (has_index && m_labels.count(index) != 0)
+        throw std::runtime_error("The index '" + index + "' already exists.");
+
+    // The first label gives a unique label to the rows already inserted, as 'cdata_frame'
+    if (not has_index && not index.empty())
+        for (size_t k = 0; k < next->index.size(); k++)
+        {
+            std::shared_ptr<std::vector<std::string>> labels = std::make_shared<std::vector<std::string>>(*next->index[k]);
+
+            for (size_t i = 0; i < labels->size(); i++)
+            {
+                (*labels)[i] = std::to_string(next->offsets[k] + i);
+
+                if ((*labels)[i] == index)
+                    (*labels)[i] = index + (*labels)[i];
+
+                m_labels.insert((*labels)[i]);
+            }
+
+            next->index[k] = labels;
+        }
+
+    // A row after the last one goes to the last chunk
+    if (next->index.empty())
+    {
+        for (std::vector<std::shared_ptr<const std::vector<T>>> &column : next->columns)
+            column.push_back(std::make_shared<std::vector<T>>());
+
+        next->index.push_back(std::make_shared<std::vector<std::string>>());
+        next->offsets.push_back(0);
+    }
+
+    const size_t chunk = pos == height ? next->index.size() - 1 : __find(*next, pos);
+    const size_t offset = pos - next->offsets[chunk];
+
+    for (size_t c = 0; c < next->width; c++)
+    {
+        std::shared_ptr<std::vector<T>> copy = std::make_shared<std::vector<T>>(*next->columns[c][chunk]);
+        copy->insert(copy->begin() + offset, val[c]);
+        next->columns[c][chunk] = copy;
+    }
+
+    std::shared_ptr<std::vector<std::string>> labels = std::make_shared<std::vector<std::string>>(*next->index[chunk]);
+    labels->insert(labels->begin() + offset, index);
+    next->index[chunk] = labels;
+
+    for (size_t k = chunk + 1; k < next->offsets.size(); k++)
+        next->offsets[k]++;
+
+    __split(*next, chunk);
+    __commit(next);
+
+    if (has_index || not index.empty())
+        m_labels.insert(index);
+}
+
+template <class T>
+std::shared_ptr<cdata_version<T>> cdata_versioned<T>::__next() const
+{
+    std::shared_ptr<cdata_version<T>> next = std::make_shared<cdata_version<T>>(*m_current);
+    next->version++;
+
+    return next;
+}
+
+template <class T>
+void cdata_versioned<T>::__commit(const std::shared_ptr<cdata_version<T>> &next)
+{
+    std::atomic_store(&m_current, std::shared_ptr<const cdata_version<T>>(next));
+}
+
+template <class T>
+size_t cdata_versioned<T>::__find(const cdata_version<T> &version, const size_t &pos)
+{
+    return std::upper_bound(version.offsets.begin(), version.offsets.end(), pos) - version.offsets.begin() - 1;
+}
+
+template <class T>
+void cdata_versioned<T>::__split(cdata_version<T> &version, const size_t &pos) const
+{
+    const size_t size = version.index[pos]->size();
+
+    if (size <= m_chunk_rows)
+        return;
+
+    // The first rows keep the size of a chunk, so the appends copy a small last chunk
+    for (std::vector<std::shared_ptr<const std::vector<T>>> &column : version.columns)
+    {
+        const std::vector<T> &chunk = *column[pos];
+        std::shared_ptr<const std::vector<T>> head = std::make_shared<std::vector<T>>(chunk.begin(), chunk.begin() + m_chunk_rows);
+        std::shared_ptr<const std::vector<T>> tail = std::make_shared<std::vector<T>>(chunk.begin() + m_chunk_rows, chunk.end());
+
+        column[pos] = head;
+        column.insert(column.begin() + pos + 1, tail);
+    }
+
+    const std::vector<std::string> &labels = *version.index[pos];
+    std::shared_ptr<const std::vector<std::string>> head = std::make_shared<std::vector<std::string>>(labels.begin(), labels.begin() + m_chunk_rows);
+    std::shared_ptr<const std::vector<std::string>> tail = std::make_shared<std::vector<std::string>>(labels.begin() + m_chunk_rows, labels.end());
+
+    version.index[pos] = head;
+    version.index.insert(version.index.begin() + pos + 1, tail);
+    version.offsets.insert(version.offsets.begin() + pos + 1, version.offsets[pos] + m_chunk_rows);
+}
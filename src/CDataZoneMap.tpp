@@ -0,0 +1,239 @@
+/**
+ * @file CDataZoneMap.tpp
+ * @brief File containing the implementation of the 'cdata_zone_map' class.
+ *
+ * @see CDataZoneMap.hpp
+ * @defgroup zone_map
+ */
+
+// ==================================================
+// CONSTRUCTOR
+
+template <class T>
+cdata_zone_map<T>::cdata_zone_map(const size_t &block_rows) : m_block_rows(block_rows)
+{
+    if (block_rows == 0)
+        throw std::invalid_argument("The blocks must have at least one row.");
+}
+
+// ==================================================
+// MANIPULATION
+
+template <class T>
+template <class Function, class Valid>
+void cdata_zone_map<T>::build(const size_t &height, Function cell, Valid valid)
+{
+    const size_t n_blocks = (height + m_block_rows - 1) / m_block_rows;
+
+    m_offsets.assign(1, 0);
+    for (size_t b = 0; b < n_blocks; b++)
+        m_offsets.push_back(std::min(height, (b + 1) * m_block_rows));
+
+    m_min.assign(n_blocks, T());
+    m_max.assign(n_blocks, T());
+    m_null.assign(n_blocks, 0);
+    m_writes.assign(n_blocks, 0);
+
+    for (size_t b = 0; b < n_blocks; b++)
+        __compute(b, cell, valid);
+}
+
+template <class T>
+template <class Function, class Valid>
+void cdata_zone_map<T>::insert(const size_t &pos, Function cell, Valid valid)
+{
+    // The first block of an empty column
+    if (m_min.empty())
+    {
+        m_offsets.push_back(0);
+        m_min.push_back(T());
+        m_max.push_back(T());
+        m_null.push_back(0);
+        m_writes.push_back(0);
+    }
+
+    // A row inserted after the last row belongs to the last block
+    const size_t b = pos < m_offsets.back() ? __find(pos) : m_min.size() - 1;
+    const bool had_values = has_values(b);
+
+    for (size_t k = b + 1; k < m_offsets.size(); k++)
+        m_offsets[k]++;
+
+    if (not valid(pos))
+        m_null[b]++;
+
+    else if (not had_values)
+        m_min[b] = m_max[b] = cell(pos);
+
+    else
+    {
+        const T &val = cell(pos);
+
+        if (val < m_min[b])
+            m_min[b] = val;
+
+        if (m_max[b] < val)
+            m_max[b] = val;
+    }
+
+    // Split a block grown to twice the number of rows, its halves are computed again
+    if (end(b) - start(b) >= 2 * m_block_rows)
+    {
+        m_offsets.insert(m_offsets.begin() + b + 1, start(b) + m_block_rows);
+        m_min.insert(m_min.begin() + b + 1, T());
+        m_max.insert(m_max.begin() + b + 1, T());
+        m_null.insert(m_null.begin() + b + 1, 0);
+        m_writes.insert(m_writes.begin() + b + 1, 0);
+
+        __compute(b, cell, valid);
+        __compute(b + 1, cell, valid);
+    }
+}
+
+template <class T>
+void cdata_zone_map<T>::erase(const size_t &pos, const bool &valid)
+{
+    const size_t b = __find(pos);
+
+    for (size_t k = b + 1; k < m_offsets.size(); k++)
+        m_offsets[k]--;
+
+    if (not valid)
+        m_null[b]--;
+
+    // An empty block is removed
+    if (start(b) == end(b))
+    {
+        m_offsets.erase(m_offsets.begin() + b + 1);
+        m_min.erase(m_min.begin() + b);
+        m_max.erase(m_max.begin() + b);
+        m_null.erase(m_null.begin() + b);
+        m_writes.erase(m_writes.begin() + b);
+    }
+}
+
+template <class T>
+void cdata_zone_map<T>::set_na(const size_t &pos)
+{
+    m_null[__find(pos)]++;
+}
+
+template <class T>
+void cdata_zone_map<T>::modify(const size_t &pos)
+{
+    m_writes[__find(pos)]++;
+}
+
+// ==================================================
+// GETTER
+
+template <class T>
+size_t cdata_zone_map<T>::block_rows() const
+{
+    return m_block_rows;
+}
+
+template <class T>
+size_t cdata_zone_map<T>::n_blocks() const
+{
+    return m_min.size();
+}
+
+template <class T>
+size_t cdata_zone_map<T>::start(const size_t &pos) const
+{
+    return m_offsets[pos];
+}
+
+template <class T>
+size_t cdata_zone_map<T>::end(const size_t &pos) const
+{
+    return m_offsets[pos + 1];
+}
+
+template <class T>
+const T &cdata_zone_map<T>::min(const size_t &pos) const
+{
+    return m_min[pos];
+}
+
+template <class T>
+const T &cdata_zone_map<T>::max(const size_t &pos) const
+{
+    return m_max[pos];
+}
+
+template <class T>
+size_t cdata_zone_map<T>::null_count(const size_t &pos) const
+{
+    return m_null[pos];
+}
+
+template <class T>
+size_t cdata_zone_map<T>::modifications(const size_t &pos) const
+{
+    return m_writes[pos];
+}
+
+// ==================================================
+// CHECK
+
+template <class T>
+bool cdata_zone_map<T>::has_values(const size_t &pos) const
+{
+    return end(pos) - start(pos) > m_null[pos];
+}
+
+template <class T>
+bool cdata_zone_map<T>::may_contain(const size_t &pos, const T &lo, const T &hi) const
+{
+    // The bounds of a block modified since they were computed are not used
+    return has_values(pos) && (m_writes[pos] != 0 || (not(m_max[pos] < lo) && not(hi < m_min[pos])));
+}
+
+template <class T>
+bool cdata_zone_map<T>::contains_all(const size_t &pos, const T &lo, const T &hi) const
+{
+    return m_null[pos] == 0 && m_writes[pos] == 0 && end(pos) > start(pos) && not(m_min[pos] < lo) && not(hi < m_max[pos]);
+}
+
+// ==================================================
+// PRIVATE
+
+template <class T>
+size_t cdata_zone_map<T>::__find(const size_t &pos) const
+{
+    return std::upper_bound(m_offsets.begin(), m_offsets.end(), pos) - m_offsets.begin() - 1;
+}
+
+template <class T>
+template <class Function, class Valid>
+void cdata_zone_map<T>::__compute(const size_t &pos, Function cell, Valid valid)
+{
+    bool first = true;
+    m_null[pos] = 0;
+    m_writes[pos] = 0;
+
+    for (size_t r = start(pos); r < end(pos); r++)
+    {
+        if (not valid(r))
+        {
+            m_null[pos]++;
+            continue;
+        }
+
+        const T &val = cell(r);
+
+        if (first)
+        {
+            m_min[pos] = m_max[pos] = val;
+            first = false;
+        }
+
+        else if (val < m_min[pos])
+            m_min[pos] = val;
+
+        else if (m_max[pos] < val)
+            m_max[pos] = val;
+    }
+}
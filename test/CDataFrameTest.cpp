@@ -7,6 +7,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <deque>
+#include <numeric>
+#include <thread>
 #include "CDataFrame.hpp"
 
 // ==================================================
@@ -252,6 +255,51 @@ TEST(TestGetter, slice_columns)
     EXPECT_EQ(df6.slice_columns("a", "b"), (cdata_frame<int>({"a", "b"}, {{1, 2}, {4, 5}, {7, 8}}, {"a", "b", "c"})));
 }
 
+/** @brief Test the 'col' method of the 'DataFrame' class. */
+TEST(TestGetter, col)
+{
+    // DF EMPTY
+    cdata_frame<int> df;
+    EXPECT_THROW(df.col("a"), std::invalid_argument);
+    EXPECT_THROW(df.col(0), std::out_of_range);
+
+    // DF WITH KEYS AND DATA
+    cdata_frame<int> df2({"a", "b", "c"}, {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+    EXPECT_EQ(df2.col("b").size(), 3);
+    EXPECT_EQ(df2.col("b").pos(), 1);
+    EXPECT_EQ(df2.col("b")[2], 8);
+    EXPECT_EQ(df2.col(2).to_vector(), (std::vector<int>{3, 6, 9}));
+    EXPECT_THROW(df2.col("d"), std::invalid_argument);
+
+    // COMPARE WITH A VALUE
+    EXPECT_EQ(df2.col("a") == 4, cdata_mask({false, true, false}));
+    EXPECT_EQ(df2.col("a") != 4, cdata_mask({true, false, true}));
+    EXPECT_EQ(df2.col("a") < 4, cdata_mask({true, false, false}));
+    EXPECT_EQ(df2.col("a") <= 4, cdata_mask({true, true, false}));
+    EXPECT_EQ(df2.col("a") > 4, cdata_mask({false, false, true}));
+    EXPECT_EQ(df2.col("a") >= 4, cdata_mask({false, true, true}));
+
+    // COMPARE WITH A COLUMN
+    cdata_frame<int> df3({"a", "b"}, {{1, 2}, {4, 4}, {9, 8}});
+    EXPECT_EQ(df3.col("a") == df3.col("b"), cdata_mask({false, true, false}));
+    EXPECT_EQ(df3.col("a") < df3.col("b"), cdata_mask({true, false, false}));
+    EXPECT_EQ(df3.col("a") >= df3.col("b"), cdata_mask({false, true, true}));
+    cdata_frame<int> df5({"a"}, {{1}, {2}});
+    EXPECT_THROW(df3.col("a") == df5.col("a"), std::invalid_argument);
+
+    // MORE THAN ONE WORD
+    cdata_frame<int> df4;
+    for (int i = 0; i < 150; i++)
+        df4.push_row_back({i});
+
+    cdata_mask mask = df4.col(0) >= 100;
+    EXPECT_EQ(mask.size(), 150);
+    EXPECT_EQ(mask.count(), 50);
+    EXPECT_FALSE(mask[99]);
+    EXPECT_TRUE(mask[100]);
+    EXPECT_TRUE(mask[149]);
+}
+
 // ==================================================
 // SETTER
 
@@ -594,6 +642,52 @@ TEST(TestManipulation, remove_column)
     EXPECT_TRUE(df6.data().is_empty());
 }
 
+/** @brief Test the 'remove_rows' and 'remove_columns' methods of the 'DataFrame' class. */
+TEST(TestManipulation, remove_rows_columns)
+{
+    // DF EMPTY
+    cdata_frame<int> df;
+    EXPECT_THROW(df.remove_rows(std::vector<size_t>{0}), std::out_of_range);
+    EXPECT_THROW(df.remove_columns(std::vector<size_t>{0}), std::out_of_range);
+
+    // REMOVE ROWS
+    cmatrix<int> data({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}, {10, 11, 12}});
+    cdata_frame<int> df2({"A", "B", "C"}, data, {"a", "b", "c", "d"});
+    df2.set_na(2, "B");
+    df2.remove_rows(std::vector<size_t>{3, 0, 3});
+    EXPECT_EQ(df2.data(), (cmatrix<int>{{4, 5, 6}, {7, 8, 9}}));
+    EXPECT_EQ(df2.index(), (std::vector<std::string>{"b", "c"}));
+    EXPECT_EQ(df2.isna("B"), cdata_mask({false, true}));
+    df2.remove_rows(std::vector<std::string>{"c"});
+    EXPECT_EQ(df2.data(), (cmatrix<int>{{4, 5, 6}}));
+    EXPECT_FALSE(df2.has_na());
+    EXPECT_THROW(df2.remove_rows(std::vector<std::string>{"z"}), std::invalid_argument);
+    EXPECT_THROW(df2.remove_rows(std::vector<size_t>{1}), std::out_of_range);
+    df2.remove_rows(std::vector<size_t>{0});
+    EXPECT_TRUE(df2.data().is_empty());
+
+    // REMOVE COLUMNS
+    cdata_frame<int> df3({"A", "B", "C"}, data, {"a", "b", "c", "d"});
+    df3.set_na(1, "C");
+    df3.remove_columns(std::vector<size_t>{1});
+    EXPECT_EQ(df3.data(), (cmatrix<int>{{1, 3}, {4, 6}, {7, 9}, {10, 12}}));
+    EXPECT_EQ(df3.keys(), (std::vector<std::string>{"A", "C"}));
+    EXPECT_EQ(df3.isna("C"), cdata_mask({false, true, false, false}));
+    df3.remove_columns(std::vector<std::string>{"A"});
+    EXPECT_EQ(df3.data(), (cmatrix<int>{{3}, {6}, {9}, {12}}));
+    EXPECT_EQ(df3.index(), (std::vector<std::string>{"a", "b", "c", "d"}));
+    EXPECT_THROW(df3.remove_columns(std::vector<std::string>{"A"}), std::invalid_argument);
+    df3.remove_columns(std::vector<std::string>{"C"});
+    EXPECT_TRUE(df3.data().is_empty());
+    EXPECT_TRUE(df3.keys().empty());
+
+    // NOTHING TO REMOVE
+    cdata_frame<int> df4(data);
+    df4.remove_rows(std::vector<size_t>());
+    df4.remove_columns(std::vector<size_t>());
+    EXPECT_EQ(df4.data(), data);
+}
+
 /** @brief Test the 'concatenate' method of the 'DataFrame' class. */
 TEST(TestManipulation, concatenate)
 {
@@ -694,6 +788,601 @@ TEST(TestManipulation, concatenate)
     EXPECT_THROW(df25.concatenate(df25, 0), std::invalid_argument);
 }
 
+/** @brief Test the insertion of columns computed from expressions. */
+TEST(TestManipulation, push_col_expression)
+{
+    // DF WITH KEYS AND DATA
+    cdata_frame<double> df({"a", "b", "c"}, {{1, 2, 3}, {4, 5, 6}});
+    df.push_col_back(df.col("a") * df.col("b") + df.col("c"), "d");
+    EXPECT_EQ(df.keys(), (std::vector<std::string>{"a", "b", "c", "d"}));
+    EXPECT_EQ(df.col("d").to_vector(), (std::vector<double>{5, 26}));
+
+    // SCALARS AND UNARY OPERATORS
+    df.push_col_front(2. * -df.col("a") / 4. - 1., "e");
+    EXPECT_EQ(df.col(0).to_vector(), (std::vector<double>{-1.5, -3}));
+    df.insert_column(1, 10. - df.col("b"), "f");
+    EXPECT_EQ(df.col("f").to_vector(), (std::vector<double>{8, 5}));
+
+    // CONSTANT BROADCAST
+    df.push_col_back(cdata_scalar<double>(7.) + 1., "g");
+    EXPECT_EQ(df.col("g").to_vector(), (std::vector<double>{8, 8}));
+
+    // COMPARISON OF EXPRESSIONS
+    EXPECT_EQ(df.col("a") * 2. > df.col("b"), cdata_mask({false, true}));
+    EXPECT_EQ(df.col("a") + df.col("b") == 9., cdata_mask({false, true}));
+
+    // MISSING CELLS (NA)
+    cdata_frame<int> df4({"a", "b"}, {{1, 10}, {12, 10}, {8, 20}});
+    df4.set_na(1, "a");
+    df4.push_col_back(df4.col("a") + df4.col("b"), "c");
+    EXPECT_EQ(df4.isna("c"), cdata_mask({false, true, false}));
+    EXPECT_EQ(df4.col("c").sum(), 39);
+    df4.push_col_back(-df4.col("b") * 2, "d");
+    EXPECT_EQ(df4.isna("d"), cdata_mask(3, false));
+    EXPECT_EQ(df4.col("c") > 5, cdata_mask({true, false, true}));
+    EXPECT_EQ(df4.col("b") < df4.col("c"), cdata_mask({true, false, true}));
+
+    // DIFFERENT SIZES
+    cdata_frame<double> df2({"a"}, {{1}, {2}, {3}});
+    EXPECT_THROW(df.col("a") + df2.col("a"), std::invalid_argument);
+    EXPECT_THROW(df.push_col_back(df2.col("a") * 2., "h"), std::invalid_argument);
+
+    // EXISTING KEY
+    EXPECT_THROW(df.push_col_back(df.col("a") * 2., "a"), std::runtime_error);
+
+    // LARGE COLUMN (CHUNKED BETWEEN THREADS)
+    cdata_frame<long> df3;
+    for (long i = 0; i < 20000; i++)
+        df3.push_row_back({i, 2 * i});
+
+    df3.push_col_back(df3.col(0) * df3.col(1) - df3.col(0));
+    const std::vector<long> res = df3.col(2).to_vector();
+    for (long i = 0; i < 20000; i++)
+        EXPECT_EQ(res[i], 2 * i * i - i);
+}
+
+/** @brief Test the missing values of the 'DataFrame' class. */
+TEST(TestManipulation, missing_values)
+{
+    // DF WITHOUT NA
+    cdata_frame<int> df({"a", "b"}, {{1, 2}, {3, 4}, {5, 6}}, {"x", "y", "z"});
+    EXPECT_FALSE(df.has_na());
+    EXPECT_EQ(df.isna("a"), cdata_mask(3));
+    EXPECT_EQ(df.dropna(), df);
+    EXPECT_EQ(df.fillna(0), df);
+
+    // SET NA
+    df.set_na(1, "a");
+    df.set_na(2, 1);
+    EXPECT_TRUE(df.has_na());
+    EXPECT_TRUE(df.is_na(1, 0));
+    EXPECT_FALSE(df.is_na(0, 0));
+    EXPECT_EQ(df.isna("a"), cdata_mask({false, true, false}));
+    EXPECT_EQ(df.notna("b"), cdata_mask({true, true, false}));
+    EXPECT_THROW(df.set_na(3, 0), std::out_of_range);
+    EXPECT_THROW(df.set_na(0, "c"), std::invalid_argument);
+    EXPECT_NE(df, cdata_frame<int>({"a", "b"}, {{1, 2}, {3, 4}, {5, 6}}, {"x", "y", "z"}));
+
+    // DROPNA AND FILLNA
+    EXPECT_EQ(df.dropna(), (cdata_frame<int>({"a", "b"}, {{1, 2}}, {"x"})));
+    EXPECT_EQ(df.fillna(0), (cdata_frame<int>({"a", "b"}, {{1, 2}, {0, 4}, {5, 0}}, {"x", "y", "z"})));
+
+    // REDUCTIONS SKIP NA
+    EXPECT_EQ(df.col("a").count(), 2);
+    EXPECT_EQ(df.col("a").sum(), 6);
+    EXPECT_DOUBLE_EQ(df.col("a").mean(), 3);
+    EXPECT_EQ(df.col("a").min(), 1);
+    EXPECT_EQ(df.col("b").max(), 4);
+
+    // NA FOLLOW THE ROWS AND COLUMNS
+    df.push_row_front({7, 8}, "w");
+    EXPECT_EQ(df.isna("a"), cdata_mask({false, false, true, false}));
+    df.remove_row("x");
+    EXPECT_EQ(df.isna("a"), cdata_mask({false, true, false}));
+    df.push_col_front({0, 0, 0}, "c");
+    EXPECT_EQ(df.isna("c"), cdata_mask(3));
+    EXPECT_EQ(df.isna("b"), cdata_mask({false, false, true}));
+    EXPECT_EQ(df.slice_rows(1, 2).isna("a"), cdata_mask({true, false}));
+    EXPECT_EQ(df.slice_columns("a", "b").isna("b"), cdata_mask({false, false, true}));
+    EXPECT_EQ(df.filter(df.col("c") == 0).isna("b"), cdata_mask({false, false, true}));
+    EXPECT_EQ(df.filter(cdata_mask({false, true, true})).isna("a"), cdata_mask({true, false}));
+    EXPECT_TRUE(df.copy().has_na());
+    df.remove_column("a");
+    df.remove_column("b");
+    EXPECT_FALSE(df.has_na());
+
+    // CONCATENATE
+    cdata_frame<int> df2({"a"}, {{1}, {2}});
+    cdata_frame<int> df3({"a"}, {{3}, {4}});
+    df3.set_na(0, 0);
+    df2.concatenate(df3);
+    EXPECT_EQ(df2.isna("a"), cdata_mask({false, false, true, false}));
+    cdata_frame<int> df4({"b"}, {{0}, {0}, {0}, {0}});
+    df4.concatenate(df2, 1);
+    EXPECT_EQ(df4.isna("b"), cdata_mask(4));
+    EXPECT_EQ(df4.isna("a"), cdata_mask({false, false, true, false}));
+
+    // NO VALID ELEMENT
+    cdata_frame<double> df5({"a"}, {{1}});
+    df5.set_na(0, 0);
+    EXPECT_THROW(df5.col("a").min(), std::runtime_error);
+    EXPECT_TRUE(std::isnan(df5.col("a").mean()));
+
+    // SET DATA CLEARS NA
+    df5.set_data({{2}});
+    EXPECT_FALSE(df5.has_na());
+
+    // MORE THAN ONE WORD
+    cdata_frame<long> df6;
+    for (long i = 0; i < 200; i++)
+        df6.push_row_back({i});
+
+    for (size_t i = 0; i < 200; i += 3)
+        df6.set_na(i, 0);
+
+    long expected = 0;
+    for (long i = 0; i < 200; i++)
+        expected += i % 3 == 0 ? 0 : i;
+
+    EXPECT_EQ(df6.col(0).sum(), expected);
+    EXPECT_EQ(df6.col(0).count(), 133);
+    EXPECT_EQ(df6.dropna().height(), 133);
+}
+
+/** @brief Test the 'filter' method of the 'DataFrame' class. */
+TEST(TestManipulation, filter)
+{
+    // DF EMPTY
+    cdata_frame<int> df;
+    EXPECT_TRUE(df.filter(cdata_mask()).data().is_empty());
+    EXPECT_THROW(df.filter(cdata_mask(1)), std::invalid_argument);
+
+    // DF WITH DATA
+    cmatrix<int> data({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+    cdata_frame<int> df2(data);
+    EXPECT_EQ(df2.filter(cdata_mask({true, false, true})), cdata_frame<int>({{1, 2, 3}, {7, 8, 9}}));
+    EXPECT_EQ(df2.filter(cdata_mask(3, true)), df2);
+    EXPECT_TRUE(df2.filter(cdata_mask(3)).data().is_empty());
+    EXPECT_THROW(df2.filter(cdata_mask(2)), std::invalid_argument);
+
+    // DF WITH KEYS, INDEX AND DATA
+    cdata_frame<int> df3({"a", "b", "c"}, data, {"x", "y", "z"});
+    EXPECT_EQ(df3.filter(df3.col("a") > 1), (cdata_frame<int>({"a", "b", "c"}, {{4, 5, 6}, {7, 8, 9}}, {"y", "z"})));
+    EXPECT_EQ(df3.filter((df3.col("a") < 2) | (df3.col("c") == 9)), (cdata_frame<int>({"a", "b", "c"}, {{1, 2, 3}, {7, 8, 9}}, {"x", "z"})));
+    EXPECT_EQ(df3.filter(~(df3.col("b") == 5) & (df3.col("b") > 2)), (cdata_frame<int>({"a", "b", "c"}, {{7, 8, 9}}, {"z"})));
+
+    // MORE THAN ONE WORD
+    cdata_frame<int> df4;
+    for (int i = 0; i < 200; i++)
+        df4.push_row_back({i, i * 2}, "r" + std::to_string(i));
+
+    cdata_frame<int> df5 = df4.filter(df4.col(0) >= 190);
+    EXPECT_EQ(df5.height(), 10);
+    EXPECT_EQ(df5.index().front(), "r190");
+    EXPECT_EQ(df5.rows("r195"), cmatrix<int>({{195, 390}}));
+
+    // MISSING CELLS (NA) NEVER MATCH
+    df4.set_na(195, 0);
+    df4.set_na(2, 1);
+    EXPECT_EQ(df4.filter(df4.col(0) >= 190).height(), 9);
+    EXPECT_EQ(df4.filter(df4.col(0) >= 190).index()[5], "r196");
+    EXPECT_EQ(df4.filter(df4.col(1) < 10).index(), (std::vector<std::string>{"r0", "r1", "r3", "r4"}));
+}
+
+/** @brief Test the 'select_between' method and the zone maps of the 'DataFrame' class. */
+TEST(TestManipulation, select_between)
+{
+    // DF SORTED BY TIME, WITHOUT ZONE MAPS
+    cmatrix<int> data(100, 2);
+    for (int i = 0; i < 100; i++)
+    {
+        data.cell(i, 0) = i;
+        data.cell(i, 1) = 100 - i;
+    }
+
+    cdata_frame<int> df({"time", "value"}, data);
+
+    cdata_frame<int> df2 = df.select_between("time", 10, 19);
+    EXPECT_FALSE(df.has_zone_maps());
+    EXPECT_EQ(df2.height(), 10);
+    EXPECT_EQ(df2.cell(0, 0), 10);
+    EXPECT_THROW(df.zone_map("time"), std::runtime_error);
+
+    // DF WITH ZONE MAPS, BLOCKS OF 16 ROWS
+    df.build_zone_maps(16);
+    const cdata_zone_map<int> &zone = df.zone_map("time");
+    EXPECT_TRUE(df.has_zone_maps());
+    EXPECT_EQ(zone.n_blocks(), 7);
+    EXPECT_EQ(zone.min(1), 16);
+    EXPECT_EQ(zone.max(1), 31);
+    EXPECT_TRUE(zone.contains_all(1, 10, 40));
+    EXPECT_FALSE(zone.may_contain(0, 16, 40));
+    EXPECT_EQ(df.select_between("time", 10, 19), df2);
+    EXPECT_EQ(df.select_between("value", 95, 200).height(), 6);
+    EXPECT_TRUE(df.select_between("time", 200, 300).is_empty());
+
+    // UPDATED BY INSERT_ROW, SPLIT AFTER TWICE THE ROWS OF A BLOCK
+    for (int i = 100; i < 130; i++)
+        df.push_row_back({i, 0});
+
+    EXPECT_EQ(zone.max(zone.n_blocks() - 1), 129);
+    EXPECT_EQ(zone.end(zone.n_blocks() - 1), 130);
+    EXPECT_EQ(df.select_between("time", 125, 1000).height(), 5);
+
+    df.insert_row(0, {-5, 0});
+    EXPECT_EQ(zone.min(0), -5);
+    EXPECT_EQ(zone.start(1), 17);
+    EXPECT_EQ(df.select_between("time", -10, 0).height(), 2);
+
+    // MISSING CELLS ARE NEVER SELECTED
+    df.set_na(0, 0);
+    EXPECT_EQ(zone.null_count(0), 1);
+    EXPECT_EQ(df.select_between("time", -10, 0).height(), 1);
+
+    // UPDATED BY REMOVE_ROW
+    df.remove_row(0);
+    df.remove_row(0);
+    EXPECT_EQ(zone.null_count(0), 0);
+    EXPECT_EQ(df.select_between("time", 0, 1000).height(), 129);
+    EXPECT_EQ(df.select_between("time", 40, 59), df.filter((df.col("time") >= 40) & (df.col("time") <= 59)));
+
+    // A WRITE THROUGH CELL: THE BLOCK IS READ AGAIN
+    df.cell(5, 0) = 1000;
+    EXPECT_EQ(zone.modifications(0), 1);
+    EXPECT_EQ(df.select_between("time", 999, 1001).height(), 1);
+    EXPECT_EQ(df.select_between("time", 0, 9).height(), 8);
+    df.cell(5, 0) = 6;
+    df.build_zone_maps(16);
+    EXPECT_EQ(df.zone_map("time").modifications(0), 0);
+
+    // COMPUTED AGAIN BY SET_DATA AND THE COLUMNS
+    df.set_data(cmatrix<int>({{3, 1}, {1, 2}, {2, 3}}));
+    EXPECT_EQ(df.zone_map("time").n_blocks(), 1);
+    EXPECT_EQ(df.zone_map("time").max(0), 3);
+    df.push_col_back({7, 8, 9}, "extra");
+    EXPECT_EQ(df.zone_map("extra").min(0), 7);
+    df.remove_column("time");
+    EXPECT_EQ(df.select_between("extra", 8, 8).cell(0, 0), 2);
+
+    // FILLED BY FILLNA: A BLOCK ALL MISSING IS READ AGAIN
+    cdata_frame<int> df4({"a"}, {{1}, {2}, {3}, {4}, {5}});
+    df4.build_zone_maps(2);
+    df4.set_na(2, 0);
+    df4.set_na(3, 0);
+    EXPECT_EQ(df4.select_between("a", 5, 10).height(), 1);
+    EXPECT_EQ(df4.fillna(7).select_between("a", 5, 10).height(), 3);
+    EXPECT_EQ(df4.fillna(7).zone_map("a").null_count(1), 0);
+
+    // COPY, DROP AND ERRORS
+    EXPECT_TRUE(df.copy().has_zone_maps());
+    df.drop_zone_maps();
+    EXPECT_FALSE(df.has_zone_maps());
+    EXPECT_EQ(df.select_between("extra", 8, 9).height(), 2);
+    EXPECT_THROW(df.select_between("no_key", 0, 1), std::invalid_argument);
+    EXPECT_THROW(df.build_zone_maps(0), std::invalid_argument);
+
+    // DF OF STRINGS
+    cdata_frame<std::string> df3({"name"}, cmatrix<std::string>({{"b"}, {"d"}, {"a"}, {"c"}}));
+    df3.build_zone_maps(2);
+    EXPECT_EQ(df3.zone_map("name").min(1), "a");
+    EXPECT_EQ(df3.select_between("name", "b", "c").height(), 2);
+}
+
+/** @brief Test the 'map', 'transform' and 'apply' methods of the 'DataFrame' class. */
+TEST(TestManipulation, apply)
+{
+    // DF EMPTY
+    cdata_frame<int> df;
+    EXPECT_TRUE(df.map([](const int &x)
+                       { return x + 1; })
+                    .data()
+                    .is_empty());
+    EXPECT_TRUE(df.apply([](const std::vector<int> &col)
+                         { return col.size(); })
+                    .empty());
+
+    // DF WITH DATA
+    cdata_frame<int> df2({"A", "B", "C"}, cmatrix<int>({{1, 2, 3}, {4, 5, 6}}), {"a", "b"});
+    df2.set_na(1, "B");
+
+    // MAP
+    cdata_frame<int> df3 = df2.map([](const int &x)
+                                   { return x * 10; },
+                                   2);
+    EXPECT_EQ(df3.rows_vec(0), (std::vector<int>{10, 20, 30}));
+    EXPECT_EQ(df3.keys(), df2.keys());
+    EXPECT_EQ(df3.index(), df2.index());
+    EXPECT_TRUE(df3.is_na(1, 1));
+
+    // TRANSFORM
+    auto reverse = [](std::vector<int> vec)
+    { std::reverse(vec.begin(), vec.end()); return vec; };
+    cdata_frame<int> df4 = df2.transform(reverse);
+    EXPECT_EQ(df4.rows_vec(0), (std::vector<int>{4, 5, 6}));
+    EXPECT_TRUE(df4.is_na(1, 1));
+    EXPECT_EQ(df2.transform(reverse, 1, 1).rows_vec(1), (std::vector<int>{6, 5, 4}));
+    EXPECT_THROW(df2.transform([](const std::vector<int> &vec)
+                               { return std::vector<int>(vec.size() + 1); }),
+                 std::invalid_argument);
+    EXPECT_THROW(df2.transform(reverse, 2), std::invalid_argument);
+
+    // APPLY
+    auto sum = [](const std::vector<int> &vec)
+    { return std::accumulate(vec.begin(), vec.end(), 0.); };
+    EXPECT_EQ(df2.apply(sum), (std::vector<double>{5, 7, 9}));
+    EXPECT_EQ(df2.apply(sum, 1, 3), (std::vector<double>{6, 15}));
+    EXPECT_EQ(df2.apply([](const std::vector<int> &vec)
+                        { return vec[0] > 2; }),
+              (std::vector<bool>{false, false, true}));
+    EXPECT_THROW(df2.apply(sum, 2), std::invalid_argument);
+
+    // EXCEPTIONS OF THE FUNCTION, RETHROWN AFTER THE THREADS
+    EXPECT_THROW(df2.map([](const int &x)
+                         { return x == 5 ? throw std::domain_error("map") : x; },
+                         4),
+                 std::domain_error);
+    EXPECT_THROW(df2.transform([](const std::vector<int> &vec)
+                               { return vec[0] == 3 ? throw std::domain_error("transform") : vec; },
+                               0, 4),
+                 std::domain_error);
+    EXPECT_THROW(df2.apply([](const std::vector<int> &vec)
+                           { return vec[0] == 4 ? throw std::domain_error("apply") : vec[0]; },
+                           1, 4),
+                 std::domain_error);
+}
+
+/** @brief Test the 'unique', 'value_counts' and 'drop_duplicates' methods of the 'DataFrame' class. */
+TEST(TestManipulation, duplicates)
+{
+    // DF EMPTY
+    cdata_frame<int> df;
+    EXPECT_TRUE(df.drop_duplicates().is_empty());
+
+    // DF WITH DATA
+    cdata_frame<std::string> df2({"user", "page"}, cmatrix<std::string>({{"u1", "home"}, {"u2", "cart"}, {"u1", "home"}, {"u3", "home"}, {"u2", "home"}, {"u1", "cart"}}), {"a", "b", "c", "d", "e", "f"});
+    EXPECT_EQ(df2.unique("user"), (std::vector<std::string>{"u1", "u2", "u3"}));
+    EXPECT_EQ(df2.unique("page"), (std::vector<std::string>{"home", "cart"}));
+    EXPECT_EQ(df2.value_counts("page"), (std::vector<std::pair<std::string, size_t>>{{"home", 4}, {"cart", 2}}));
+    EXPECT_EQ(df2.value_counts("user"), (std::vector<std::pair<std::string, size_t>>{{"u1", 3}, {"u2", 2}, {"u3", 1}}));
+
+    cdata_frame<std::string> df3 = df2.drop_duplicates();
+    EXPECT_EQ(df3.index(), (std::vector<std::string>{"a", "b", "d", "e", "f"}));
+    EXPECT_EQ(df2.drop_duplicates({"page"}).index(), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(df2.drop_duplicates({"user"}, 2).rows_vec(2), (std::vector<std::string>{"u3", "home"}));
+
+    // MISSING VALUES: EQUAL TO EACH OTHER, SKIPPED BY THE VALUES
+    cdata_frame<int> df4({"A", "B"}, cmatrix<int>({{1, 2}, {1, 0}, {1, 0}, {0, 2}}));
+    df4.set_na(1, "B");
+    df4.set_na(2, "B");
+    df4.set_na(3, "A");
+    EXPECT_EQ(df4.drop_duplicates().height(), 3);
+    EXPECT_TRUE(df4.drop_duplicates().is_na(1, 1));
+    EXPECT_EQ(df4.unique("B"), (std::vector<int>{2}));
+    EXPECT_EQ(df4.value_counts("A"), (std::vector<std::pair<int, size_t>>{{1, 3}}));
+
+    // LARGE DF: PARTITIONED TABLES
+    const size_t n = 200000;
+    cdata_frame<int> df5({"A", "B"}, cmatrix<int>(n, 2));
+    for (size_t r = 0; r < n; r++)
+    {
+        df5.cell(r, 0) = r % 1000;
+        df5.cell(r, 1) = r % 3;
+    }
+    EXPECT_EQ(df5.unique("A").size(), 1000);
+    EXPECT_EQ(df5.unique("A")[999], 999);
+    EXPECT_EQ(df5.drop_duplicates().height(), 3000);
+    EXPECT_EQ(df5.drop_duplicates({}, 1), df5.drop_duplicates({}, 4));
+    EXPECT_EQ(df5.value_counts("B")[0], std::make_pair(0, n / 3 + 1));
+
+    // ARENA STRINGS
+    cdata_frame<cdata_string> df6 = cdata_frame<cdata_string>::read_csv_arena("test/input/valid_header_index.csv", true, true);
+    EXPECT_EQ(df6.drop_duplicates().height(), df6.height());
+
+    // INVALID
+    EXPECT_THROW(df2.unique("C"), std::invalid_argument);
+    EXPECT_THROW(df2.drop_duplicates({"user", "C"}), std::invalid_argument);
+}
+
+/** @brief Test the 'pivot', 'pivot_table' and 'melt' methods of the 'DataFrame' class. */
+TEST(TestManipulation, reshape)
+{
+    // PIVOT
+    cdata_frame<int> df({"day", "city", "temp"}, cmatrix<int>({{1, 10, 20}, {1, 11, 25}, {2, 10, 22}, {3, 11, 18}}));
+    cdata_frame<int> df2 = df.pivot("day", "city", "temp");
+    EXPECT_EQ(df2.keys(), (std::vector<std::string>{"10", "11"}));
+    EXPECT_EQ(df2.index(), (std::vector<std::string>{"1", "2", "3"}));
+    EXPECT_EQ(df2.rows_vec(0), (std::vector<int>{20, 25}));
+    EXPECT_EQ(df2.cell(1, 0), 22);
+    EXPECT_TRUE(df2.is_na(1, 1));
+    EXPECT_TRUE(df2.is_na(2, 0));
+    EXPECT_EQ(df2.cell(2, 1), 18);
+
+    cdata_frame<int> df3 = df.copy();
+    df3.set_na(1, "temp");
+    df3.set_na(3, "day");
+    cdata_frame<int> df4 = df3.pivot("day", "city", "temp");
+    EXPECT_EQ(df4.index(), (std::vector<std::string>{"1", "2"}));
+    EXPECT_TRUE(df4.is_na(0, 1));
+
+    cdata_frame<int> df5({"day", "city", "temp"}, cmatrix<int>({{1, 10, 20}, {1, 10, 24}, {2, 10, 22}}));
+    EXPECT_THROW(df5.pivot("day", "city", "temp"), std::invalid_argument);
+    EXPECT_THROW(df.pivot("day", "city", "rain"), std::invalid_argument);
+
+    // PIVOT TABLE
+    cdata_frame<double> df6 = df5.pivot_table("day", "city", "temp");
+    EXPECT_EQ(df6.columns_vec(0), (std::vector<double>{22, 22}));
+    EXPECT_EQ(df5.pivot_table("day", "city", "temp", "sum").columns_vec(0), (std::vector<double>{44, 22}));
+    EXPECT_EQ(df5.pivot_table("day", "city", "temp", "count").columns_vec(0), (std::vector<double>{2, 1}));
+    EXPECT_EQ(df5.pivot_table("day", "city", "temp", "min").cell(0, 0), 20);
+    EXPECT_EQ(df5.pivot_table("day", "city", "temp", "max").cell(0, 0), 24);
+    cdata_frame<double> df7 = df.pivot_table("day", "city", "temp", "max");
+    EXPECT_TRUE(df7.is_na(1, 1));
+    EXPECT_FALSE(df.pivot_table("day", "city", "temp", "count").has_na());
+    EXPECT_THROW(df5.pivot_table("day", "city", "temp", "median"), std::invalid_argument);
+
+    // VALUES WITH MORE THAN 6 SIGNIFICANT DIGITS ARE DIFFERENT LABELS
+    cdata_frame<double> df12({"ts", "k", "v"}, cmatrix<double>({{1700000001, 1, 5}, {1700000002, 1, 6}, {1700000003, 1, 7}}));
+    cdata_frame<double> df13 = df12.pivot("ts", "k", "v");
+    EXPECT_EQ(df13.index(), (std::vector<std::string>{"1700000001", "1700000002", "1700000003"}));
+    EXPECT_EQ(df13.columns_vec(0), (std::vector<double>{5, 6, 7}));
+    EXPECT_EQ(df12.pivot_table("ts", "k", "v", "sum").height(), 3);
+
+    // MELT
+    cdata_frame<std::string> df8({"id", "a", "b"}, cmatrix<std::string>({{"x", "1", "2"}, {"y", "3", "4"}}));
+    cdata_frame<std::string> df9 = df8.melt({"id"});
+    EXPECT_EQ(df9.keys(), (std::vector<std::string>{"id", "variable", "value"}));
+    EXPECT_EQ(df9.height(), 4);
+    EXPECT_EQ(df9.rows_vec(0), (std::vector<std::string>{"x", "a", "1"}));
+    EXPECT_EQ(df9.rows_vec(3), (std::vector<std::string>{"y", "b", "4"}));
+    EXPECT_EQ(df8.melt({"id"}, {"b"}, "var", "val").rows_vec(1), (std::vector<std::string>{"y", "b", "4"}));
+    EXPECT_EQ(df8.melt({"id"}, {"b"}, "var", "val").keys(), (std::vector<std::string>{"id", "var", "val"}));
+
+    df8.set_na(1, "a");
+    cdata_frame<std::string> df10 = df8.melt({"id"});
+    EXPECT_TRUE(df10.is_na(1, 2));
+    EXPECT_FALSE(df10.is_na(3, 2));
+
+    // MELT OF NUMBERS: THE VARIABLE IS THE POSITION
+    cdata_frame<int> df11 = df2.melt({}, {"11", "10"});
+    EXPECT_EQ(df11.columns_vec(0), (std::vector<int>{0, 0, 0, 1, 1, 1}));
+    EXPECT_EQ(df11.cell(3, 1), 20);
+    EXPECT_TRUE(df11.is_na(1, 1));
+    EXPECT_TRUE(df11.is_na(5, 1));
+    EXPECT_THROW(df8.melt({"c"}), std::invalid_argument);
+}
+
+/** @brief Test the 'transpose' and 'transpose_inplace' methods of the 'DataFrame' class. */
+TEST(TestManipulation, transpose)
+{
+    // DF EMPTY
+    cdata_frame<int> df;
+    EXPECT_TRUE(df.transpose().is_empty());
+
+    // DF WITH KEYS, INDEX AND DATA
+    cdata_frame<int> df2({"A", "B"}, cmatrix<int>({{1, 2}, {3, 4}, {5, 6}}), {"a", "b", "c"});
+    df2.set_na(2, "B");
+    cdata_frame<int> df3 = df2.transpose();
+    EXPECT_EQ(df3.keys(), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(df3.index(), (std::vector<std::string>{"A", "B"}));
+    EXPECT_EQ(df3.rows_vec(0), (std::vector<int>{1, 3, 5}));
+    EXPECT_TRUE(df3.is_na(1, 2));
+    EXPECT_FALSE(df3.is_na(1, 1));
+    EXPECT_EQ(df3.transpose(), df2);
+
+    // LARGE DF: SEVERAL TILES
+    cdata_frame<int> df4(cmatrix<int>(70, 45));
+    for (size_t r = 0; r < 70; r++)
+        for (size_t c = 0; c < 45; c++)
+            df4.cell(r, c) = r * 100 + c;
+    cdata_frame<int> df5 = df4.transpose(3);
+    EXPECT_EQ(df5.height(), 45);
+    EXPECT_EQ(df5.width(), 70);
+    EXPECT_EQ(df5.cell(44, 69), 6944);
+    EXPECT_EQ(df5.cell(33, 65), 6533);
+
+    // IN PLACE
+    cdata_frame<int> df6(cmatrix<int>(67, 67));
+    for (size_t r = 0; r < 67; r++)
+        for (size_t c = 0; c < 67; c++)
+            df6.cell(r, c) = r * 100 + c;
+    std::vector<std::string> keys;
+    for (size_t c = 0; c < 67; c++)
+        keys.push_back("k" + std::to_string(c));
+    df6.set_keys(keys);
+    df6.set_na(3, 60);
+    cdata_frame<int> df7 = df6.transpose();
+    df6.transpose_inplace(2);
+    EXPECT_EQ(df6, df7);
+    EXPECT_EQ(df6.cell(60, 3), 360);
+    EXPECT_TRUE(df6.is_na(60, 3));
+    EXPECT_TRUE(df6.keys().empty());
+    EXPECT_EQ(df6.index(), keys);
+    EXPECT_THROW(df2.transpose_inplace(), std::invalid_argument);
+}
+
+/** @brief Test the 'astype' method of the 'DataFrame' class. */
+TEST(TestManipulation, astype)
+{
+    // DF EMPTY
+    EXPECT_TRUE(cdata_frame<std::string>().astype<double>().is_empty());
+
+    // STRINGS TO NUMBERS
+    cdata_frame<std::string> df({"A", "B"}, cmatrix<std::string>({{"1.5", " -42 "}, {"2e3", "7\r"}, {"bad", "x"}}), {"a", "b", "c"});
+    df.set_na(1, "B");
+    EXPECT_THROW(df.astype<double>(), std::invalid_argument);
+
+    cdata_frame<double> df2 = df.astype<double>(cdata_cast_error::coerce);
+    EXPECT_EQ(df2.keys(), df.keys());
+    EXPECT_EQ(df2.index(), df.index());
+    EXPECT_EQ(df2.columns_vec(0)[0], 1.5);
+    EXPECT_EQ(df2.cell(1, 0), 2000);
+    EXPECT_EQ(df2.cell(0, 1), -42);
+    EXPECT_TRUE(df2.is_na(1, 1));
+    EXPECT_TRUE(df2.is_na(2, 0));
+    EXPECT_TRUE(df2.is_na(2, 1));
+
+    cdata_frame<int> df3 = df.astype<int>(cdata_cast_error::fill, -1, 2);
+    EXPECT_EQ(df3.columns_vec(0), (std::vector<int>{-1, -1, -1}));
+    EXPECT_EQ(df3.cell(0, 1), -42);
+    EXPECT_TRUE(df3.is_na(1, 1));
+    EXPECT_FALSE(df3.is_na(2, 1));
+
+    // MOVED LABELS
+    cdata_frame<double> df4 = df.copy().astype<double>(cdata_cast_error::coerce);
+    EXPECT_EQ(df4, df2);
+
+    // NUMBERS TO STRINGS AND NUMBERS
+    cdata_frame<double> df5({"A"}, cmatrix<double>({{0.1}, {-3}, {1e300}, {1. / 3}}));
+    cdata_frame<std::string> df6 = df5.astype<std::string>();
+    EXPECT_EQ(df6.columns_vec(0), (std::vector<std::string>{"0.1", "-3", "1e+300", "0.33333333333333331"}));
+    EXPECT_EQ(df6.astype<double>(), df5);
+    EXPECT_EQ(df5.astype<int>(cdata_cast_error::coerce).cell(1, 0), -3);
+
+    // NUMBERS OUT OF THE RANGE OF THE TYPE
+    cdata_frame<double> df7({"A"}, cmatrix<double>({{1e20}, {std::nan("")}, {3.5}, {-1e300}}));
+    EXPECT_THROW(df7.astype<int>(), std::invalid_argument);
+    cdata_frame<int> df8 = df7.astype<int>(cdata_cast_error::coerce);
+    EXPECT_EQ(df8.isna("A"), cdata_mask({true, true, false, true}));
+    EXPECT_EQ(df8.cell(2, 0), 3);
+    EXPECT_EQ(df7.astype<int>(cdata_cast_error::fill, -1).columns_vec(0), (std::vector<int>{-1, -1, 3, -1}));
+    EXPECT_EQ(df7.astype<float>(cdata_cast_error::coerce).isna("A"), cdata_mask({false, false, false, true}));
+    EXPECT_EQ(cdata_frame<int>({"A"}, cmatrix<int>({{-1}, {300}})).astype<unsigned char>(cdata_cast_error::fill, 0).columns_vec(0), (std::vector<unsigned char>{0, 0}));
+    EXPECT_FALSE(df5.astype<std::string>(cdata_cast_error::coerce).has_na());
+
+    // PARSER
+    double d = 0;
+    int i = 0;
+    unsigned int u = 0;
+    const std::string vals[] = {"123456789012345678901234", "0.000001234", "-inf", "NaN", "1.7976931348623157e308", "4.9e-324", ".5", "5."};
+    const double expected[] = {123456789012345678901234., 0.000001234, -std::numeric_limits<double>::infinity(), 0, 1.7976931348623157e308, 4.9e-324, 0.5, 5};
+    for (size_t k = 0; k < 8; k++)
+    {
+        ASSERT_TRUE(cdata_parse::parse(vals[k].data(), vals[k].data() + vals[k].size(), d)) << vals[k];
+        if (k == 3)
+            EXPECT_TRUE(std::isnan(d));
+        else
+            EXPECT_EQ(d, expected[k]) << vals[k];
+    }
+    const std::string invalid[] = {"", ".", "1e", "1.2.3", "e5", "--1", "1 2"};
+    for (const std::string &val : invalid)
+        EXPECT_FALSE(cdata_parse::parse(val.data(), val.data() + val.size(), d)) << val;
+
+    const std::string ints[] = {"2147483647", "-2147483648", "2147483648", "1.0", "-1"};
+    EXPECT_TRUE(cdata_parse::parse(ints[0].data(), ints[0].data() + ints[0].size(), i) && i == 2147483647);
+    EXPECT_TRUE(cdata_parse::parse(ints[1].data(), ints[1].data() + ints[1].size(), i) && i == -2147483647 - 1);
+    EXPECT_FALSE(cdata_parse::parse(ints[2].data(), ints[2].data() + ints[2].size(), i));
+    EXPECT_FALSE(cdata_parse::parse(ints[3].data(), ints[3].data() + ints[3].size(), i));
+    EXPECT_FALSE(cdata_parse::parse(ints[4].data(), ints[4].data() + ints[4].size(), u));
+
+    // FLOATS ROUNDED ONCE, AS STRTOF
+    float f = 0;
+    const std::string floats[] = {"16777217.000000000001", "0.3333333333", "7e-11", "1e39"};
+    EXPECT_TRUE(cdata_parse::parse(floats[0].data(), floats[0].data() + floats[0].size(), f) && f == 16777218.f);
+    EXPECT_TRUE(cdata_parse::parse(floats[1].data(), floats[1].data() + floats[1].size(), f) && f == std::strtof(floats[1].c_str(), nullptr));
+    EXPECT_TRUE(cdata_parse::parse(floats[2].data(), floats[2].data() + floats[2].size(), f) && f == std::strtof(floats[2].c_str(), nullptr));
+    EXPECT_FALSE(cdata_parse::parse(floats[3].data(), floats[3].data() + floats[3].size(), f));
+}
+
 // ==================================================
 // STATIC
 
@@ -752,6 +1441,15 @@ TEST(TestStatic, read_csv)
     cdata_frame<std::string> df7 = cdata_frame<std::string>::read_csv("test/input/valid_delimiter.csv", false, false, ';');
     EXPECT_EQ(df7.data(), data);
 
+    // MISSING VALUES
+    cdata_frame<std::string> df8 = cdata_frame<std::string>::read_csv("test/input/valid_missing.csv");
+    EXPECT_EQ(df8.keys(), header);
+    EXPECT_EQ(df8.height(), 3);
+    EXPECT_EQ(df8.isna("Âge"), cdata_mask({false, true, false}));
+    EXPECT_EQ(df8.isna("Salaire"), cdata_mask({false, false, true}));
+    EXPECT_EQ(df8.dropna().data(), cmatrix<std::string>({{"Doe", "John", "30", "New York", "50000"}}));
+    EXPECT_FALSE(df4.has_na());
+
     // INVALID PATH
     EXPECT_THROW(cdata_frame<std::string>::read_csv("test/input/no_path.csv"), std::invalid_argument);
 
@@ -777,6 +1475,256 @@ TEST(TestStatic, read_csv)
     EXPECT_THROW(cdata_frame<std::string>::read_csv("test/input/invalid_header_and_index.csv", false, true), std::invalid_argument);
 }
 
+/** @brief Test the 'read_csv_async' method of the 'DataFrame' class. */
+TEST(TestStatic, read_csv_async)
+{
+    // DF EQUAL TO THE SYNCHRONOUS READ
+    const std::vector<std::tuple<std::string, bool, bool, char>> files({std::make_tuple("test/input/empty.csv", true, false, ','),
+                                                                        std::make_tuple("test/input/header.csv", true, false, ','),
+                                                                        std::make_tuple("test/input/valid.csv", false, false, ','),
+                                                                        std::make_tuple("test/input/valid_2.csv", false, false, ','),
+                                                                        std::make_tuple("test/input/valid_with_index.csv", false, true, ','),
+                                                                        std::make_tuple("test/input/valid_header_index.csv", true, true, ','),
+                                                                        std::make_tuple("test/input/valid_delimiter.csv", false, false, ';'),
+                                                                        std::make_tuple("test/input/valid_missing.csv", true, false, ',')});
+
+    for (const std::tuple<std::string, bool, bool, char> &file : files)
+    {
+        cdata_frame<std::string> df = cdata_frame<std::string>::read_csv(std::get<0>(file), std::get<1>(file), std::get<2>(file), std::get<3>(file));
+        cdata_frame<std::string> df2 = cdata_frame<std::string>::read_csv_async(std::get<0>(file), std::get<1>(file), std::get<2>(file), std::get<3>(file)).get();
+        EXPECT_EQ(df2.keys(), df.keys());
+        EXPECT_EQ(df2.index(), df.index());
+        EXPECT_EQ(df2.data(), df.data());
+        EXPECT_EQ(df2.has_na(), df.has_na());
+    }
+
+    cdata_frame<std::string> df3 = cdata_frame<std::string>::read_csv_async("test/input/valid_missing.csv").get();
+    EXPECT_EQ(df3.isna("Âge"), cdata_mask({false, true, false}));
+
+    // DF LARGER THAN A BUFFER, LINES CUT BETWEEN TWO BUFFERS
+    const std::string path = "test/input/generated_large.csv";
+    std::ofstream out(path);
+    out << "id,value,name\n";
+    for (size_t i = 0; i < 300000; i++)
+        out << i << "," << i * 7 << ",name" << std::string(i % 13, 'x') << (i % 101 == 0 ? "" : "y") << "\n";
+    out << "300000,,last";
+    out.close();
+
+    std::future<cdata_frame<std::string>> future = cdata_frame<std::string>::read_csv_async(path, true, false, ',', 4);
+    cdata_frame<std::string> df4 = cdata_frame<std::string>::read_csv(path);
+    cdata_frame<std::string> df5 = future.get();
+    std::remove(path.c_str());
+
+    EXPECT_EQ(df5.height(), 300001);
+    EXPECT_EQ(df5.keys(), df4.keys());
+    EXPECT_EQ(df5.data(), df4.data());
+    EXPECT_EQ(df5.isna("value"), df4.isna("value"));
+    EXPECT_EQ(df5.cell(300000, 2), "last");
+
+    // ERRORS THROWN BY GET
+    EXPECT_THROW(cdata_frame<std::string>::read_csv_async("test/input/no_path.csv").get(), std::invalid_argument);
+    EXPECT_THROW(cdata_frame<std::string>::read_csv_async("test/input/file.txt").get(), std::invalid_argument);
+    EXPECT_THROW(cdata_frame<std::string>::read_csv_async("test/input/invalid_data.csv").get(), std::invalid_argument);
+    EXPECT_THROW(cdata_frame<std::string>::read_csv_async("test/input/invalid_index_2.csv", false, true).get(), std::invalid_argument);
+}
+
+#ifdef CDATA_HAS_READER
+/** @brief Test the 'cdata_reader' class. */
+TEST(TestStatic, reader)
+{
+    // BUFFERS OF ONE PAGE, CONSUMED IN ORDER
+    std::ifstream file("test/input/valid_with_header.csv", std::ios::binary);
+    const std::string expected((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    cdata_reader reader("test/input/valid_with_header.csv", 1, 2);
+    EXPECT_EQ(reader.buffer_size(), size_t(sysconf(_SC_PAGESIZE)));
+
+    std::string text;
+    while (reader.read(text))
+        ;
+    EXPECT_EQ(text, expected);
+    EXPECT_FALSE(reader.read(text));
+
+    EXPECT_THROW(cdata_reader("test/input/no_path.csv"), std::runtime_error);
+    EXPECT_THROW(cdata_reader("test/input/valid.csv", 4096, 1), std::invalid_argument);
+}
+#endif
+
+/** @brief Test the 'to_arrow', 'from_arrow', 'write_arrow' and 'read_arrow' methods of the 'DataFrame' class. */
+TEST(TestStatic, arrow)
+{
+    // DF WITH KEYS, INDEX AND NA (STREAM FORMAT)
+    cdata_frame<double> df({"price", "weight"}, cmatrix<double>({{1.5, 2}, {-3, 4.25}, {5, 6}}), {"a", "b", "c"});
+    df.set_na(1, 0);
+
+    std::stringstream stream;
+    df.to_arrow(stream);
+    cdata_frame<double> df2 = cdata_frame<double>::from_arrow(stream);
+    EXPECT_EQ(df2.keys(), df.keys());
+    EXPECT_EQ(df2.index(), df.index());
+    EXPECT_EQ(df2.cell(0, 0), 1.5);
+    EXPECT_EQ(df2.cell(1, 1), 4.25);
+    EXPECT_TRUE(df2.is_na(1, 0));
+    EXPECT_FALSE(df2.is_na(0, 0));
+
+    // DF OF STRINGS WITHOUT KEYS (FILE FORMAT)
+    const std::string path = "test/input/generated.arrow";
+    cdata_frame<std::string> df3(cmatrix<std::string>({{"x", ""}, {"yz", "12"}}));
+    df3.set_na(0, 1);
+    df3.write_arrow(path);
+
+    cdata_frame<std::string> df4 = cdata_frame<std::string>::read_arrow(path);
+    EXPECT_EQ(df4.keys().size(), 0);
+    EXPECT_EQ(df4.index().size(), 0);
+    EXPECT_EQ(df4.data(), df3.data());
+    EXPECT_TRUE(df4.is_na(0, 1));
+    EXPECT_FALSE(df4.has_index());
+
+    // CONVERSION OF THE TYPE OF THE COLUMNS
+    EXPECT_THROW(cdata_frame<int>::read_arrow(path), std::invalid_argument);
+    std::remove(path.c_str());
+
+    stream.clear();
+    stream.seekg(0);
+    cdata_frame<int> df5 = cdata_frame<int>::from_arrow(stream);
+    EXPECT_EQ(df5.cell(0, 0), 1);
+    EXPECT_EQ(df5.cell(1, 1), 4);
+    EXPECT_TRUE(df5.is_na(1, 0));
+
+    stream.clear();
+    stream.seekg(0);
+    cdata_frame<std::string> df6 = cdata_frame<std::string>::from_arrow(stream);
+    EXPECT_EQ(df6.cell(2, 1), "6");
+    EXPECT_EQ(df6.index(), df.index());
+    EXPECT_TRUE(df6.is_na(1, 0));
+
+    // NARROWING: A VALUE OUT OF THE RANGE OF THE TYPE IS AN ERROR
+    std::stringstream wide;
+    cdata_frame<int64_t>({"A"}, cmatrix<int64_t>({{int64_t(1) << 40}, {-5}})).to_arrow(wide);
+    EXPECT_THROW(cdata_frame<int>::from_arrow(wide), std::invalid_argument);
+    wide.clear();
+    wide.seekg(0);
+    EXPECT_EQ(cdata_frame<int64_t>::from_arrow(wide).cell(0, 0), int64_t(1) << 40);
+    wide.clear();
+    wide.seekg(0);
+    EXPECT_THROW(cdata_frame<unsigned int>::from_arrow(wide), std::invalid_argument);
+
+    std::stringstream small;
+    cdata_frame<double>({"A"}, cmatrix<double>({{-2.5}, {3e9}})).to_arrow(small);
+    EXPECT_THROW(cdata_frame<int>::from_arrow(small), std::invalid_argument);
+    small.clear();
+    small.seekg(0);
+    EXPECT_EQ(cdata_frame<int64_t>::from_arrow(small).cell(1, 0), 3000000000);
+
+    // EMPTY DF
+    std::stringstream empty;
+    cdata_frame<int>().to_arrow(empty);
+    EXPECT_TRUE(cdata_frame<int>::from_arrow(empty).is_empty());
+
+    // INVALID DATA
+    std::string bytes = stream.str();
+    std::stringstream truncated(bytes.substr(0, bytes.size() / 2));
+    EXPECT_THROW(cdata_frame<double>::from_arrow(truncated), std::runtime_error);
+    std::stringstream garbage("not an arrow stream");
+    EXPECT_THROW(cdata_frame<double>::from_arrow(garbage), std::runtime_error);
+    EXPECT_THROW(cdata_frame<double>::read_arrow("test/input/no_path.arrow"), std::invalid_argument);
+    std::stringstream out;
+    EXPECT_THROW(cdata_frame<long double>({"key"}, cmatrix<long double>({{1}})).to_arrow(out), std::invalid_argument);
+}
+
+/** @brief Test the 'read_csv_arena' method of the 'DataFrame' class. */
+TEST(TestStatic, read_csv_arena)
+{
+    // DF WITH DATA
+    cdata_frame<std::string> df = cdata_frame<std::string>::read_csv("test/input/valid_header_index.csv", true, true);
+    cdata_frame<cdata_string> df2 = cdata_frame<cdata_string>::read_csv_arena("test/input/valid_header_index.csv", true, true, ',', 256);
+    EXPECT_EQ(df2.keys(), df.keys());
+    EXPECT_EQ(df2.index(), df.index());
+    EXPECT_EQ(df2.height(), df.height());
+    EXPECT_EQ(df2.width(), df.width());
+
+    for (size_t r = 0; r < df.height(); r++)
+        for (size_t c = 0; c < df.width(); c++)
+            EXPECT_EQ(std::string(df2.cell(r, c).begin(), df2.cell(r, c).end()), df.cell(r, c));
+
+    // THE CELLS SHARE ONE ARENA
+    const std::shared_ptr<cdata_arena> &arena = df2.cell(0, 0).get_allocator().arena();
+    ASSERT_NE(arena, nullptr);
+    EXPECT_EQ(df2.cell(df2.height() - 1, df2.width() - 1).get_allocator().arena(), arena);
+
+    // THE ARENA OUTLIVES THE DATA FRAME
+    cdata_string cell = df2.cell(0, 0);
+    const std::string expected = df.cell(0, 0);
+    df2.clear();
+    EXPECT_EQ(std::string(cell.begin(), cell.end()), expected);
+
+    // MISSING VALUES
+    cdata_frame<cdata_string> df3 = cdata_frame<cdata_string>::read_csv_arena("test/input/valid_missing.csv");
+    EXPECT_EQ(df3.isna("Âge"), cdata_mask({false, true, false}));
+
+    // ARENA
+    cdata_arena arena2(64);
+    void *ptr = arena2.allocate(10, 8);
+    void *ptr2 = arena2.allocate(10, 8);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr2) % 8, 0);
+    EXPECT_EQ(static_cast<char *>(ptr2) - static_cast<char *>(ptr), 16);
+    EXPECT_EQ(arena2.n_slabs(), 1);
+    arena2.allocate(1000);
+    EXPECT_EQ(arena2.n_slabs(), 2);
+    arena2.allocate(10, 1);
+    EXPECT_EQ(arena2.n_slabs(), 2);
+    EXPECT_THROW(cdata_arena(0), std::invalid_argument);
+
+    // INVALID PATH
+    EXPECT_THROW(cdata_frame<cdata_string>::read_csv_arena("test/input/no_path.csv"), std::invalid_argument);
+}
+
+/** @brief Test the 'concat' method of the 'DataFrame' class. */
+TEST(TestStatic, concat)
+{
+    // DF EMPTY
+    EXPECT_TRUE(cdata_frame<int>::concat({}).is_empty());
+    EXPECT_TRUE(cdata_frame<int>::concat({cdata_frame<int>(), cdata_frame<int>()}).is_empty());
+
+    // AXIS 0
+    std::vector<cdata_frame<int>> parts;
+    for (int p = 0; p < 50; p++)
+        parts.push_back(cdata_frame<int>({"A", "B"}, cmatrix<int>({{p, -p}, {p + 100, -p - 100}}), {"a" + std::to_string(p), "b" + std::to_string(p)}));
+    parts[3].set_na(1, "B");
+    parts.insert(parts.begin() + 10, cdata_frame<int>());
+
+    cdata_frame<int> df = cdata_frame<int>::concat(parts);
+    EXPECT_EQ(df.height(), 100);
+    EXPECT_EQ(df.keys(), (std::vector<std::string>{"A", "B"}));
+    EXPECT_EQ(df.rows_vec(7), (std::vector<int>{103, -103}));
+    EXPECT_EQ(df.index()[99], "b49");
+    EXPECT_TRUE(df.is_na(7, 1));
+    EXPECT_EQ(df.col("B").count(), 99);
+
+    cdata_frame<int> df2 = parts[0].copy();
+    df2.concatenate(parts[1]);
+    EXPECT_EQ(cdata_frame<int>::concat({parts[0], parts[1]}), df2);
+
+    // AXIS 1
+    cdata_frame<int> df3({"A"}, cmatrix<int>({{1}, {2}}), {"a", "b"});
+    cdata_frame<int> df4({"B", "C"}, cmatrix<int>({{3, 4}, {5, 6}}), {"a", "b"});
+    df4.set_na(0, "C");
+    cdata_frame<int> df5 = cdata_frame<int>::concat({df3, df4}, 1);
+    EXPECT_EQ(df5.data(), (cmatrix<int>{{1, 3, 4}, {2, 5, 6}}));
+    EXPECT_EQ(df5.keys(), (std::vector<std::string>{"A", "B", "C"}));
+    EXPECT_EQ(df5.index(), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(df5.isna("C"), cdata_mask({true, false}));
+    EXPECT_FALSE(df5.is_na(0, 0));
+
+    // INVALID
+    EXPECT_THROW(cdata_frame<int>::concat({parts[0], parts[0]}), std::invalid_argument);
+    EXPECT_THROW(cdata_frame<int>::concat({df3, df3}, 1), std::invalid_argument);
+    EXPECT_THROW(cdata_frame<int>::concat({df3, df4}), std::invalid_argument);
+    EXPECT_THROW(cdata_frame<int>::concat({df3, parts[0]}, 1), std::invalid_argument);
+    EXPECT_THROW(cdata_frame<int>::concat({df3, cdata_frame<int>({"A"}, cmatrix<int>({{1}}))}), std::invalid_argument);
+    EXPECT_THROW(cdata_frame<int>::concat({df3, df4}, 2), std::invalid_argument);
+}
+
 /** @brief Test the 'merge' method of the 'DataFrame' class. */
 TEST(TestStatic, merge)
 {
@@ -933,6 +1881,162 @@ TEST(TestGeneral, clear)
     EXPECT_TRUE(df5.keys().empty());
 }
 
+/** @brief Test the 'memory_usage' method of the 'DataFrame' class. */
+TEST(TestGeneral, memory_usage)
+{
+    // DF EMPTY
+    cdata_frame<int> df;
+    EXPECT_TRUE(df.memory_usage().columns.empty());
+    EXPECT_EQ(df.memory_usage().total, sizeof(df));
+
+    // DF WITH DATA
+    cdata_frame<int> df2({"A", "B", "C"}, cmatrix<int>({{1, 2, 3}, {4, 5, 6}}));
+    cdata_memory_usage usage = df2.memory_usage();
+    EXPECT_EQ(usage.columns, (std::vector<size_t>{2 * sizeof(int), 2 * sizeof(int), 2 * sizeof(int)}));
+    EXPECT_GE(usage.keys, 3 * sizeof(std::string));
+    EXPECT_EQ(usage.valid, 0);
+    EXPECT_EQ(usage.total, sizeof(df2) + 6 * sizeof(int) + usage.keys + usage.index);
+    EXPECT_EQ(df2.memory_usage(true).total, usage.total);
+
+    // MISSING VALUES
+    df2.set_na(0, "B");
+    EXPECT_GE(df2.memory_usage().valid, 3 * sizeof(uint64_t));
+
+    // DEEP: THE HEAP BUFFERS OF THE STRINGS
+    const std::string long_str(100, 'x');
+    cdata_frame<std::string> df3({"A", "B"}, cmatrix<std::string>({{long_str, "a"}, {long_str, "b"}}), {long_str, "index"});
+    cdata_memory_usage usage2 = df3.memory_usage();
+    cdata_memory_usage usage3 = df3.memory_usage(true);
+    EXPECT_EQ(usage2.columns[0], 2 * sizeof(std::string));
+    EXPECT_GE(usage3.columns[0], usage2.columns[0] + 2 * 101);
+    EXPECT_EQ(usage3.columns[1], usage2.columns[1]);
+    EXPECT_GE(usage3.index, usage2.index + 101);
+    EXPECT_GT(usage3.total, usage2.total);
+
+    // INFO
+    testing::internal::CaptureStdout();
+    df3.info(true);
+    const std::string info = testing::internal::GetCapturedStdout();
+    EXPECT_NE(info.find("column 'A': 2 non-null, " + std::to_string(usage3.columns[0]) + " bytes"), std::string::npos);
+    EXPECT_NE(info.find("memory usage (deep): " + std::to_string(usage3.total) + " bytes"), std::string::npos);
+}
+
+/** @brief Test the 'print' method and the stream operator of the 'DataFrame' class. */
+TEST(TestGeneral, print)
+{
+    // DF WITH KEYS, INDEX AND DATA
+    cdata_frame<double> df({"A", "Bé", "C"}, cmatrix<double>({{1.5, -2, 3e10}, {4, 5.25, 6}, {7, 8, 9}}), {"a", "b", "c"});
+    std::ostringstream os;
+    os << df;
+    EXPECT_EQ(os.str(), "┌───╥─────┬──────┬───────┐\n"
+                        "│   ║ A   │ Bé   │ C     │ \n"
+                        "╞═══╬═════╪══════╪═══════╡\n"
+                        "│ a ║ 1.5 │ -2   │ 3e+10 │ \n"
+                        "├───╫─────┼──────┼───────┤\n"
+                        "│ b ║ 4   │ 5.25 │ 6     │ \n"
+                        "├───╫─────┼──────┼───────┤\n"
+                        "│ c ║ 7   │ 8    │ 9     │ \n"
+                        "└───╨─────┴──────┴───────┘\n");
+
+    // HEAD AND TAIL: THE WIDTHS ONLY DEPEND ON THE ROWS PRINTED
+    cdata_frame<int> df2(cmatrix<int>({{1, 2, 3}, {-123456, 5, 6}, {7, 8, 9}}));
+    df2.set_na(2, 1);
+    testing::internal::CaptureStdout();
+    df2.print(1, 1);
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "┌───┬────┬───┐\n"
+                                                      "│ 1 │ 2  │ 3 │ \n"
+                                                      "├───┼────┼───┤\n"
+                                                      "│ … │ …  │ … │ \n"
+                                                      "├───┼────┼───┤\n"
+                                                      "│ 7 │ NA │ 9 │ \n"
+                                                      "└───┴────┴───┘\n");
+
+    // COLUMN TRUNCATION
+    testing::internal::CaptureStdout();
+    df2.print(2, 0, 2);
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "┌─────────┬───┬───┐\n"
+                                                      "│ 1       │ … │ 3 │ \n"
+                                                      "├─────────┼───┼───┤\n"
+                                                      "│ -123456 │ … │ 6 │ \n"
+                                                      "├─────────┼───┼───┤\n"
+                                                      "│ …       │ … │ … │ \n"
+                                                      "└─────────┴───┴───┘\n");
+
+    // NO ROW PRINTED: THE INDEX KEEPS THE WIDTH OF THE HEADER
+    testing::internal::CaptureStdout();
+    df.print(0);
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "┌──╥───┬────┬───┐\n"
+                                                      "│  ║ A │ Bé │ C │ \n"
+                                                      "╞══╬═══╪════╪═══╡\n"
+                                                      "└──╨───┴────┴───┘\n");
+}
+
+/** @brief Test the trace registry of the 'DataFrame' class. */
+TEST(TestGeneral, trace)
+{
+    cdata_trace &trace = cdata_trace::instance();
+    trace.clear();
+
+    // SCOPES RECORDED IN THE REGISTRY
+    {
+        cdata_trace_scope scope("op");
+        scope.add(2, 16, 1);
+    }
+    {
+        cdata_trace_scope scope("op");
+        scope.add(3, 8, 0);
+    }
+
+    cdata_trace_stats stats = trace.stats("op");
+    EXPECT_EQ(stats.calls, 2);
+    EXPECT_EQ(stats.rows, 5);
+    EXPECT_EQ(stats.bytes, 24);
+    EXPECT_EQ(stats.allocations, 1);
+    EXPECT_EQ(trace.stats("unknown").calls, 0);
+    ASSERT_EQ(trace.events().size(), 2);
+    EXPECT_LE(trace.events()[0].start + trace.events()[0].duration, trace.events()[1].start + trace.events()[1].duration);
+
+    // CHROME TRACE EVENTS
+    std::ostringstream os;
+    trace.write_chrome_trace(os);
+    EXPECT_EQ(os.str().find("{\"traceEvents\":["), 0);
+    EXPECT_NE(os.str().find("\"name\":\"op\",\"cat\":\"cdataframe\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(os.str().find("\"args\":{\"rows\":2,\"bytes\":16,\"allocations\":1}"), std::string::npos);
+
+    // EVENTS DROPPED, COUNTERS KEPT
+    trace.set_max_events(2);
+    {
+        cdata_trace_scope scope("op");
+    }
+    EXPECT_EQ(trace.events().size(), 2);
+    EXPECT_EQ(trace.dropped(), 1);
+    EXPECT_EQ(trace.stats("op").calls, 3);
+    trace.set_max_events(size_t(cdata_trace::default_max_events));
+
+    // OPERATIONS OF THE DATA FRAME, ONLY TRACED WITH 'CDATA_TRACE'
+    trace.clear();
+    cdata_frame<int> df({"A", "B"}, cmatrix<int>({{1, 2}, {3, 4}}), {"a", "b"});
+    cdata_frame<int> df2 = df.copy();
+    df2.insert_row(2, {5, 6}, "c");
+    df2.slice_rows(0, 1);
+    EXPECT_THROW(df2.slice_rows(0, 5), std::out_of_range);
+    cdata_ring_frame<int>(df2).to_frame();
+
+#ifdef CDATA_TRACE
+    EXPECT_EQ(trace.stats("copy").calls, 1);
+    EXPECT_EQ(trace.stats("copy").bytes, 4 * sizeof(int));
+    EXPECT_EQ(trace.stats("insert_row").calls, 0);
+    EXPECT_EQ(trace.stats("slice_rows").rows, 2);
+    EXPECT_EQ(trace.stats("slice_rows").bytes, 4 * sizeof(int));
+    EXPECT_EQ(trace.stats("to_frame").calls, 1);
+    EXPECT_EQ(trace.stats("to_frame").rows, 3);
+#else
+    EXPECT_TRUE(trace.stats().empty());
+#endif
+
+    trace.clear();
+}
+
 // ==================================================
 // OPERATORS
 
@@ -1016,6 +2120,635 @@ TEST(TestOperators, operator_not_equal)
     EXPECT_TRUE(df13 != df14);
 }
 
+// ==================================================
+// STATISTIC
+
+/** @brief Test the 'rolling' and 'expanding' methods of the 'DataFrame' class. */
+TEST(TestStatistic, rolling)
+{
+    cdata_frame<int> df({"A", "B"}, cmatrix<int>({{1, 5}, {3, 2}, {2, 8}, {6, 1}, {4, 4}}), {"a", "b", "c", "d", "e"});
+
+    // ROLLING
+    cdata_frame<double> df2 = df.rolling(2).sum();
+    EXPECT_EQ(df2.keys(), df.keys());
+    EXPECT_EQ(df2.index(), df.index());
+    EXPECT_TRUE(df2.is_na(0, 0));
+    EXPECT_TRUE(df2.is_na(0, 1));
+    EXPECT_EQ(df2.rows_vec(1), (std::vector<double>{4, 7}));
+    EXPECT_EQ(df2.rows_vec(4), (std::vector<double>{10, 5}));
+
+    cdata_frame<double> df3 = df.rolling(3).min();
+    EXPECT_EQ(df3.columns_vec(0), (std::vector<double>{0, 0, 1, 2, 2}));
+    EXPECT_EQ(df3.columns_vec(1), (std::vector<double>{0, 0, 2, 1, 1}));
+    EXPECT_EQ(df.rolling(3).max().columns_vec(0), (std::vector<double>{0, 0, 3, 6, 6}));
+    EXPECT_EQ(df.rolling(3).mean().cell(2, 0), 2);
+    EXPECT_DOUBLE_EQ(df.rolling(3).var().cell(3, 0), 13. / 3);
+    EXPECT_DOUBLE_EQ(df.rolling(2).std().cell(1, 1), std::sqrt(4.5));
+    EXPECT_EQ(df.rolling(2, 1).count().columns_vec(0), (std::vector<double>{1, 2, 2, 2, 2}));
+    EXPECT_EQ(df.rolling(3).agg("max"), df.rolling(3).max());
+
+    // EXPANDING
+    cdata_frame<double> df4 = df.expanding().max();
+    EXPECT_EQ(df4.columns_vec(0), (std::vector<double>{1, 3, 3, 6, 6}));
+    EXPECT_EQ(df.expanding().sum().columns_vec(1), (std::vector<double>{5, 7, 15, 16, 20}));
+    EXPECT_TRUE(df.expanding().var().is_na(0, 0));
+
+    // MISSING VALUES
+    cdata_frame<int> df5 = df.copy();
+    df5.set_na(1, "A");
+    cdata_frame<double> df6 = df5.rolling(2, 1).sum();
+    EXPECT_EQ(df6.columns_vec(0), (std::vector<double>{1, 1, 2, 8, 10}));
+    EXPECT_FALSE(df6.has_na());
+    cdata_frame<double> df7 = df5.rolling(2).mean();
+    EXPECT_TRUE(df7.is_na(1, 0));
+    EXPECT_TRUE(df7.is_na(2, 0));
+    EXPECT_EQ(df7.cell(3, 0), 4);
+    EXPECT_EQ(df5.expanding().count().columns_vec(0), (std::vector<double>{1, 1, 2, 3, 4}));
+
+    // EMPTY
+    EXPECT_TRUE(cdata_frame<int>().rolling(2).sum().is_empty());
+
+    // INVALID
+    EXPECT_THROW(df.rolling(0), std::invalid_argument);
+    EXPECT_THROW(df.rolling(2, 3), std::invalid_argument);
+    EXPECT_THROW(df.rolling(2).agg("median"), std::invalid_argument);
+}
+
+/** @brief Test the 'describe' method of the 'DataFrame' class. */
+TEST(TestStatistic, describe)
+{
+    cdata_frame<int> df({"A", "B"}, cmatrix<int>({{1, 5}, {3, 2}, {2, 8}, {6, 1}, {4, 4}}));
+    cdata_frame<double> df2 = df.describe();
+    EXPECT_EQ(df2.keys(), df.keys());
+    EXPECT_EQ(df2.index(), (std::vector<std::string>{"count", "mean", "std", "min", "25%", "50%", "75%", "max"}));
+    EXPECT_EQ(df2.rows_vec(0), (std::vector<double>{5, 5}));
+    EXPECT_DOUBLE_EQ(df2.cell(1, 0), 3.2);
+    EXPECT_DOUBLE_EQ(df2.cell(2, 0), std::sqrt(3.7));
+    EXPECT_EQ(df2.columns_vec(0)[3], 1);
+    EXPECT_EQ(df2.columns_vec(0)[4], 2);
+    EXPECT_EQ(df2.columns_vec(0)[5], 3);
+    EXPECT_EQ(df2.columns_vec(0)[6], 4);
+    EXPECT_EQ(df2.columns_vec(0)[7], 6);
+    EXPECT_EQ(df2.cell(1, 1), 4);
+    EXPECT_EQ(df2.cell(5, 1), 4);
+    EXPECT_FALSE(df2.has_na());
+
+    // INTERPOLATED QUARTILES AND MISSING VALUES
+    cdata_frame<double> df3(cmatrix<double>({{1.5, 1}, {-2, 2}, {7, 3}, {0, 4}}));
+    df3.set_na(1, 0);
+    df3.set_na(0, 1);
+    df3.set_na(1, 1);
+    df3.set_na(2, 1);
+    cdata_frame<double> df4 = df3.describe();
+    EXPECT_EQ(df4.cell(0, 0), 3);
+    EXPECT_DOUBLE_EQ(df4.cell(4, 0), 0.75);
+    EXPECT_EQ(df4.cell(5, 0), 1.5);
+    EXPECT_DOUBLE_EQ(df4.cell(6, 0), 4.25);
+    EXPECT_EQ(df4.cell(0, 1), 1);
+    EXPECT_TRUE(df4.is_na(2, 1));
+    EXPECT_EQ(df4.cell(7, 1), 4);
+
+    // SEVERAL BLOCKS OF ROWS MERGED
+    const size_t n = 40000;
+    cdata_frame<int> df5(cmatrix<int>(n, 2));
+    for (size_t r = 0; r < n; r++)
+    {
+        df5.cell(r, 0) = n - 1 - r;
+        df5.cell(r, 1) = r % 2;
+    }
+    df5.set_na(n - 1, 1);
+    cdata_frame<double> df6 = df5.describe(4);
+    EXPECT_DOUBLE_EQ(df6.cell(1, 0), (n - 1) / 2.);
+    EXPECT_NEAR(df6.cell(2, 0), std::sqrt(n * (n + 1) / 12.), 1e-6);
+    EXPECT_DOUBLE_EQ(df6.cell(4, 0), 9999.75);
+    EXPECT_EQ(df6.cell(7, 0), n - 1);
+    EXPECT_EQ(df6.cell(0, 1), n - 1);
+    EXPECT_DOUBLE_EQ(df6.cell(1, 1), (n / 2 - 1) / double(n - 1));
+
+    // ALL MISSING AND EMPTY
+    cdata_frame<int> df7(cmatrix<int>({{1}}));
+    df7.set_na(0, 0);
+    cdata_frame<double> df8 = df7.describe();
+    EXPECT_EQ(df8.cell(0, 0), 0);
+    EXPECT_TRUE(df8.is_na(1, 0));
+    EXPECT_TRUE(df8.is_na(7, 0));
+    EXPECT_TRUE(cdata_frame<int>().describe().is_empty());
+}
+
+/** @brief Test the 'quantile' and 'digest' methods of the 'DataFrame' class. */
+TEST(TestStatistic, quantile)
+{
+    // EXACT
+    cdata_frame<int> df({"A", "B"}, cmatrix<int>({{1, 5}, {3, 2}, {2, 8}, {6, 1}, {4, 4}}));
+    EXPECT_EQ(df.quantile(0.5, "A"), 3);
+    EXPECT_EQ(df.quantile(0, "B"), 1);
+    EXPECT_EQ(df.quantile(1, "B"), 8);
+    EXPECT_DOUBLE_EQ(df.quantile(0.9, "A"), 5.2);
+    EXPECT_EQ(df.quantile({0.25, 0.5, 0.75}, "B"), (std::vector<double>{2, 4, 5}));
+
+    df.set_na(3, "A");
+    EXPECT_EQ(df.quantile(1, "A"), 4);
+    EXPECT_DOUBLE_EQ(df.quantile(0.5, "A"), 2.5);
+
+    // APPROXIMATE
+    const size_t n = 100000;
+    cdata_frame<double> df2({"latency"}, cmatrix<double>(n, 1));
+    for (size_t r = 0; r < n; r++)
+        df2.cell(r, 0) = (r * 7919) % n;
+
+    cdata_digest digest = df2.digest("latency");
+    EXPECT_EQ(digest.count(), n);
+    EXPECT_LE(digest.size(), 200);
+    EXPECT_EQ(digest.quantile(0), 0);
+    EXPECT_EQ(digest.quantile(1), n - 1);
+    EXPECT_NEAR(digest.quantile(0.5), df2.quantile(0.5, "latency"), n * 0.005);
+    EXPECT_NEAR(digest.quantile(0.99), df2.quantile(0.99, "latency"), n * 0.001);
+    EXPECT_NEAR(digest.quantile(0.999), df2.quantile(0.999, "latency"), n * 0.0002);
+
+    // SAME DIGEST FOR THE SAME NUMBER OF THREADS
+    cdata_digest digest4 = df2.digest("latency", 100, 4);
+    for (int i = 0; i < 5; i++)
+    {
+        cdata_digest again = df2.digest("latency", 100, 4);
+        EXPECT_EQ(again.size(), digest4.size());
+        EXPECT_EQ(again.quantile(0.9999), digest4.quantile(0.9999));
+    }
+
+    // MERGED BY CHUNKS
+    cdata_digest digest2;
+    for (size_t start = 0; start < n; start += n / 4)
+        digest2.merge(df2.slice_rows(start, start + n / 4 - 1).digest("latency", 100, 1));
+    EXPECT_EQ(digest2.count(), n);
+    EXPECT_NEAR(digest2.quantile(0.99), df2.quantile(0.99, "latency"), n * 0.001);
+
+    // SMALL DIGEST: THE VALUES ARE KEPT
+    cdata_digest digest3;
+    digest3.add(3);
+    digest3.add(1);
+    digest3.add(std::nan(""));
+    EXPECT_EQ(digest3.count(), 2);
+    EXPECT_EQ(digest3.quantile(0.25), 1);
+    EXPECT_EQ(digest3.quantile(0.75), 3);
+
+    // CONST QUERIES: THE BUFFER IS MERGED IN A COPY, THE SAME AS ONCE COMPRESSED
+    cdata_digest digest5;
+    for (size_t r = 0; r < 500; r++)
+        digest5.add(df2.cell(r, 0));
+
+    const cdata_digest &view = digest5;
+    const size_t size5 = view.size();
+    const double p99 = view.quantile(0.99);
+    EXPECT_EQ(view.quantile(0.99), p99);
+    digest5.compress();
+    EXPECT_EQ(digest5.size(), size5);
+    EXPECT_EQ(digest5.quantile(0.99), p99);
+
+    // INVALID
+    EXPECT_THROW(df.quantile(1.5, "A"), std::invalid_argument);
+    EXPECT_THROW(df.quantile(0.5, "C"), std::invalid_argument);
+    EXPECT_THROW(cdata_digest().quantile(0.5), std::runtime_error);
+    EXPECT_THROW(cdata_digest(0), std::invalid_argument);
+    cdata_frame<int> df3(cmatrix<int>({{1}}));
+    df3.set_na(0, 0);
+    df3.set_keys({"A"});
+    EXPECT_THROW(df3.quantile(0.5, "A"), std::runtime_error);
+}
+
+// ==================================================
+// MAPPED
+
+#ifdef CDATA_HAS_MAPPED_FRAME
+/** @brief Test the 'cdata_mapped_frame' class. */
+TEST(TestMapped, storage)
+{
+    // DF EMPTY
+    cdata_mapped_frame<double> df({"A", "B"}, 10, 0);
+    EXPECT_TRUE(df.is_empty());
+    EXPECT_TRUE(df.to_frame().is_empty());
+    EXPECT_EQ(df.chunk_rows() * sizeof(double) % sysconf(_SC_PAGESIZE), 0);
+    EXPECT_THROW(df.min("A"), std::runtime_error);
+    EXPECT_THROW(cdata_mapped_frame<int>(std::vector<std::string>()), std::invalid_argument);
+
+    // CHUNKS MAPPED AND EVICTED: AT MOST ONE RESIDENT WITH A BUDGET OF 0
+    const size_t n = 3 * df.chunk_rows() + 7;
+    for (size_t r = 0; r < n; r++)
+        df.push_row_back({double(r), -double(r)});
+
+    EXPECT_EQ(df.height(), n);
+    EXPECT_EQ(df.resident(), df.chunk_rows() * sizeof(double));
+    EXPECT_EQ(df.get(n - 1, 0), n - 1);
+    EXPECT_EQ(df.get(df.chunk_rows(), 1), -double(df.chunk_rows()));
+    EXPECT_EQ(df.sum("A"), n * (n - 1) / 2.);
+    EXPECT_EQ(df.mean("B"), -(n - 1.) / 2);
+    EXPECT_EQ(df.min("B"), -double(n - 1));
+    EXPECT_EQ(df.max("A"), n - 1);
+
+    df.set(5, 1, 100);
+    EXPECT_EQ(df.max("B"), 100);
+    EXPECT_EQ(df.columns_vec("A").size(), n);
+    EXPECT_EQ(df.columns_vec("B")[5], 100);
+
+    // SLICES IN MEMORY
+    cdata_frame<double> df2 = df.slice_rows(df.chunk_rows() - 1, df.chunk_rows() + 1);
+    EXPECT_EQ(df2.keys(), df.keys());
+    EXPECT_EQ(df2.columns_vec(0), (std::vector<double>{df.chunk_rows() - 1., double(df.chunk_rows()), df.chunk_rows() + 1.}));
+    EXPECT_EQ(df.to_frame().height(), n);
+    EXPECT_THROW(df.slice_rows(2, n), std::out_of_range);
+    EXPECT_THROW(df.get(n, 0), std::out_of_range);
+    EXPECT_THROW(df.sum("C"), std::invalid_argument);
+    EXPECT_THROW(df.push_row_back({1}), std::invalid_argument);
+
+    // FROM A DATA FRAME, EVERYTHING RESIDENT
+    cdata_frame<int> df3({"A", "B"}, cmatrix<int>({{1, 2}, {3, 4}, {5, 6}}));
+    cdata_mapped_frame<int> df4(df3);
+    EXPECT_EQ(df4.to_frame(), df3);
+    df4.sum("A");
+    df4.sum("A");
+    EXPECT_EQ(df4.n_maps(), 2);
+}
+#endif
+
+// ==================================================
+// RING
+
+/** @brief Test the manipulation methods of the 'cdata_ring_frame' class. */
+TEST(TestRing, manipulation)
+{
+    // DF EMPTY
+    cdata_ring_frame<int> ring({"A", "B"});
+    EXPECT_TRUE(ring.is_empty());
+    EXPECT_TRUE(ring.to_frame().is_empty());
+    EXPECT_THROW(ring.pop_row_front(), std::out_of_range);
+    EXPECT_THROW(ring.pop_row_back(), std::out_of_range);
+
+    // QUEUE: THE RING WRAPS AROUND WITHOUT GROWING
+    for (int i = 0; i < 100; i++)
+    {
+        ring.push_row_back({i, -i});
+        if (i >= 4)
+            ring.pop_row_front();
+    }
+    EXPECT_EQ(ring.height(), 4);
+    EXPECT_EQ(ring.capacity(), 8);
+    EXPECT_EQ(ring.row(0), (std::vector<int>{96, -96}));
+    EXPECT_EQ(ring.cell(3, 1), -99);
+
+    // PUSH FRONT AND GROW
+    std::deque<std::vector<int>> expected(ring.height());
+    for (size_t i = 0; i < ring.height(); i++)
+        expected[i] = ring.row(i);
+
+    for (int i = 0; i < 20; i++)
+    {
+        ring.push_row_front({i, i});
+        expected.push_front({i, i});
+    }
+    EXPECT_EQ(ring.capacity(), 32);
+
+    // INSERT AND REMOVE ON BOTH SIDES
+    ring.insert_row(2, {-1, -1});
+    expected.insert(expected.begin() + 2, {-1, -1});
+    ring.insert_row(ring.height() - 1, {-2, -2});
+    expected.insert(expected.end() - 1, {-2, -2});
+    ring.insert_row(ring.height(), {-3, -3});
+    expected.push_back({-3, -3});
+    ring.remove_row(1);
+    expected.erase(expected.begin() + 1);
+    ring.remove_row(ring.height() - 2);
+    expected.erase(expected.end() - 2);
+    ring.pop_row_back();
+    expected.pop_back();
+
+    ASSERT_EQ(ring.height(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_EQ(ring.row(i), expected[i]);
+
+    // INVALID
+    EXPECT_THROW(ring.push_row_back({1}), std::invalid_argument);
+    EXPECT_THROW(ring.insert_row(ring.height() + 1, {1, 2}), std::out_of_range);
+    EXPECT_THROW(ring.remove_row(ring.height()), std::out_of_range);
+    EXPECT_THROW(ring.row(ring.height()), std::out_of_range);
+    EXPECT_THROW(ring.cell(0, 2), std::out_of_range);
+
+    // CLEAR
+    ring.clear();
+    EXPECT_TRUE(ring.is_empty());
+    EXPECT_EQ(ring.keys(), (std::vector<std::string>{"A", "B"}));
+}
+
+/** @brief Test the conversions of the 'cdata_ring_frame' class. */
+TEST(TestRing, to_frame)
+{
+    cdata_frame<int> df({"A", "B"}, cmatrix<int>({{1, 2}, {3, 4}, {5, 6}}), {"a", "b", "c"});
+
+    // FROM A DATA FRAME
+    cdata_ring_frame<int> ring(df);
+    EXPECT_EQ(ring.height(), 3);
+    EXPECT_EQ(ring.index(1), "b");
+    EXPECT_EQ(ring.to_frame(), df);
+
+    // QUEUE
+    ring.pop_row_front();
+    ring.push_row_back({7, 8}, "d");
+    ring.push_row_front({0, 0}, "z");
+    EXPECT_EQ(ring.to_frame(), cdata_frame<int>({"A", "B"}, cmatrix<int>({{0, 0}, {3, 4}, {5, 6}, {7, 8}}), {"z", "b", "c", "d"}));
+
+    // UNIQUE INDEX: ONLY ONE ROW WITHOUT LABEL, A POPPED LABEL IS REUSED
+    ring.push_row_back({9, 9});
+    EXPECT_THROW(ring.push_row_back({9, 9}), std::runtime_error);
+    EXPECT_THROW(ring.push_row_front({9, 9}, "b"), std::runtime_error);
+    EXPECT_THROW(ring.insert_row(1, {9, 9}, "c"), std::runtime_error);
+    ring.pop_row_back();
+    ring.remove_row(1);
+    ring.push_row_back({9, 9}, "b");
+    EXPECT_EQ(ring.to_frame().index(), (std::vector<std::string>{"z", "c", "d", "b"}));
+
+    // WITHOUT KEYS AND INDEX
+    cdata_ring_frame<int> ring2;
+    ring2.push_row_back({1, 2, 3});
+    ring2.push_row_front({4, 5, 6});
+    EXPECT_EQ(ring2.width(), 3);
+    EXPECT_EQ(ring2.to_frame().data(), cmatrix<int>({{4, 5, 6}, {1, 2, 3}}));
+    EXPECT_FALSE(ring2.to_frame().has_index());
+
+    // FIRST LABEL: THE OTHER ROWS ARE LABELLED BY THEIR POSITION
+    ring2.push_row_back({7, 8, 9}, "1");
+    ring2.push_row_back({0, 0, 0});
+    EXPECT_EQ(ring2.to_frame().index(), (std::vector<std::string>{"0", "11", "1", ""}));
+}
+
+// ==================================================
+// APPENDER
+
+/** @brief Test the 'cdata_appender' class with several producers. */
+TEST(TestAppender, append)
+{
+    // DF PRODUCERS, SINGLE ROWS AND BATCHES
+    cdata_appender<int> appender({"thread", "value"}, 100000, 64);
+    const int n_threads = 8, n_rows = 1000;
+    std::atomic<bool> prefix(true);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; t++)
+        threads.emplace_back([&, t]()
+                             {
+            for (int i = 0; i < n_rows; i += 10)
+            {
+                if (i % 20 == 0)
+                {
+                    for (int j = i; j < i + 10; j++)
+                        appender.append_row({t, j + 1}, std::to_string(t) + "-" + std::to_string(j));
+                }
+                else
+                {
+                    std::vector<std::vector<int>> rows;
+                    std::vector<std::string> labels;
+                    for (int j = i; j < i + 10; j++)
+                    {
+                        rows.push_back({t, j + 1});
+                        labels.push_back(std::to_string(t) + "-" + std::to_string(j));
+                    }
+                    appender.append_rows(rows, labels);
+                }
+
+                // DF READERS SEE WRITTEN ROWS ONLY, NONE WHILE THE FIRST ROW IS RESERVED BUT NOT WRITTEN
+                const size_t height = appender.height();
+                if (height > 0 && appender.get(height - 1, 1) == 0)
+                    prefix = false;
+            } });
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    EXPECT_TRUE(prefix);
+    EXPECT_EQ(appender.height(), n_threads * n_rows);
+    EXPECT_EQ(appender.reserved(), n_threads * n_rows);
+
+    cdata_frame<int> df = appender.to_frame();
+    EXPECT_EQ(df.height(), n_threads * n_rows);
+    EXPECT_TRUE(df.has_index());
+
+    // DF EACH ROW ONCE, IN THE ORDER OF EACH PRODUCER
+    std::vector<int> last(n_threads, 0);
+    for (size_t r = 0; r < df.height(); r++)
+    {
+        const int t = df.cell(r, 0), val = df.cell(r, 1);
+        EXPECT_GT(val, last[t]);
+        last[t] = val;
+        EXPECT_EQ(appender.index(r), std::to_string(t) + "-" + std::to_string(val - 1));
+    }
+    EXPECT_EQ(last, std::vector<int>(n_threads, n_rows));
+
+    // DF ERRORS, NOTHING APPENDED
+    EXPECT_THROW(appender.append_row({0, 0}, "3-5"), std::runtime_error);
+    EXPECT_THROW(appender.append_rows({{0, 0}, {0, 0}}, {"new", "3-5"}), std::runtime_error);
+    EXPECT_FALSE(appender.contains("new"));
+    EXPECT_THROW(appender.append_row({0}), std::invalid_argument);
+    EXPECT_THROW(appender.append_rows({{0, 0}}, {"a", "b"}), std::invalid_argument);
+    EXPECT_THROW(appender.get(appender.height(), 0), std::out_of_range);
+    EXPECT_EQ(appender.height(), n_threads * n_rows);
+
+    // DF FULL
+    cdata_appender<double> small({"A"}, 3, 2);
+    EXPECT_THROW(cdata_appender<double>(std::vector<std::string>()), std::invalid_argument);
+    EXPECT_TRUE(small.to_frame().is_empty());
+    EXPECT_EQ(small.append_rows({{1.}, {2.}}), 0);
+    EXPECT_THROW(small.append_rows({{3.}, {4.}}, {"x", "y"}), std::runtime_error);
+    EXPECT_FALSE(small.contains("x"));
+    EXPECT_EQ(small.append_row({3.}), 2);
+    EXPECT_THROW(small.append_row({4.}), std::runtime_error);
+    EXPECT_EQ(small.to_frame(), cdata_frame<double>({"A"}, cmatrix<double>({{1.}, {2.}, {3.}})));
+    EXPECT_FALSE(small.to_frame().has_index());
+
+    // DF ROWS WITHOUT LABEL AFTER A LABEL: LABELLED BY THEIR POSITION
+    cdata_appender<int> mixed({"A"}, 10, 2);
+    mixed.append_row({1}, "1");
+    mixed.append_row({2});
+    mixed.append_row({3});
+    EXPECT_EQ(mixed.to_frame().index(), (std::vector<std::string>{"1", "_1", "2"}));
+}
+
+// ==================================================
+// VERSIONED
+
+/** @brief Test the 'cdata_versioned' and 'cdata_snapshot' classes. */
+TEST(TestVersioned, snapshot)
+{
+    // DF VERSIONS
+    cdata_frame<int> df({"A", "B"}, cmatrix<int>({{0, 0}, {1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}, {6, 60}, {7, 70}, {8, 80}, {9, 90}}));
+    df.set_index({"r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9"});
+    cdata_versioned<int> versioned(df, 4);
+
+    cdata_snapshot<int> s0 = versioned.snapshot();
+    EXPECT_EQ(s0.version(), 0);
+    EXPECT_EQ(s0.to_frame(), df);
+
+    versioned.set(5, 1, -1);
+    versioned.insert_row(2, {100, 100}, "new");
+    versioned.remove_row(0);
+    versioned.push_row_back({11, 110}, "r11");
+
+    df.set_index(std::vector<std::string>());
+    cdata_frame<int> expected = df;
+    expected.cell(5, 1) = -1;
+    expected.insert_row(2, {100, 100});
+    expected.remove_row(0);
+    expected.push_row_back({11, 110});
+
+    // DF SNAPSHOTS UNCHANGED
+    cdata_snapshot<int> s1 = versioned.snapshot();
+    EXPECT_EQ(s1.version(), 4);
+    EXPECT_EQ(s1.to_frame().data(), expected.data());
+    EXPECT_EQ(s1.index(1), "new");
+    EXPECT_EQ(s1.index(10), "r11");
+    EXPECT_EQ(s1.get(5, 1), -1);
+    EXPECT_EQ(s1.rows_vec(1), (std::vector<int>{100, 100}));
+    EXPECT_EQ(s1.columns_vec("A"), (std::vector<int>{1, 100, 2, 3, 4, 5, 6, 7, 8, 9, 11}));
+    EXPECT_EQ(s0.get(5, 1), 50);
+    EXPECT_EQ(s0.height(), 10);
+    EXPECT_EQ(s0.index(0), "r0");
+
+    // DF CHUNKS SHARED: ONLY THE CHUNK OF THE ROWS 4 TO 7 IN THE COLUMN A IS UNCHANGED
+    EXPECT_EQ(s1.n_shared(s0), 1);
+    versioned.set(0, 0, 1);
+    EXPECT_EQ(versioned.snapshot().n_shared(s1), 2 * 4 - 1);
+
+    // DF ERRORS
+    EXPECT_THROW(versioned.insert_row(0, {1, 1}, "r5"), std::runtime_error);
+    EXPECT_THROW(versioned.insert_row(20, {1, 1}), std::out_of_range);
+    EXPECT_THROW(versioned.push_row_back({1}), std::invalid_argument);
+    EXPECT_THROW(versioned.set(0, 2, 1), std::out_of_range);
+    EXPECT_THROW(versioned.remove_row(11), std::out_of_range);
+    EXPECT_THROW(s1.get(11, 0), std::out_of_range);
+    EXPECT_THROW(s1.columns_vec("C"), std::invalid_argument);
+    EXPECT_EQ(versioned.version(), 5);
+
+    // DF LABEL REUSED AFTER ITS ROW IS REMOVED, EMPTY CHUNKS REMOVED
+    versioned.remove_row(10);
+    versioned.push_row_back({12, 120}, "r11");
+    for (size_t i = 0; i < 11; i++)
+        versioned.remove_row(0);
+    EXPECT_TRUE(versioned.snapshot().is_empty());
+    versioned.push_row_back({1, 2});
+    EXPECT_EQ(versioned.snapshot().to_frame().data(), cmatrix<int>({{1, 2}}));
+
+    // DF FIRST LABEL: THE OTHER ROWS ARE LABELLED, ONLY ONE ROW WITHOUT LABEL
+    versioned.push_row_back({3, 4});
+    versioned.push_row_back({5, 6}, "x");
+    versioned.push_row_back({7, 8});
+    EXPECT_THROW(versioned.push_row_back({9, 10}), std::runtime_error);
+    EXPECT_THROW(versioned.push_row_back({9, 10}, "1"), std::runtime_error);
+    EXPECT_EQ(versioned.snapshot().to_frame().index(), (std::vector<std::string>{"0", "1", "x", ""}));
+
+    // DF READERS WHILE A WRITER UPDATES: EACH ROW HAS EQUAL CELLS IN EVERY VERSION
+    cdata_versioned<int> shared(cdata_frame<int>({"A", "B"}, cmatrix<int>(std::vector<std::vector<int>>(100, std::vector<int>(2, 0)))), 8);
+    std::atomic<bool> done(false), torn(false);
+
+    std::thread writer([&]()
+                       {
+        for (int i = 1; i <= 2000; i++)
+        {
+            shared.set_row(i % 90, {i, i});
+            if (i % 10 == 0)
+                shared.push_row_back({i, i});
+            if (i % 10 == 5)
+                shared.remove_row(0);
+        }
+        done = true; });
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; t++)
+        readers.emplace_back([&]()
+                             {
+            while (not done)
+            {
+                const cdata_snapshot<int> snapshot = shared.snapshot();
+                for (size_t r = 0; r < snapshot.height(); r++)
+                    if (snapshot.get(r, 0) != snapshot.get(r, 1))
+                        torn = true;
+            } });
+
+    writer.join();
+    for (std::thread &reader : readers)
+        reader.join();
+
+    EXPECT_FALSE(torn);
+    EXPECT_EQ(shared.snapshot().height(), 100);
+    EXPECT_EQ(shared.version(), 2000 + 400);
+}
+
+// ==================================================
+// MASK
+
+/** @brief Test the manipulation methods of the 'cdata_mask' class. */
+TEST(TestMask, manipulation)
+{
+    // PUSH BACK AND APPEND
+    cdata_mask mask;
+    std::vector<bool> expected;
+    for (size_t i = 0; i < 130; i++)
+    {
+        mask.push_back(i % 3 == 0);
+        expected.push_back(i % 3 == 0);
+    }
+    EXPECT_EQ(mask, cdata_mask(expected));
+
+    cdata_mask mask2({true, false, true});
+    mask.append(mask2);
+    expected.insert(expected.end(), {true, false, true});
+    EXPECT_EQ(mask, cdata_mask(expected));
+
+    // INSERT
+    mask.insert(0, true);
+    expected.insert(expected.begin(), true);
+    mask.insert(64, false);
+    expected.insert(expected.begin() + 64, false);
+    mask.insert(mask.size(), true);
+    expected.push_back(true);
+    EXPECT_EQ(mask, cdata_mask(expected));
+    EXPECT_THROW(mask.insert(mask.size() + 1, true), std::out_of_range);
+
+    // ERASE
+    mask.erase(63);
+    expected.erase(expected.begin() + 63);
+    mask.erase(0);
+    expected.erase(expected.begin());
+    mask.erase(mask.size() - 1);
+    expected.pop_back();
+    EXPECT_EQ(mask, cdata_mask(expected));
+    EXPECT_THROW(mask.erase(mask.size()), std::out_of_range);
+
+    // SLICE
+    EXPECT_EQ(mask.slice(60, 70), cdata_mask(std::vector<bool>(expected.begin() + 60, expected.begin() + 71)));
+    EXPECT_EQ(mask.slice(0, mask.size() - 1), mask);
+    EXPECT_THROW(mask.slice(2, 1), std::invalid_argument);
+    EXPECT_THROW(mask.slice(0, mask.size()), std::out_of_range);
+}
+
+/** @brief Test the operators of the 'cdata_mask' class. */
+TEST(TestMask, operators)
+{
+    cdata_mask mask({true, false, true, false});
+    cdata_mask mask2({true, true, false, false});
+    EXPECT_EQ(mask & mask2, cdata_mask({true, false, false, false}));
+    EXPECT_EQ(mask | mask2, cdata_mask({true, true, true, false}));
+    EXPECT_EQ(mask ^ mask2, cdata_mask({false, true, true, false}));
+    EXPECT_EQ(~mask, cdata_mask({false, true, false, true}));
+    EXPECT_EQ(mask.count(), 2);
+    EXPECT_EQ(mask.positions(), (std::vector<size_t>{0, 2}));
+    EXPECT_TRUE(mask.any());
+    EXPECT_FALSE(mask.all());
+    EXPECT_THROW(mask & cdata_mask(3), std::invalid_argument);
+    EXPECT_THROW(mask.get(4), std::out_of_range);
+
+    // NOT DOESN'T SET BITS OUT OF THE MASK
+    cdata_mask mask3(70);
+    EXPECT_EQ((~mask3).count(), 70);
+    EXPECT_TRUE((~mask3).all());
+    mask3.set(69);
+    EXPECT_EQ(mask3.positions(), (std::vector<size_t>{69}));
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);